@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "AllocationCounters.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replacing the global operator new and delete is the only way to see allocations made
+// from within the library's containers. The over-aligned forms are replaced too since
+// types like Manifold (and those containing it) are allocated through them. The
+// standard's nothrow forms call these so they don't need replacing.
+//
+// These are kept out of BenchmarkMain.cpp so the compiler doesn't see their definitions
+// where their calls are and warn about the malloc and free calls as mismatched.
+
+namespace {
+
+std::atomic<std::uint64_t> g_allocatedBytes{0};
+std::atomic<std::uint64_t> g_allocationCount{0};
+
+void CountAllocation(std::size_t size) noexcept
+{
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // anonymous namespace
+
+std::uint64_t GetAllocatedBytes() noexcept
+{
+    return g_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t GetAllocationCount() noexcept
+{
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    CountAllocation(size);
+    if (const auto p = std::malloc(size? size: 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__cpp_aligned_new)
+
+// Over-allocates via malloc and stores the pointer malloc returned just before the
+// aligned block so it can be freed later. This works everywhere unlike aligned_alloc.
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    CountAllocation(size);
+    const auto alignment = static_cast<std::size_t>(align);
+    if (const auto raw = std::malloc(size + alignment + sizeof(void*)))
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+        const auto aligned = reinterpret_cast<void**>((address + alignment - 1u) & ~(alignment - 1u));
+        aligned[-1] = raw;
+        return aligned;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    if (p)
+    {
+        std::free(static_cast<void**>(p)[-1]);
+    }
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t align) noexcept
+{
+    operator delete(p, align);
+}
+
+void operator delete[](void* p, std::align_val_t align) noexcept
+{
+    operator delete(p, align);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t align) noexcept
+{
+    operator delete(p, align);
+}
+
+#endif // defined(__cpp_aligned_new)
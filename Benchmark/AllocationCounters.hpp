@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef AllocationCounters_hpp
+#define AllocationCounters_hpp
+
+#include <cstdint>
+
+// Global allocation counters so benchmarks can report the memory traffic of what they
+// time. These count every allocation made through the global operator new.
+
+/// Gets the total number of bytes allocated so far.
+std::uint64_t GetAllocatedBytes() noexcept;
+
+/// Gets the total number of allocations made so far.
+std::uint64_t GetAllocationCount() noexcept;
+
+#endif /* AllocationCounters_hpp */
@@ -34,6 +34,7 @@
 #include <benchmark/benchmark.h>
 #include <tuple>
 #include <utility>
+#include <cstdint>
 #include <cstdlib>
 #include <vector>
 #include <future>
@@ -46,6 +47,9 @@
 #include <map>
 #include <type_traits>
 #include <functional>
+#include <memory>
+#include <new>
+#include <string>
 
 // #define BENCHMARK_GCDISPATCH
 #ifdef BENCHMARK_GCDISPATCH
@@ -54,22 +58,30 @@
 
 #include <PlayRho/Common/Math.hpp>
 #include <PlayRho/Common/OptionalValue.hpp>
+#include <PlayRho/Common/TaskScheduler.hpp>
 #include <PlayRho/Dynamics/World.hpp>
 #include <PlayRho/Dynamics/StepConf.hpp>
 #include <PlayRho/Dynamics/Contacts/ContactSolver.hpp>
 #include <PlayRho/Dynamics/Contacts/VelocityConstraint.hpp>
 #include <PlayRho/Dynamics/Joints/RevoluteJoint.hpp>
+#include <PlayRho/Dynamics/Joints/DistanceJoint.hpp>
 #include <PlayRho/Collision/Manifold.hpp>
 #include <PlayRho/Collision/WorldManifold.hpp>
 #include <PlayRho/Collision/ShapeSeparation.hpp>
 #include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/MultiShapeConf.hpp>
 
 // #define BENCHMARK_BOX2D
 #ifdef BENCHMARK_BOX2D
 #include <Box2D/Box2D.h>
 #endif // BENCHMARK_BOX2D
 
+#include "AllocationCounters.hpp"
+
 template <typename T>
 static T Rand(T lo, T hi)
 {
@@ -511,6 +523,176 @@ static void DoubleFma(benchmark::State& state)
     }
 }
 
+
+// ----
+
+template <typename T>
+static std::vector<T> FixedRands(unsigned count, float lo, float hi)
+{
+    const auto vals = Rands(count, lo, hi);
+    return std::vector<T>(std::begin(vals), std::end(vals));
+}
+
+template <typename T>
+static std::vector<std::pair<T, T>> FixedRandPairs(unsigned count, float lo, float hi)
+{
+    const auto vals = RandPairs(count, lo, hi);
+    auto pairs = std::vector<std::pair<T, T>>{};
+    pairs.reserve(count);
+    for (const auto& val: vals)
+    {
+        pairs.emplace_back(T(val.first), T(val.second));
+    }
+    return pairs;
+}
+
+static void Fixed32Sqrt(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed32>(static_cast<unsigned>(state.range()), 0.0f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(sqrt(val));
+        }
+    }
+}
+
+static void Fixed32Sin(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed32>(static_cast<unsigned>(state.range()), -4.0f, +4.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(sin(val));
+        }
+    }
+}
+
+static void Fixed32Cos(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed32>(static_cast<unsigned>(state.range()), -4.0f, +4.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(cos(val));
+        }
+    }
+}
+
+static void Fixed32Atan2(benchmark::State& state)
+{
+    const auto vals = FixedRandPairs<playrho::Fixed32>(static_cast<unsigned>(state.range()), -100.0f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(atan2(val.first, val.second));
+        }
+    }
+}
+
+static void Fixed32Exp(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed32>(static_cast<unsigned>(state.range()), -8.0f, +8.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(exp(val));
+        }
+    }
+}
+
+static void Fixed32Log(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed32>(static_cast<unsigned>(state.range()), 0.01f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(log(val));
+        }
+    }
+}
+
+#ifdef PLAYRHO_INT128
+
+static void Fixed64Sqrt(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed64>(static_cast<unsigned>(state.range()), 0.0f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(sqrt(val));
+        }
+    }
+}
+
+static void Fixed64Sin(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed64>(static_cast<unsigned>(state.range()), -4.0f, +4.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(sin(val));
+        }
+    }
+}
+
+static void Fixed64Cos(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed64>(static_cast<unsigned>(state.range()), -4.0f, +4.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(cos(val));
+        }
+    }
+}
+
+static void Fixed64Atan2(benchmark::State& state)
+{
+    const auto vals = FixedRandPairs<playrho::Fixed64>(static_cast<unsigned>(state.range()), -100.0f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(atan2(val.first, val.second));
+        }
+    }
+}
+
+static void Fixed64Exp(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed64>(static_cast<unsigned>(state.range()), -8.0f, +8.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(exp(val));
+        }
+    }
+}
+
+static void Fixed64Log(benchmark::State& state)
+{
+    const auto vals = FixedRands<playrho::Fixed64>(static_cast<unsigned>(state.range()), 0.01f, 100.0f);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            benchmark::DoNotOptimize(log(val));
+        }
+    }
+}
+#endif // PLAYRHO_INT128
+
 // ---
 
 static void noopFunc()
@@ -1621,6 +1803,39 @@ static void MaxSepBetweenRel4x4(benchmark::State& state)
     }
 }
 
+static void MaxSepBetweenRelNxM(benchmark::State& state)
+{
+    // Regular polygons of the given vertex counts.
+    const auto getShape = [](int count) {
+        auto vertices = playrho::d2::VertexSet{};
+        for (auto i = 0; i < count; ++i)
+        {
+            const auto angle = playrho::Real(i) * playrho::Real(360) * playrho::Degree / playrho::Real(count);
+            vertices.add(playrho::Length2{playrho::Real(cos(angle)) * playrho::Meter,
+                playrho::Real(sin(angle)) * playrho::Meter});
+        }
+        return playrho::d2::PolygonShapeConf{}.Set(vertices);
+    };
+    const auto shape0 = getShape(static_cast<int>(state.range(0)));
+    const auto shape1 = getShape(static_cast<int>(state.range(1)));
+    
+    const auto child0 = GetChild(shape0, 0);
+    const auto child1 = GetChild(shape1, 0);
+    
+    const auto vals = GetTransformationPairs(1000u);
+    for (auto _: state)
+    {
+        for (const auto& val: vals)
+        {
+            const auto xf0 = val.first;
+            const auto xf1 = val.second;
+            benchmark::DoNotOptimize(state.range(2)?
+                playrho::d2::GetMaxSeparationNxM(child0, xf0, child1, xf1):
+                playrho::d2::GetMaxSeparation(child0, xf0, child1, xf1));
+        }
+    }
+}
+
 static void MaxSepBetweenRelSquares(benchmark::State& state)
 {
     const auto dim = playrho::Real(2) * playrho::Meter;
@@ -1952,6 +2167,488 @@ static void DropDisks(benchmark::State& state)
     }
 }
 
+static void DropDisksOnChain(benchmark::State& state)
+{
+    auto world = playrho::d2::World{};
+
+    // Zig-zagging terrain outline of 20000 edges, optionally registered as a single proxy.
+    auto chainConf = playrho::d2::ChainShapeConf{};
+    for (auto i = 0; i <= 20000; ++i)
+    {
+        const auto x = (i - 10000) * 0.25f * playrho::Meter;
+        const auto y = ((i % 2) * 0.1f - 1.0f) * playrho::Meter;
+        chainConf.Add(playrho::Length2{x, y});
+    }
+    world.CreateBody()->CreateFixture(playrho::d2::Shape{chainConf},
+                                      playrho::d2::FixtureConf{}.UseSingleProxy(state.range(0) != 0));
+
+    const auto diskRadius = 0.5f * playrho::Meter;
+    const auto shape = playrho::d2::Shape{playrho::d2::DiskShapeConf{}.UseRadius(diskRadius)};
+    const auto numDisks = state.range(1);
+    for (auto i = decltype(numDisks){0}; i < numDisks; ++i)
+    {
+        const auto x = i * diskRadius * 4;
+        const auto location = playrho::Length2{x, 0 * playrho::Meter};
+        const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                                           .UseType(playrho::BodyType::Dynamic)
+                                           .UseLocation(location)
+                                           .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+        body->CreateFixture(shape);
+    }
+
+    const auto stepConf = playrho::StepConf{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(world.Step(stepConf));
+    }
+}
+
+static void DropDisksOnHeightField(benchmark::State& state)
+{
+    auto world = playrho::d2::World{};
+
+    // Same terrain as DropDisksOnChain but whose children are found by index arithmetic.
+    auto heights = std::vector<playrho::Length>{};
+    for (auto i = 0; i <= 20000; ++i)
+    {
+        heights.push_back(((i % 2) * 0.1f - 1.0f) * playrho::Meter);
+    }
+    const auto origin = playrho::Length2{-2500.0f * playrho::Meter, 0 * playrho::Meter};
+    world.CreateBody(playrho::d2::BodyConf{}.UseLocation(origin))->CreateFixture(
+        playrho::d2::Shape{playrho::d2::HeightFieldShapeConf{}.Set(0.25f * playrho::Meter, heights)});
+
+    const auto diskRadius = 0.5f * playrho::Meter;
+    const auto shape = playrho::d2::Shape{playrho::d2::DiskShapeConf{}.UseRadius(diskRadius)};
+    const auto numDisks = state.range(0);
+    for (auto i = decltype(numDisks){0}; i < numDisks; ++i)
+    {
+        const auto x = i * diskRadius * 4;
+        const auto location = playrho::Length2{x, 0 * playrho::Meter};
+        const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                                           .UseType(playrho::BodyType::Dynamic)
+                                           .UseLocation(location)
+                                           .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+        body->CreateFixture(shape);
+    }
+
+    const auto stepConf = playrho::StepConf{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(world.Step(stepConf));
+    }
+}
+
+static void CreateFixturesFromPrototypes(benchmark::State& state)
+{
+    const auto fixturesPerBody = state.range(0);
+    const auto interning = state.range(1) != 0;
+
+    // Octagons of a few different sizes as the prototypes.
+    auto prototypes = std::vector<playrho::d2::PolygonShapeConf>{};
+    for (auto i = 0; i < 4; ++i)
+    {
+        auto conf = playrho::d2::PolygonShapeConf{};
+        conf.UseDensity(1.0f * playrho::KilogramPerSquareMeter);
+        const auto vertices = playrho::GetCircleVertices((0.25f + i * 0.125f) * playrho::Meter, 8);
+        conf.Set(playrho::Span<const playrho::Length2>(vertices.data(), vertices.size() - 1));
+        prototypes.push_back(conf);
+    }
+
+    for (auto _: state)
+    {
+        auto world = playrho::d2::World{playrho::d2::WorldConf{}.UseShapeInterning(interning)};
+        for (auto i = 0; i < 100; ++i)
+        {
+            const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                                               .UseType(playrho::BodyType::Dynamic)
+                                               .UseLocation(playrho::Length2{i * 4.0f * playrho::Meter, 0.0f * playrho::Meter}));
+            for (auto j = decltype(fixturesPerBody){0}; j < fixturesPerBody; ++j)
+            {
+                const auto& conf = prototypes[static_cast<std::size_t>(j) % size(prototypes)];
+                body->CreateFixture(playrho::d2::Shape{conf});
+            }
+        }
+        benchmark::DoNotOptimize(world.GetBodies());
+    }
+}
+
+// Step configuration for the solver benchmarks. A zero sub-steps argument selects the
+// iterative solver with the given count of velocity iterations, otherwise the count is
+// the number of sub-steps.
+static playrho::StepConf GetSolverStepConf(benchmark::State& state)
+{
+    auto stepConf = playrho::StepConf{};
+    const auto count = static_cast<playrho::StepConf::iteration_type>(state.range(1));
+    if (state.range(0) != 0)
+    {
+        stepConf.regSubSteps = count;
+    }
+    else
+    {
+        stepConf.regVelocityIterations = count;
+    }
+    return stepConf;
+}
+
+static void VerticalStackSolver(benchmark::State& state)
+{
+    // Never-sleeping columns of the VerticalStack demo's small boxes, resting on each other
+    // with every other box slightly offset to the side, stepped for four seconds. Reports
+    // the largest sideways drift of any box from where it started and the sag of the top
+    // boxes from their resting heights at the end as measures of how stable the solver
+    // kept the stacks (a sag of about the stack height means a stack toppled).
+    const auto stepConf = GetSolverStepConf(state);
+    const auto rows = static_cast<int>(state.range(2));
+    const float xs[] = {0.0f, -10.0f, -5.0f, 5.0f, 10.0f};
+    const auto hdim = 0.1f;
+    const auto shape = playrho::d2::Shape{playrho::d2::PolygonShapeConf{}
+        .UseDensity(1.0f * playrho::KilogramPerSquareMeter)
+        .UseFriction(0.3f)
+        .SetAsBox(hdim * playrho::Meter, hdim * playrho::Meter)};
+    auto drift = 0.0f;
+    auto sag = 0.0f;
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        auto world = playrho::d2::World{};
+        world.CreateBody()->CreateFixture(playrho::d2::Shape{playrho::d2::EdgeShapeConf{
+            playrho::Length2{-40.0f * playrho::Meter, 0.0f * playrho::Meter},
+            playrho::Length2{40.0f * playrho::Meter, 0.0f * playrho::Meter}}});
+        auto bodies = std::vector<std::pair<playrho::d2::Body*, float>>{};
+        auto tops = std::vector<playrho::d2::Body*>{};
+        for (auto&& column: xs)
+        {
+            for (auto i = 0; i < rows; ++i)
+            {
+                const auto x = column + ((i % 2 == 0)? -0.01f: 0.01f);
+                const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                    .UseType(playrho::BodyType::Dynamic)
+                    .UseAllowSleep(false)
+                    .UseLocation(playrho::Length2{x * playrho::Meter, (2 * i + 1) * hdim * playrho::Meter})
+                    .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+                body->CreateFixture(shape);
+                bodies.emplace_back(body, x);
+            }
+            tops.push_back(bodies.back().first);
+        }
+        state.ResumeTiming();
+        for (auto i = 0; i < 240; ++i)
+        {
+            world.Step(stepConf);
+        }
+        state.PauseTiming();
+        for (auto&& entry: bodies)
+        {
+            const auto x = static_cast<float>(playrho::StripUnit(GetX(entry.first->GetLocation())));
+            drift = std::max(drift, std::abs(x - entry.second));
+        }
+        for (auto&& top: tops)
+        {
+            const auto y = static_cast<float>(playrho::StripUnit(GetY(top->GetLocation())));
+            sag = std::max(sag, (2 * rows - 1) * hdim - y);
+        }
+        state.ResumeTiming();
+    }
+    state.counters["drift"] = drift;
+    state.counters["sag"] = sag;
+}
+
+static void WebSolver(benchmark::State& state)
+{
+    // Square web of disks joined to their neighbors by rigid distance joints, with its top
+    // corners pinned to the ground by revolute joints and a heavy box hanging from its
+    // bottom middle, stepped for four seconds. Reports the largest stretch of any distance
+    // joint at the end as a measure of how well the solver kept the web together.
+    const auto stepConf = GetSolverStepConf(state);
+    const auto size = static_cast<int>(state.range(2));
+    const auto disk = playrho::d2::Shape{playrho::d2::DiskShapeConf{}
+        .UseRadius(0.2f * playrho::Meter)
+        .UseDensity(1.0f * playrho::KilogramPerSquareMeter)};
+    const auto box = playrho::d2::Shape{playrho::d2::PolygonShapeConf{}
+        .UseDensity(20.0f * playrho::KilogramPerSquareMeter)
+        .SetAsBox(1.0f * playrho::Meter, 1.0f * playrho::Meter)};
+    auto stretch = 0.0f;
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        auto world = playrho::d2::World{};
+        const auto ground = world.CreateBody();
+        auto nodes = std::vector<playrho::d2::Body*>{};
+        for (auto row = 0; row < size; ++row)
+        {
+            for (auto col = 0; col < size; ++col)
+            {
+                const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                    .UseType(playrho::BodyType::Dynamic)
+                    .UseAllowSleep(false)
+                    .UseLocation(playrho::Length2{col * playrho::Meter, -row * playrho::Meter})
+                    .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+                body->CreateFixture(disk);
+                nodes.push_back(body);
+            }
+        }
+        auto joints = std::vector<playrho::d2::DistanceJoint*>{};
+        const auto join = [&](playrho::d2::Body* a, playrho::d2::Body* b) {
+            const auto joint = world.CreateJoint(playrho::d2::DistanceJointConf{
+                a, b, a->GetLocation(), b->GetLocation()});
+            joints.push_back(static_cast<playrho::d2::DistanceJoint*>(joint));
+        };
+        for (auto row = 0; row < size; ++row)
+        {
+            for (auto col = 0; col < size; ++col)
+            {
+                const auto node = nodes[static_cast<std::size_t>(row * size + col)];
+                if (col + 1 < size)
+                {
+                    join(node, nodes[static_cast<std::size_t>(row * size + col + 1)]);
+                }
+                if (row + 1 < size)
+                {
+                    join(node, nodes[static_cast<std::size_t>((row + 1) * size + col)]);
+                }
+            }
+        }
+        world.CreateJoint(playrho::d2::RevoluteJointConf{ground, nodes.front(), nodes.front()->GetLocation()});
+        world.CreateJoint(playrho::d2::RevoluteJointConf{ground, nodes[static_cast<std::size_t>(size - 1)],
+            nodes[static_cast<std::size_t>(size - 1)]->GetLocation()});
+        const auto bottom = nodes[static_cast<std::size_t>((size - 1) * size + size / 2)];
+        const auto weight = world.CreateBody(playrho::d2::BodyConf{}
+            .UseType(playrho::BodyType::Dynamic)
+            .UseAllowSleep(false)
+            .UseLocation(bottom->GetLocation() - playrho::Length2{0.0f * playrho::Meter, 2.0f * playrho::Meter})
+            .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+        weight->CreateFixture(box);
+        join(bottom, weight);
+        state.ResumeTiming();
+        for (auto i = 0; i < 240; ++i)
+        {
+            world.Step(stepConf);
+        }
+        state.PauseTiming();
+        for (auto&& joint: joints)
+        {
+            const auto pA = GetWorldPoint(*joint->GetBodyA(), joint->GetLocalAnchorA());
+            const auto pB = GetWorldPoint(*joint->GetBodyB(), joint->GetLocalAnchorB());
+            const auto length = playrho::StripUnit(playrho::GetMagnitude(pB - pA));
+            stretch = std::max(stretch, std::abs(static_cast<float>(length - playrho::StripUnit(joint->GetLength()))));
+        }
+        state.ResumeTiming();
+    }
+    state.counters["stretch"] = stretch;
+}
+
+static void BreakBodies(benchmark::State& state)
+{
+    // Two box bodies resting on the ground broken in half, the way the Breakable demo
+    // does it, then stepped once so any new contacts get found.
+    const auto inPlace = state.range(0) != 0;
+    const auto stepConf = playrho::StepConf{};
+    const auto box = playrho::d2::PolygonShapeConf{}
+        .UseDensity(1.0f * playrho::KilogramPerSquareMeter)
+        .UseFriction(0.5f);
+    const auto left = playrho::d2::Shape{playrho::d2::PolygonShapeConf{box}.SetAsBox(
+        0.5f * playrho::Meter, 0.5f * playrho::Meter,
+        playrho::Length2{-0.5f * playrho::Meter, 0.0f * playrho::Meter}, 0.0f * playrho::Degree)};
+    const auto right = playrho::d2::Shape{playrho::d2::PolygonShapeConf{box}.SetAsBox(
+        0.5f * playrho::Meter, 0.5f * playrho::Meter,
+        playrho::Length2{+0.5f * playrho::Meter, 0.0f * playrho::Meter}, 0.0f * playrho::Degree)};
+
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        auto world = playrho::d2::World{};
+        world.CreateBody()->CreateFixture(playrho::d2::Shape{playrho::d2::EdgeShapeConf{
+            playrho::Length2{-10.0f * playrho::Meter, 0.0f * playrho::Meter},
+            playrho::Length2{+410.0f * playrho::Meter, 0.0f * playrho::Meter}}});
+        auto bodies = std::vector<playrho::d2::Body*>{};
+        for (auto i = 0; i < 100; ++i)
+        {
+            const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                                               .UseType(playrho::BodyType::Dynamic)
+                                               .UseLocation(playrho::Length2{i * 4.0f * playrho::Meter, 0.5f * playrho::Meter})
+                                               .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+            body->CreateFixture(left);
+            body->CreateFixture(right);
+            bodies.push_back(body);
+        }
+        world.Step(stepConf);
+        state.ResumeTiming();
+        
+        for (auto&& body: bodies)
+        {
+            const auto fixture = *std::next(begin(body->GetFixtures()));
+            if (inPlace)
+            {
+                playrho::d2::Fixture* const fixtures[] = {fixture};
+                world.Split(*body, fixtures);
+            }
+            else
+            {
+                const auto shape = fixture->GetShape();
+                const auto newBody = world.CreateBody(playrho::d2::GetBodyConf(*body));
+                body->Destroy(fixture);
+                newBody->CreateFixture(shape);
+            }
+        }
+        benchmark::DoNotOptimize(world.Step(stepConf));
+    }
+}
+
+static void StepSleepingPiles(benchmark::State& state)
+{
+    // Piles of boxes that have all gone to sleep so stepping has next to nothing to do.
+    const auto piles = static_cast<int>(state.range(0));
+    const auto stepConf = playrho::StepConf{};
+    const auto box = playrho::d2::Shape{playrho::d2::PolygonShapeConf{}
+        .UseDensity(1.0f * playrho::KilogramPerSquareMeter)
+        .UseFriction(0.5f)
+        .SetAsBox(0.5f * playrho::Meter, 0.5f * playrho::Meter)};
+    auto world = playrho::d2::World{};
+    world.CreateBody()->CreateFixture(playrho::d2::Shape{playrho::d2::EdgeShapeConf{
+        playrho::Length2{-10.0f * playrho::Meter, 0.0f * playrho::Meter},
+        playrho::Length2{(piles * 4.0f + 10.0f) * playrho::Meter, 0.0f * playrho::Meter}}});
+    for (auto i = 0; i < piles; ++i)
+    {
+        for (auto j = 0; j < 5; ++j)
+        {
+            world.CreateBody(playrho::d2::BodyConf{}
+                             .UseType(playrho::BodyType::Dynamic)
+                             .UseLocation(playrho::Length2{i * 4.0f * playrho::Meter, (j + 0.5f) * playrho::Meter})
+                             .UseLinearAcceleration(playrho::d2::EarthlyGravity))->CreateFixture(box);
+        }
+    }
+    for (auto i = 0; (i < 2000) && (GetAwakeCount(world) > 0); ++i)
+    {
+        world.Step(stepConf);
+    }
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(world.Step(stepConf));
+    }
+}
+
+static void ScalingPiles(benchmark::State& state)
+{
+    // Columns of never-sleeping box bodies standing on the ground, parameterized by the
+    // number of bodies, the number of fixtures each body is made of, the number of bodies
+    // stacked per column (the pile density), and the number of worker threads (with zero
+    // meaning no task scheduler). Reports steps per second, allocations per step, and
+    // per-phase wall times (the latter only when step profiling is enabled) so scaling
+    // cliffs in the broad-phase, the island builder, and the solver are comparable.
+    const auto numBodies = static_cast<int>(state.range(0));
+    const auto fixturesPerBody = static_cast<int>(state.range(1));
+    const auto pileHeight = static_cast<int>(state.range(2));
+    const auto workers = static_cast<std::size_t>(state.range(3));
+
+    auto scheduler = std::unique_ptr<playrho::WorkStealingScheduler>{};
+    auto conf = playrho::d2::WorldConf{};
+    if (workers > 0)
+    {
+        scheduler = std::make_unique<playrho::WorkStealingScheduler>(workers);
+        conf.UseTaskScheduler(scheduler.get());
+    }
+    auto world = playrho::d2::World{conf};
+
+    const auto columns = (numBodies + pileHeight - 1) / pileHeight;
+    world.CreateBody()->CreateFixture(playrho::d2::Shape{playrho::d2::EdgeShapeConf{
+        playrho::Length2{-10.0f * playrho::Meter, 0.0f * playrho::Meter},
+        playrho::Length2{(columns * 1.5f + 10.0f) * playrho::Meter, 0.0f * playrho::Meter}}});
+
+    // Each body is a unit square split into as many side-by-side boxes as it has fixtures.
+    auto shapes = std::vector<playrho::d2::Shape>{};
+    const auto halfWidth = 0.5f / fixturesPerBody;
+    for (auto i = 0; i < fixturesPerBody; ++i)
+    {
+        const auto center = playrho::Length2{(-0.5f + (2 * i + 1) * halfWidth) * playrho::Meter,
+                                             0.0f * playrho::Meter};
+        shapes.push_back(playrho::d2::Shape{playrho::d2::PolygonShapeConf{}
+            .UseDensity(1.0f * playrho::KilogramPerSquareMeter)
+            .UseFriction(0.5f)
+            .SetAsBox(halfWidth * playrho::Meter, 0.5f * playrho::Meter, center, 0.0f * playrho::Degree)});
+    }
+    for (auto i = 0; i < numBodies; ++i)
+    {
+        const auto column = i / pileHeight;
+        const auto row = i % pileHeight;
+        const auto body = world.CreateBody(playrho::d2::BodyConf{}
+                                           .UseType(playrho::BodyType::Dynamic)
+                                           .UseAllowSleep(false)
+                                           .UseLocation(playrho::Length2{column * 1.5f * playrho::Meter,
+                                                                         (row + 0.5f) * playrho::Meter})
+                                           .UseLinearAcceleration(playrho::d2::EarthlyGravity));
+        for (auto&& shape: shapes)
+        {
+            body->CreateFixture(shape);
+        }
+    }
+
+    // Lets the contacts get found and the piles settle before anything gets timed.
+    const auto stepConf = playrho::StepConf{};
+    for (auto i = 0; i < 10; ++i)
+    {
+        world.Step(stepConf);
+    }
+
+#if defined(PLAYRHO_ENABLE_PROFILING)
+    auto phaseTimes = playrho::StepPhaseTimes{};
+#endif
+    const auto startBytes = GetAllocatedBytes();
+    const auto startCount = GetAllocationCount();
+    for (auto _: state)
+    {
+        const auto stepStats = world.Step(stepConf);
+#if defined(PLAYRHO_ENABLE_PROFILING)
+        for (auto i = std::size_t{0}; i < playrho::StepPhaseCount; ++i)
+        {
+            phaseTimes[i].wall += stepStats.times[i].wall;
+        }
+#endif
+        benchmark::DoNotOptimize(stepStats);
+    }
+    const auto bytes = GetAllocatedBytes() - startBytes;
+    const auto count = GetAllocationCount() - startCount;
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["steps/s"] = benchmark::Counter(iterations, benchmark::Counter::kIsRate);
+    state.counters["bytes/step"] = benchmark::Counter(static_cast<double>(bytes),
+                                                      benchmark::Counter::kAvgIterations);
+    state.counters["allocs/step"] = benchmark::Counter(static_cast<double>(count),
+                                                       benchmark::Counter::kAvgIterations);
+    state.counters["contacts"] = static_cast<double>(GetTouchingCount(world));
+#if defined(PLAYRHO_ENABLE_PROFILING)
+    for (auto i = std::size_t{0}; i < playrho::StepPhaseCount; ++i)
+    {
+        const auto name = std::string{ToString(static_cast<playrho::StepPhase>(i))} + "/ns";
+        state.counters[name] = benchmark::Counter(static_cast<double>(phaseTimes[i].wall.count()),
+                                                  benchmark::Counter::kAvgIterations);
+    }
+#endif
+}
+
+static void ConvexDecomposeStars(benchmark::State& state)
+{
+    // Batch of concave star polygons like the outlines of fractured pieces.
+    const auto points = static_cast<int>(state.range(0));
+    auto polygons = std::vector<std::vector<playrho::Length2>>{};
+    for (auto k = 0; k < 32; ++k)
+    {
+        auto polygon = std::vector<playrho::Length2>{};
+        for (auto i = 0; i < points * 2; ++i)
+        {
+            const auto radius = (((i % 2) == 0)? 2.0f + k * 0.01f: 1.0f) * playrho::Meter;
+            const auto angle = static_cast<playrho::Real>(i) * playrho::Pi / points;
+            polygon.push_back(playrho::Length2{radius * std::cos(angle), radius * std::sin(angle)});
+        }
+        polygons.push_back(polygon);
+    }
+    const auto prototype = playrho::d2::MultiShapeConf{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(playrho::d2::GetConvexDecompositions(prototype, polygons));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size(polygons)));
+}
+
 static void AddPairStressTestPlayRho(benchmark::State& state, int count)
 {
     const auto diskConf = playrho::d2::DiskShapeConf{}
@@ -2074,7 +2771,7 @@ static void AddPairStressTestBox2D400(benchmark::State& state)
 }
 #endif // BENCHMARK_BOX2D
 
-static void DropTilesPlayRho(int count)
+static void DropTilesPlayRho(int count, bool coherent = false)
 {
     constexpr auto linearSlop = 0.005f * playrho::Meter;
     constexpr auto angularSlop = (2.0f / 180.0f * playrho::Pi) * playrho::Radian;
@@ -2152,6 +2849,11 @@ static void DropTilesPlayRho(int count)
     step.maxTranslation = 2.0f * playrho::Meter;
     step.velocityThreshold = 1.0f * playrho::MeterPerSecond;
     step.maxSubSteps = std::uint8_t{8};
+    if (coherent)
+    {
+        step.linearCoherenceTolerance = linearSlop / 4;
+        step.angularCoherenceTolerance = angularSlop / 8;
+    }
 
     while (GetAwakeCount(world) > 0)
     {
@@ -2245,6 +2947,15 @@ static void TilesRestPlayRho(benchmark::State& state)
     }
 }
 
+static void TilesRestCoherentPlayRho(benchmark::State& state)
+{
+    const auto range = state.range();
+    for (auto _: state)
+    {
+        DropTilesPlayRho(range, true);
+    }
+}
+
 #ifdef BENCHMARK_BOX2D
 static void TilesRestBox2D(benchmark::State& state)
 {
@@ -2409,6 +3120,21 @@ BENCHMARK(DoubleAtan2)->Arg(1000);
 BENCHMARK(DoubleHypot)->Arg(1000);
 BENCHMARK(DoubleFma)->Arg(1000);
 
+BENCHMARK(Fixed32Sqrt)->Arg(1000);
+BENCHMARK(Fixed32Sin)->Arg(1000);
+BENCHMARK(Fixed32Cos)->Arg(1000);
+BENCHMARK(Fixed32Atan2)->Arg(1000);
+BENCHMARK(Fixed32Exp)->Arg(1000);
+BENCHMARK(Fixed32Log)->Arg(1000);
+#ifdef PLAYRHO_INT128
+BENCHMARK(Fixed64Sqrt)->Arg(1000);
+BENCHMARK(Fixed64Sin)->Arg(1000);
+BENCHMARK(Fixed64Cos)->Arg(1000);
+BENCHMARK(Fixed64Atan2)->Arg(1000);
+BENCHMARK(Fixed64Exp)->Arg(1000);
+BENCHMARK(Fixed64Log)->Arg(1000);
+#endif // PLAYRHO_INT128
+
 BENCHMARK(AlmostEqual1)->Arg(1000);
 BENCHMARK(AlmostEqual2)->Arg(1000);
 BENCHMARK(AlmostEqual3)->Arg(1000);
@@ -2458,6 +3184,10 @@ BENCHMARK(AABB)->Arg(1000);
 // BENCHMARK(MaxSepBetweenAbsSquares);
 BENCHMARK(MaxSepBetweenRel4x4)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
 BENCHMARK(MaxSepBetweenRelSquaresNoStop)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(MaxSepBetweenRelNxM)
+    ->Args({3, 6, 0})->Args({3, 6, 1})->Args({4, 4, 0})->Args({4, 4, 1})
+    ->Args({6, 6, 0})->Args({6, 6, 1})->Args({8, 8, 0})->Args({8, 8, 1})
+    ->Args({16, 16, 0})->Args({16, 16, 1});
 BENCHMARK(MaxSepBetweenRelSquares)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
 
 BENCHMARK(ConstructAndAssignVC);
@@ -2484,6 +3214,33 @@ BENCHMARK(WorldStepWithStatsStatic)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Arg(1000
 //BENCHMARK(WorldStepWithStatsDynamicBodies)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Repetitions(4);
 
 BENCHMARK(DropDisks)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(DropDisksOnChain)->Args({0, 10})->Args({1, 10})->Args({0, 1000})->Args({1, 1000});
+BENCHMARK(DropDisksOnHeightField)->Arg(10)->Arg(1000);
+BENCHMARK(ConvexDecomposeStars)->Arg(4)->Arg(8)->Arg(32);
+BENCHMARK(BreakBodies)->Arg(0)->Arg(1);
+BENCHMARK(StepSleepingPiles)->Arg(10)->Arg(100)->Arg(1000);
+
+// Scaling families over {bodies, fixtures per body, pile height, workers}. Each one varies
+// a single parameter from a common baseline so results line up across commits.
+BENCHMARK(ScalingPiles)->ArgNames({"bodies", "fixtures", "height", "workers"})->UseRealTime()
+    ->Args({1000, 1, 8, 0})->Args({4000, 1, 8, 0})->Args({16000, 1, 8, 0})
+    ->Args({64000, 1, 8, 0})->Args({200000, 1, 8, 0});
+BENCHMARK(ScalingPiles)->ArgNames({"bodies", "fixtures", "height", "workers"})->UseRealTime()
+    ->Args({4000, 2, 8, 0})->Args({4000, 4, 8, 0})->Args({4000, 8, 8, 0});
+BENCHMARK(ScalingPiles)->ArgNames({"bodies", "fixtures", "height", "workers"})->UseRealTime()
+    ->Args({4000, 1, 1, 0})->Args({4000, 1, 2, 0})->Args({4000, 1, 32, 0})->Args({4000, 1, 128, 0});
+BENCHMARK(ScalingPiles)->ArgNames({"bodies", "fixtures", "height", "workers"})->UseRealTime()
+    ->Args({16000, 1, 8, 1})->Args({16000, 1, 8, 2})->Args({16000, 1, 8, 4})->Args({16000, 1, 8, 8});
+BENCHMARK(CreateFixturesFromPrototypes)->Args({1, 0})->Args({1, 1})->Args({32, 0})->Args({32, 1});
+
+// Iterative solver (with 8 and 32 velocity iterations) versus the sub-stepping solver (with
+// 4 and 8 sub-steps). Compare the time along with the drift or stretch counters.
+BENCHMARK(VerticalStackSolver)->ArgNames({"substep", "count", "rows"})
+    ->Args({0, 8, 10})->Args({0, 32, 10})->Args({1, 4, 10})->Args({1, 8, 10})
+    ->Args({0, 8, 30})->Args({0, 32, 30})->Args({1, 4, 30})->Args({1, 8, 30});
+BENCHMARK(WebSolver)->ArgNames({"substep", "count", "size"})
+    ->Args({0, 8, 8})->Args({0, 32, 8})->Args({1, 4, 8})->Args({1, 8, 8})
+    ->Args({0, 8, 16})->Args({0, 32, 16})->Args({1, 4, 16})->Args({1, 8, 16});
 
 // BENCHMARK(random_malloc_free_100);
 
@@ -2496,6 +3253,7 @@ BENCHMARK(AddPairStressTestBox2D400)->Arg(0)->Arg(10)->Arg(15)->Arg(16)->Arg(17)
 #endif // BENCHMARK_BOX2D
 
 BENCHMARK(TilesRestPlayRho)->Arg(12)->Arg(20)->Arg(36);
+BENCHMARK(TilesRestCoherentPlayRho)->Arg(12)->Arg(20)->Arg(36);
 #ifdef BENCHMARK_BOX2D
 BENCHMARK(TilesRestBox2D)->Arg(12)->Arg(20)->Arg(36);
 #endif // BENCHMARK_BOX2D
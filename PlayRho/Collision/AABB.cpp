@@ -110,5 +110,35 @@ AABB GetAABB(const RayCastInput& input) noexcept
     return AABB{input.p1, input.p1 + fractDelta};
 }
 
+AABB GetTransformedAABB(const AABB& aabb, const Transformation& xfm) noexcept
+{
+    if (aabb == AABB{})
+    {
+        return aabb;
+    }
+    const auto lower = GetLowerBound(aabb);
+    const auto upper = GetUpperBound(aabb);
+    auto result = AABB{Transform(lower, xfm)};
+    Include(result, Transform(upper, xfm));
+    Include(result, Transform(Length2{GetX(lower), GetY(upper)}, xfm));
+    Include(result, Transform(Length2{GetX(upper), GetY(lower)}, xfm));
+    return result;
+}
+
+AABB GetInverseTransformedAABB(const AABB& aabb, const Transformation& xfm) noexcept
+{
+    if (aabb == AABB{})
+    {
+        return aabb;
+    }
+    const auto lower = GetLowerBound(aabb);
+    const auto upper = GetUpperBound(aabb);
+    auto result = AABB{InverseTransform(lower, xfm)};
+    Include(result, InverseTransform(upper, xfm));
+    Include(result, InverseTransform(Length2{GetX(lower), GetY(upper)}, xfm));
+    Include(result, InverseTransform(Length2{GetX(upper), GetY(lower)}, xfm));
+    return result;
+}
+
 } // namespace d2
 } // namespace playrho
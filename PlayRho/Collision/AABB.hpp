@@ -373,6 +373,29 @@ PLAYRHO_CONSTEXPR inline Vector<Length, N> GetUpperBound(const AABB<N>& aabb) no
     return result;
 }
 
+/// @brief Gets the square of the distance from the given AABB to the given location.
+/// @details This is the squared distance from the location to the closest point within
+///   the AABB. As such, it's a lower bound on the squared distance from the location to
+///   anything the AABB encloses.
+/// @warning Behavior is undefined for an invalid AABB.
+/// @return Zero if the location is within the AABB, otherwise a positive area.
+/// @relatedalso AABB
+template <std::size_t N>
+PLAYRHO_CONSTEXPR inline Area GetDistanceSquared(const AABB<N>& aabb,
+                                                 const Vector<Length, N> location) noexcept
+{
+    auto result = Area{0};
+    for (auto i = decltype(N){0}; i < N; ++i)
+    {
+        const auto value = location[i];
+        const auto min = aabb.ranges[i].GetMin();
+        const auto max = aabb.ranges[i].GetMax();
+        const auto delta = (value < min)? min - value: (value > max)? value - max: Length{0};
+        result += delta * delta;
+    }
+    return result;
+}
+
 /// @brief Output stream operator.
 template <std::size_t N>
 inline ::std::ostream& operator<< (::std::ostream& os, const AABB<N>& value)
@@ -408,6 +431,7 @@ struct Transformation;
 
 using detail::TestOverlap;
 using detail::Contains;
+using detail::GetDistanceSquared;
 
 /// @brief 2-Dimensional Axis Aligned Bounding Box.
 /// @note This data structure is 16-bytes large (on at least one 64-bit platform).
@@ -474,6 +498,22 @@ AABB ComputeIntersectingAABB(const Contact& contact);
 /// @relatedalso playrho::detail::RayCastInput<2>
 AABB GetAABB(const playrho::detail::RayCastInput<2>& input) noexcept;
 
+/// @brief Gets the AABB enclosing the given AABB after it's been transformed by the
+///   given transformation.
+/// @note The result is the AABB of the transformed corners so it's only as tight as the
+///   given AABB when the transformation has no rotation.
+/// @return Unset AABB if the given AABB is unset, else the enclosing AABB.
+/// @relatedalso playrho::detail::AABB
+AABB GetTransformedAABB(const AABB& aabb, const Transformation& xfm) noexcept;
+
+/// @brief Gets the AABB enclosing the given AABB after it's been inverse transformed by
+///   the given transformation.
+/// @details This is the AABB enclosing the given world AABB in the frame of reference
+///   that the given transformation transforms from.
+/// @return Unset AABB if the given AABB is unset, else the enclosing AABB.
+/// @relatedalso playrho::detail::AABB
+AABB GetInverseTransformedAABB(const AABB& aabb, const Transformation& xfm) noexcept;
+
 } // namespace d2
 
 /// @brief Gets an invalid AABB value.
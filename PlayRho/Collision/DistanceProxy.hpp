@@ -44,7 +44,8 @@ namespace d2 {
     ///   These are used by the G.J.K. algorithm: "a method for determining the minimum distance
     ///   between two convex sets".
     ///
-    /// @note This data structure is 24-bytes.
+    /// @note Proxies made by the segment constructor own their vertices and normals.
+    ///   Other proxies refer to vertices and normals stored elsewhere.
     ///
     /// @sa https://en.wikipedia.org/wiki/Gilbert%2DJohnson%2DKeerthi_distance_algorithm
     ///
@@ -79,9 +80,26 @@ namespace d2 {
             std::copy(copy.m_vertices, copy.m_vertices + count, m_vertices);
             std::copy(copy.m_normals, copy.m_normals + count, m_normals);
 #else
-            // Intentionall empty.
+            CopySegment(copy);
 #endif
        }
+        
+        /// @brief Copy assignment operator.
+        DistanceProxy& operator= (const DistanceProxy& copy) noexcept
+        {
+#ifdef IMPLEMENT_DISTANCEPROXY_WITH_BUFFERS
+            const auto count = copy.m_count;
+            std::copy(copy.m_vertices, copy.m_vertices + count, m_vertices);
+            std::copy(copy.m_normals, copy.m_normals + count, m_normals);
+#else
+            m_vertices = copy.m_vertices;
+            m_normals = copy.m_normals;
+            CopySegment(copy);
+#endif
+            m_count = copy.m_count;
+            m_vertexRadius = copy.m_vertexRadius;
+            return *this;
+        }
 
         /// @brief Initializing constructor.
         ///
@@ -126,6 +144,38 @@ namespace d2 {
 #endif
         }
         
+        /// @brief Initializing constructor for a line segment.
+        ///
+        /// @details Constructs a distance proxy for the two-sided line segment between the
+        ///   given vertices, like the children of a chain shape. Unlike the other proxies,
+        ///   this one stores the vertices and their normals itself. This is for shapes that
+        ///   compute their children on demand instead of storing them.
+        ///
+        /// @param vertexRadius Radius of the given vertices.
+        /// @param v0 First vertex of the segment (relative to the shape's origin).
+        /// @param v1 Second vertex of the segment (relative to the shape's origin).
+        ///
+        DistanceProxy(const NonNegative<Length> vertexRadius, const Length2 v0,
+                      const Length2 v1) noexcept:
+            m_count{2},
+            m_vertexRadius{vertexRadius}
+        {
+            const auto normal = GetUnitVector(GetFwdPerpendicular(v1 - v0));
+#ifdef IMPLEMENT_DISTANCEPROXY_WITH_BUFFERS
+            m_vertices[0] = v0;
+            m_vertices[1] = v1;
+            m_normals[0] = normal;
+            m_normals[1] = -normal;
+#else
+            m_segmentVertices[0] = v0;
+            m_segmentVertices[1] = v1;
+            m_segmentNormals[0] = normal;
+            m_segmentNormals[1] = -normal;
+            m_vertices = m_segmentVertices;
+            m_normals = m_segmentNormals;
+#endif
+        }
+        
         /// Gets the vertex radius of the vertices of the associated shape.
         /// @return Non-negative distance.
         auto GetVertexRadius() const noexcept { return m_vertexRadius; }
@@ -177,12 +227,28 @@ namespace d2 {
         }
 
     private:
+#ifndef IMPLEMENT_DISTANCEPROXY_WITH_BUFFERS
+        /// @brief Copies the given proxy's own segment, if it has one, and refers to the copy.
+        void CopySegment(const DistanceProxy& copy) noexcept
+        {
+            if (copy.m_vertices == copy.m_segmentVertices)
+            {
+                std::copy(copy.m_segmentVertices, copy.m_segmentVertices + 2, m_segmentVertices);
+                std::copy(copy.m_segmentNormals, copy.m_segmentNormals + 2, m_segmentNormals);
+                m_vertices = m_segmentVertices;
+                m_normals = m_segmentNormals;
+            }
+        }
+#endif
+
 #ifdef IMPLEMENT_DISTANCEPROXY_WITH_BUFFERS
         Length2 m_vertices[MaxShapeVertices]; ///< Vertices.
         UnitVec m_normals[MaxShapeVertices]; ///< Normals.
 #else
         const Length2* m_vertices = nullptr; ///< Vertices.
         const UnitVec* m_normals = nullptr; ///< Normals.
+        Length2 m_segmentVertices[2]; ///< Vertices of a segment made by this proxy.
+        UnitVec m_segmentNormals[2]; ///< Normals of a segment made by this proxy.
 #endif
         VertexCounter m_count = 0; ///< Count of valid elements of m_vertices.
         NonNegative<Length> m_vertexRadius = 0_m; ///< Radius of the vertices of the associated shape.
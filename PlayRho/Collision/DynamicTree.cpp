@@ -24,6 +24,7 @@
 #include <PlayRho/Common/DynamicMemory.hpp>
 #include <PlayRho/Common/Math.hpp>
 #include <PlayRho/Common/Templates.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
 
 #include <cstring>
 #include <algorithm>
@@ -712,11 +713,95 @@ void Query(const DynamicTree& tree, const AABB& aabb, QueryFixtureCallback callb
 {
     Query(tree, aabb, [&](DynamicTree::Size treeId) {
         const auto leafData = tree.GetLeafData(treeId);
+        const auto fixture = leafData.fixture;
+        if (fixture && fixture->HasSharedProxy() && (fixture->GetChildTree() != &tree))
+        {
+            // Expand the shared proxy into just its children overlapping the AABB.
+            const auto xfm = GetTransformation(*fixture);
+            const auto completed = QueryChildren(*fixture, GetInverseTransformedAABB(aabb, xfm),
+                                                 [&](ChildCounter child, const AABB& localAABB) {
+                return !TestOverlap(GetTransformedAABB(localAABB, xfm), aabb) ||
+                    callback(fixture, child);
+            });
+            return completed? DynamicTreeOpcode::Continue: DynamicTreeOpcode::End;
+        }
         return callback(leafData.fixture, leafData.childIndex)?
         DynamicTreeOpcode::Continue: DynamicTreeOpcode::End;
     });
 }
 
+std::vector<DynamicTreeLeafDistance>
+FindNearest(const DynamicTree& tree, Length2 location, std::size_t count,
+            const DynamicTreeDistanceCB& callback, Area maxDistanceSquared)
+{
+    const auto nearer = [](const DynamicTreeLeafDistance& lhs, const DynamicTreeLeafDistance& rhs) {
+        return (lhs.distanceSquared != rhs.distanceSquared)?
+            (lhs.distanceSquared < rhs.distanceSquared): (lhs.leaf < rhs.leaf);
+    };
+    const auto further = [&](const DynamicTreeLeafDistance& lhs, const DynamicTreeLeafDistance& rhs) {
+        return nearer(rhs, lhs);
+    };
+
+    // Results are kept as a max-heap so the furthest one found so far is at the front.
+    auto results = std::vector<DynamicTreeLeafDistance>{};
+    const auto root = tree.GetRootIndex();
+    if ((count == 0) || (root == DynamicTree::GetInvalidSize()))
+    {
+        return results;
+    }
+
+    const auto getBound = [&]() {
+        return (size(results) < count)? maxDistanceSquared: results.front().distanceSquared;
+    };
+
+    // Nodes pending a visit are kept as a min-heap by the distance to their AABBs.
+    auto pending = std::vector<DynamicTreeLeafDistance>{};
+    pending.push_back(DynamicTreeLeafDistance{root, GetDistanceSquared(tree.GetAABB(root), location)});
+    while (!empty(pending))
+    {
+        std::pop_heap(begin(pending), end(pending), further);
+        const auto node = pending.back();
+        pending.pop_back();
+        if (node.distanceSquared > getBound())
+        {
+            // No remaining node can enclose anything nearer.
+            break;
+        }
+        const auto height = tree.GetHeight(node.leaf);
+        if (DynamicTree::IsBranch(height))
+        {
+            const auto branchData = tree.GetBranchData(node.leaf);
+            for (const auto child: {branchData.child1, branchData.child2})
+            {
+                const auto distanceSquared = GetDistanceSquared(tree.GetAABB(child), location);
+                if (distanceSquared <= getBound())
+                {
+                    pending.push_back(DynamicTreeLeafDistance{child, distanceSquared});
+                    std::push_heap(begin(pending), end(pending), further);
+                }
+            }
+        }
+        else
+        {
+            assert(DynamicTree::IsLeaf(height));
+            const auto entry = DynamicTreeLeafDistance{node.leaf, callback(node.leaf)};
+            if ((size(results) < count) && (entry.distanceSquared <= maxDistanceSquared))
+            {
+                results.push_back(entry);
+                std::push_heap(begin(results), end(results), nearer);
+            }
+            else if ((size(results) == count) && nearer(entry, results.front()))
+            {
+                std::pop_heap(begin(results), end(results), nearer);
+                results.back() = entry;
+                std::push_heap(begin(results), end(results), nearer);
+            }
+        }
+    }
+    std::sort_heap(begin(results), end(results), nearer);
+    return results;
+}
+
 Length ComputeTotalPerimeter(const DynamicTree& tree) noexcept
 {
     auto total = 0_m;
@@ -28,9 +28,11 @@
 #include <PlayRho/Collision/AABB.hpp>
 #include <PlayRho/Common/Settings.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace playrho {
 namespace d2 {
@@ -324,6 +326,38 @@ struct DynamicTree::LeafData
 
     /// @brief Child index of related Shape.
     ChildCounter childIndex;
+    
+    // The fixture's collision filter is cached so that pairs which are filtered out can
+    // be rejected while the tree is being queried without dereferencing the fixtures.
+    // Its fields are stored as plain integers of the same types as those of a Filter
+    // since a Filter isn't trivially default constructible as members of a union need
+    // to be (and this collision code shouldn't depend on the dynamics code anyway).
+
+    /// @brief Cached collision category bits of the associated Fixture.
+    /// @note This is zero for leaves not created with the fixture's filter.
+    std::uint16_t categoryBits;
+    
+    /// @brief Cached collision mask bits of the associated Fixture.
+    /// @note This is zero for leaves not created with the fixture's filter.
+    std::uint16_t maskBits;
+    
+    /// @brief Cached collision group index of the associated Fixture.
+    std::int16_t groupIndex;
+    
+    /// @brief Default constructor.
+    /// @note This leaves the data uninitialized so this stays trivially default
+    ///   constructible.
+    LeafData() noexcept = default;
+    
+    /// @brief Initializing constructor.
+    PLAYRHO_CONSTEXPR inline LeafData(Body* b, Fixture* f, ChildCounter c,
+                                      std::uint16_t category = 0, std::uint16_t mask = 0,
+                                      std::int16_t group = 0) noexcept:
+        body{b}, fixture{f}, childIndex{c},
+        categoryBits{category}, maskBits{mask}, groupIndex{group}
+    {
+        // Intentionally empty.
+    }
 };
 
 /// @brief Equality operator.
@@ -331,7 +365,9 @@ struct DynamicTree::LeafData
 PLAYRHO_CONSTEXPR inline bool operator== (const DynamicTree::LeafData& lhs,
                                           const DynamicTree::LeafData& rhs) noexcept
 {
-    return lhs.fixture == rhs.fixture && lhs.childIndex == rhs.childIndex;
+    return lhs.fixture == rhs.fixture && lhs.childIndex == rhs.childIndex
+        && lhs.categoryBits == rhs.categoryBits && lhs.maskBits == rhs.maskBits
+        && lhs.groupIndex == rhs.groupIndex;
 }
 
 /// @brief Inequality operator.
@@ -612,7 +648,7 @@ inline void DynamicTree::SetLeafData(Size index, LeafData value) noexcept
     assert(index != GetInvalidSize());
     assert(index < m_nodeCapacity);
     assert(IsLeaf(m_nodes[index].GetHeight()));
-    m_nodes[index].AsLeaf() = value;
+    m_nodes[index].Assign(value);
 }
 
 // Free functions...
@@ -753,11 +789,48 @@ void Query(const DynamicTree& tree, const AABB& aabb,
 using QueryFixtureCallback = std::function<bool(Fixture* fixture, ChildCounter child)>;
 
 /// @brief Queries the world for all fixtures that potentially overlap the provided AABB.
+/// @note For a leaf of a fixture having a shared proxy, the callback is called for each
+///   of the fixture's children whose AABB overlaps the provided AABB.
 /// @param tree Dynamic tree to do the query over.
 /// @param aabb The query box.
 /// @param callback User implemented callback function.
 void Query(const DynamicTree& tree, const AABB& aabb, QueryFixtureCallback callback);
 
+/// @brief Leaf distance callback type.
+/// @details Called with the index of a leaf to get the square of the distance from the
+///   queried location to the leaf's contents.
+/// @note Returned values must not be less than the squared distance from the location to
+///   the leaf's AABB for the results to be exact. Returning infinity excludes the leaf.
+using DynamicTreeDistanceCB = std::function<Area(DynamicTree::Size)>;
+
+/// @brief Leaf index and its squared distance from a queried location.
+struct DynamicTreeLeafDistance
+{
+    DynamicTree::Size leaf; ///< Index of the leaf within the tree.
+    Area distanceSquared; ///< Square of the distance of the leaf from the location.
+};
+
+/// @brief Finds up to the given count of leaves nearest to the given location.
+///
+/// @details Does a best-first, branch-and-bound, traversal of the tree ordered by the
+///   squared distance from the location to the nodes' AABBs. Nodes are only descended
+///   into when they could contain a leaf nearer than the furthest of the results found
+///   so far so that typically only a small fraction of the tree is visited.
+///
+/// @param tree Dynamic tree to search.
+/// @param location Location to find the nearest leaves to.
+/// @param count Maximum number of leaves to find.
+/// @param callback Leaf distance callback.
+/// @param maxDistanceSquared Square of the maximum distance of leaves to find.
+///
+/// @return Up to <code>count</code> leaves, sorted by increasing distance (and by leaf
+///   index for equal distances), whose squared distance isn't more than the given maximum.
+///
+std::vector<DynamicTreeLeafDistance>
+FindNearest(const DynamicTree& tree, Length2 location, std::size_t count,
+            const DynamicTreeDistanceCB& callback,
+            Area maxDistanceSquared = std::numeric_limits<Area>::infinity());
+
 /// @brief Gets the "size" of the given tree.
 /// @note Size in this context is defined as the leaf count.
 /// @note This provides ancillary support for the container concept's size method.
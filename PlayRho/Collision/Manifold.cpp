@@ -108,7 +108,7 @@ Manifold GetManifold(bool flipped,
     
     const auto r0 = shape0.GetVertexRadius();
     const auto r1 = shape1.GetVertexRadius();
-    const auto totalRadius = Length{r0 + r1};
+    const auto totalRadius = Length{r0 + r1 + conf.speculativeDistance};
     
     const auto idx0Next = GetModuloNext(idx0, shape0.GetVertexCount());
     
@@ -396,7 +396,8 @@ Manifold CollideShapes(const DistanceProxy& shapeA, const Transformation& xfA,
     // Find incident edge
     // Clip
     
-    const auto totalRadius = shapeA.GetVertexRadius() + shapeB.GetVertexRadius();
+    const auto totalRadius = shapeA.GetVertexRadius() + shapeB.GetVertexRadius()
+        + conf.speculativeDistance;
     const auto countA = shapeA.GetVertexCount();
     const auto countB = shapeB.GetVertexCount();
     
@@ -411,11 +412,14 @@ Manifold CollideShapes(const DistanceProxy& shapeA, const Transformation& xfA,
             return GetManifold(false, totalRadius, shapeA, xfA, shapeB.GetVertex(0), xfB);
     }
     
+    // Quadrilaterals (like boxes) are common enough to keep their own unrolled search which
+    // is faster for them than the general one. Otherwise any separation beyond the total
+    // radius means there's no contact so the searches can stop as soon as they find one.
     const auto do4x4 = (countA == 4) && (countB == 4);
     
     const auto edgeSepA = do4x4?
         GetMaxSeparation4x4(shapeA, xfA, shapeB, xfB):
-        GetMaxSeparation(shapeA, xfA, shapeB, xfB);
+        GetMaxSeparationNxM(shapeA, xfA, shapeB, xfB, totalRadius);
     if (edgeSepA.distance > totalRadius)
     {
         return Manifold{};
@@ -423,7 +427,7 @@ Manifold CollideShapes(const DistanceProxy& shapeA, const Transformation& xfA,
     
     const auto edgeSepB = do4x4?
         GetMaxSeparation4x4(shapeB, xfB, shapeA, xfA):
-        GetMaxSeparation(shapeB, xfB, shapeA, xfA);
+        GetMaxSeparationNxM(shapeB, xfB, shapeA, xfA, totalRadius);
     if (edgeSepB.distance > totalRadius)
     {
         return Manifold{};
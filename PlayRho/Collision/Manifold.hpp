@@ -472,6 +472,11 @@ struct Manifold::Conf
     ///   more than this amount, then face-manifolds are forced, else circles-manifolds
     ///   may be computed for new contact manifolds.
     Real maxCirclesRatio = DefaultCirclesRatio;
+
+    /// @brief Speculative distance.
+    /// @details Distance beyond the total vertex radius of the shapes within which
+    ///   manifold points still get calculated.
+    Length speculativeDistance = 0_m;
 };
 
 /// @brief Gets the default manifold configuration.
@@ -25,6 +25,7 @@
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
 #include <PlayRho/Dynamics/Fixture.hpp>
 #include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/World.hpp>
 
 namespace playrho {
 namespace d2 {
@@ -186,12 +187,16 @@ MassData ComputeMassData(const Body& body) noexcept
     auto mass = 0_kg;
     auto I = RotInertia{0};
     auto center = Length2{};
+    const auto world = body.GetWorld();
+    const auto registry = world? world->GetShapeRegistry(): nullptr;
     for (auto&& f: body.GetFixtures())
     {
         const auto& fixture = GetRef(f);
         if (fixture.GetDensity() > 0_kgpm2)
         {
-            const auto massData = GetMassData(fixture);
+            // Interned shapes have their mass data cached in the world's registry.
+            const auto massData = registry?
+                GetMassData(*registry, fixture.GetShape()): GetMassData(fixture);
             mass += Mass{massData.mass};
             center += Real{Mass{massData.mass} / Kilogram} * massData.center;
             I += RotInertia{massData.I};
@@ -27,10 +27,107 @@
 #include <PlayRho/Dynamics/Fixture.hpp>
 #include <PlayRho/Dynamics/Body.hpp>
 #include <utility>
+#include <vector>
 
 namespace playrho {
 namespace d2 {
 
+namespace {
+
+/// @brief Ray packet in structure of arrays form for the slab tests.
+/// @details Holds the rays' origins and inverse directions as unitless values in
+///   separate arrays so that testing many rays against an AABB runs through
+///   contiguous memory.
+struct RayPacket
+{
+    explicit RayPacket(std::size_t count):
+        x(count), y(count), invDx(count), invDy(count), tMax(count)
+    {
+        // Intentionally empty.
+    }
+    
+    std::vector<Real> x; ///< X-coordinates of the rays' first points in meters.
+    std::vector<Real> y; ///< Y-coordinates of the rays' first points in meters.
+    std::vector<Real> invDx; ///< Inverse of the rays' X-axis extents in per meters.
+    std::vector<Real> invDy; ///< Inverse of the rays' Y-axis extents in per meters.
+    std::vector<Real> tMax; ///< Maximum fractions of the rays.
+};
+
+/// @brief Gets the inverse of the given ray extent.
+/// @note Uses the largest value for a zero extent so the slab test never sees a NaN.
+inline Real GetInverse(Real extent) noexcept
+{
+    return (extent != 0)? Real{1} / extent: std::numeric_limits<Real>::max();
+}
+
+/// @brief Tests the ray of the given index against the slabs of the given bounds.
+inline bool TestSlabs(const RayPacket& packet, std::size_t i,
+                      Real minX, Real minY, Real maxX, Real maxY) noexcept
+{
+    const auto tx1 = (minX - packet.x[i]) * packet.invDx[i];
+    const auto tx2 = (maxX - packet.x[i]) * packet.invDx[i];
+    const auto ty1 = (minY - packet.y[i]) * packet.invDy[i];
+    const auto ty2 = (maxY - packet.y[i]) * packet.invDy[i];
+    const auto tmin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), Real{0});
+    const auto tmax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), packet.tMax[i]);
+    return tmin <= tmax;
+}
+
+/// @brief Ray casts the children sharing the given fixture's proxy.
+/// @details Finds the children with the ray in the fixture's body-local frame but calls
+///   the callback with the ray in world coordinates. Fractions along the ray are the same
+///   in either frame.
+/// @return Zero if the callback terminated the ray cast, else the ray's resulting
+///   maximum fraction.
+Real RayCastChildren(Fixture& fixture, const RayCastInput& input,
+                     const DynamicTreeRayCastCB& callback)
+{
+    const auto xfm = GetTransformation(fixture);
+    auto localInput = RayCastInput{
+        InverseTransform(input.p1, xfm), InverseTransform(input.p2, xfm), input.maxFraction
+    };
+    auto maxFraction = Real{input.maxFraction};
+    if (const auto childTree = fixture.GetChildTree())
+    {
+        const auto terminated = RayCast(*childTree, localInput, [&](Fixture* f, ChildCounter child,
+                                                                   const RayCastInput& in) {
+            const auto value = callback(f, child, RayCastInput{input.p1, input.p2, in.maxFraction});
+            if (value > 0)
+            {
+                maxFraction = value;
+            }
+            return value;
+        });
+        return terminated? Real{0}: maxFraction;
+    }
+    
+    // Otherwise clip the segment's AABB as the callback shortens the ray.
+    auto segmentAABB = d2::GetAABB(localInput);
+    const auto completed = QueryChildren(fixture, segmentAABB, [&](ChildCounter child,
+                                                                   const AABB& localAABB) {
+        if (!TestOverlap(localAABB, segmentAABB))
+        {
+            return true;
+        }
+        const auto value = callback(&fixture, child,
+                                    RayCastInput{input.p1, input.p2, maxFraction});
+        if (value == 0)
+        {
+            return false;
+        }
+        if (value > 0)
+        {
+            maxFraction = value;
+            localInput.maxFraction = value;
+            segmentAABB = d2::GetAABB(localInput);
+        }
+        return true;
+    });
+    return completed? maxFraction: Real{0};
+}
+
+} // anonymous namespace
+
 RayCastOutput RayCast(Length radius, Length2 location, const RayCastInput& input) noexcept
 {
     // Collision Detection in Interactive 3D Environments by Gino van den Bergen
@@ -271,7 +368,11 @@ bool RayCast(const DynamicTree& tree, RayCastInput input, const DynamicTreeRayCa
         {
             assert(DynamicTree::IsLeaf(tree.GetHeight(index)));
             const auto leafData = tree.GetLeafData(index);
-            const auto value = callback(leafData.fixture, leafData.childIndex, input);
+            const auto fixture = leafData.fixture;
+            const auto value = (fixture && fixture->HasSharedProxy() &&
+                                (fixture->GetChildTree() != &tree))?
+                RayCastChildren(*fixture, input, callback):
+                callback(leafData.fixture, leafData.childIndex, input);
             if (value == 0)
             {
                 return true; // Callback has terminated the ray cast.
@@ -324,5 +425,108 @@ bool RayCast(const DynamicTree& tree, const RayCastInput& rci, FixtureRayCastCB
     });
 }
 
+void RayCast(const DynamicTree& tree, Span<RayCastInput> inputs,
+             const DynamicTreeRayPacketCB& callback)
+{
+    const auto count = inputs.size();
+    auto packet = RayPacket{count};
+    
+    // Indices of the rays still in play. The rays passing a node's test are appended
+    // after those of its parent so the stack entries only need to refer to ranges.
+    auto active = std::vector<std::size_t>{};
+    active.reserve(count * 4);
+    for (auto i = decltype(count){0}; i < count; ++i)
+    {
+        const auto& input = inputs[i];
+        const auto delta = input.p2 - input.p1;
+        packet.x[i] = Real{GetX(input.p1) / Meter};
+        packet.y[i] = Real{GetY(input.p1) / Meter};
+        packet.invDx[i] = GetInverse(Real{GetX(delta) / Meter});
+        packet.invDy[i] = GetInverse(Real{GetY(delta) / Meter});
+        packet.tMax[i] = Real{input.maxFraction};
+        active.push_back(i);
+    }
+    
+    struct Entry
+    {
+        DynamicTree::Size index; ///< Tree node index.
+        std::size_t begin; ///< Begin of the node's rays in the active indices.
+        std::size_t end; ///< End of the node's rays in the active indices.
+    };
+    
+    GrowableStack<Entry, 256> stack;
+    stack.push(Entry{tree.GetRootIndex(), 0, count});
+    while (!empty(stack))
+    {
+        const auto entry = stack.top();
+        stack.pop();
+        if (entry.index == DynamicTree::GetInvalidSize())
+        {
+            continue;
+        }
+        
+        // Anything after this entry's range is from subtrees that are done with.
+        active.resize(entry.end);
+        
+        const auto aabb = tree.GetAABB(entry.index);
+        const auto minX = Real{aabb.ranges[0].GetMin() / Meter};
+        const auto maxX = Real{aabb.ranges[0].GetMax() / Meter};
+        const auto minY = Real{aabb.ranges[1].GetMin() / Meter};
+        const auto maxY = Real{aabb.ranges[1].GetMax() / Meter};
+        const auto begin = size(active);
+        for (auto k = entry.begin; k < entry.end; ++k)
+        {
+            const auto i = active[k];
+            if (TestSlabs(packet, i, minX, minY, maxX, maxY))
+            {
+                active.push_back(i);
+            }
+        }
+        const auto end = size(active);
+        if (begin == end)
+        {
+            continue;
+        }
+        
+        if (DynamicTree::IsBranch(tree.GetHeight(entry.index)))
+        {
+            const auto branchData = tree.GetBranchData(entry.index);
+            stack.push(Entry{branchData.child1, begin, end});
+            stack.push(Entry{branchData.child2, begin, end});
+        }
+        else
+        {
+            assert(DynamicTree::IsLeaf(tree.GetHeight(entry.index)));
+            const auto leafData = tree.GetLeafData(entry.index);
+            const auto rays = Span<const std::size_t>(data(active) + begin, end - begin);
+            const auto fixture = leafData.fixture;
+            if (fixture && fixture->HasSharedProxy() && (fixture->GetChildTree() != &tree))
+            {
+                // Hand the rays to just the children that their segments may reach.
+                auto aabb = AABB{};
+                for (auto&& i: rays)
+                {
+                    Include(aabb, d2::GetAABB(inputs[i]));
+                }
+                const auto xfm = GetTransformation(*fixture);
+                QueryChildren(*fixture, GetInverseTransformedAABB(aabb, xfm),
+                              [&](ChildCounter child, const AABB&) {
+                    callback(fixture, child, rays);
+                    return true;
+                });
+            }
+            else
+            {
+                callback(leafData.fixture, leafData.childIndex, rays);
+            }
+            for (auto k = begin; k < end; ++k)
+            {
+                const auto i = active[k];
+                packet.tMax[i] = Real{inputs[i].maxFraction};
+            }
+        }
+    }
+}
+
 } // namespace d2
 } // namespace playrho
@@ -27,6 +27,7 @@
 
 #include <PlayRho/Common/BoundedValue.hpp>
 #include <PlayRho/Common/OptionalValue.hpp>
+#include <PlayRho/Common/Span.hpp>
 #include <PlayRho/Collision/RayCastInput.hpp>
 
 namespace playrho {
@@ -94,6 +95,13 @@ using DynamicTreeRayCastCB = std::function<Real(Fixture* fixture, ChildCounter c
 using FixtureRayCastCB = std::function<RayCastOpcode(Fixture* fixture, ChildCounter child,
                                                      Length2 point, UnitVec normal)>;
 
+/// @brief Ray packet cast callback function.
+/// @details Called once for every leaf that's hit by any ray of the packet with the
+///   indices of the packet's rays whose bounds overlap the leaf's AABB.
+/// @note The callback may lower the <code>maxFraction</code> of these rays to clip them.
+using DynamicTreeRayPacketCB = std::function<void(Fixture* fixture, ChildCounter child,
+                                                  Span<const std::size_t> rays)>;
+
 /// @defgroup RayCastGroup Ray Casting Functions
 /// @brief Collection of functions that do ray casting.
 /// @image html raycast.png
@@ -135,6 +143,8 @@ RayCastOutput RayCast(const Shape& shape, ChildCounter childIndex,
 /// @note The callback also performs collision filtering.
 /// @note Performance is roughly k * log(n), where k is the number of collisions and n is the
 ///   number of leaf nodes in the tree.
+/// @note For a leaf of a fixture having a shared proxy, the callback is called for the
+///   fixture's children that the ray may hit instead.
 ///
 /// @param tree Dynamic tree to ray cast.
 /// @param input the ray-cast input data. The ray extends from <code>p1</code> to
@@ -161,6 +171,28 @@ bool RayCast(const DynamicTree& tree, RayCastInput input, const DynamicTreeRayCa
 ///
 bool RayCast(const DynamicTree& tree, const RayCastInput& input, FixtureRayCastCB callback);
 
+/// @brief Cast a packet of rays against the leafs in the given tree.
+///
+/// @details Traverses the tree once for the whole packet rather than once per ray.
+///   Each visited node's AABB is slab tested against the rays that passed its parent's
+///   test, so subtrees only get visited with the subset of rays that can reach them.
+///   Leafs are then handed to the callback along with all of their rays at once so
+///   that the callback can intersect the leaf's shape with them as a batch.
+///
+/// @note This is meant for larger bundles of rays, like those from a common origin
+///   that fan out over a field of view.
+/// @note The callback's clipping of rays shrinks their bounds for the rest of the traversal.
+/// @note For a leaf of a fixture having a shared proxy, the callback is called for the
+///   fixture's children that the rays may hit instead.
+///
+/// @param tree Dynamic tree to ray cast.
+/// @param inputs Ray-cast input data of the rays of the packet.
+/// @param callback A callback function that's called for each leaf that may be hit by
+///   one or more of the rays.
+///
+void RayCast(const DynamicTree& tree, Span<RayCastInput> inputs,
+             const DynamicTreeRayPacketCB& callback);
+
 /// @}
 
 } // namespace d2
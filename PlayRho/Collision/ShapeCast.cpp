@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Collision/ShapeCast.hpp>
+#include <PlayRho/Common/GrowableStack.hpp>
+#include <PlayRho/Collision/AABB.hpp>
+#include <PlayRho/Collision/Distance.hpp>
+#include <PlayRho/Collision/DynamicTree.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+
+namespace playrho {
+namespace d2 {
+
+namespace {
+
+inline Sweep GetSweep(const ShapeCastInput& input) noexcept
+{
+    const auto angle = GetAngle(input.transformation.q);
+    const auto location = input.transformation.p;
+    return Sweep{
+        Position{location, angle},
+        Position{location + input.translation * Real{input.maxFraction}, angle}
+    };
+}
+
+inline Transformation GetEndTransformation(const ShapeCastInput& input) noexcept
+{
+    return Transformation{
+        input.transformation.p + input.translation * Real{input.maxFraction},
+        input.transformation.q
+    };
+}
+
+} // anonymous namespace
+
+ShapeCastOutput ShapeCast(const DistanceProxy& proxy, const Transformation& xf,
+                          const ShapeCastInput& input, ToiConf conf)
+{
+    // The sweep covers only the input's max fraction of the translation so the TOI time
+    // needs rescaling into a fraction of the whole translation.
+    const auto sweepA = GetSweep(input);
+    const auto sweepB = Sweep{Position{xf.p, GetAngle(xf.q)}};
+    const auto output = GetToiViaSat(input.proxy, sweepA, proxy, sweepB, conf.UseTimeMax(1));
+    if (output.state != TOIOutput::e_touching)
+    {
+        return ShapeCastOutput{};
+    }
+    
+    const auto xfA = GetTransformation(sweepA, output.time);
+    const auto dinfo = Distance(input.proxy, xfA, proxy, xf);
+    const auto witnessPoints = GetWitnessPoints(dinfo.simplex);
+    const auto normal = GetUnitVector(-GetDelta(witnessPoints),
+                                      GetUnitVector(-input.translation, UnitVec::GetZero()));
+    const auto point = std::get<1>(witnessPoints) + proxy.GetVertexRadius() * normal;
+    const auto fraction = output.time * Real{input.maxFraction};
+    return ShapeCastOutput{ShapeCastHit{normal, point, UnitInterval<Real>{fraction}}};
+}
+
+bool ShapeCast(const DynamicTree& tree, ShapeCastInput input, const FixtureShapeCastCB& callback,
+               ToiConf conf)
+{
+    const auto maxFraction = input.maxFraction;
+    
+    // Half-extents of the cast shape's AABB. Growing a node's AABB by these reduces
+    // the test of the swept shape against the node to that of the swept AABB center.
+    const auto startAABB = ComputeAABB(input.proxy, input.transformation);
+    const auto startCenter = GetCenter(startAABB);
+    const auto shapeExtents = GetExtents(startAABB) + Length2{conf.tolerance, conf.tolerance};
+    const auto v = GetRevPerpendicular(GetUnitVector(input.translation, UnitVec::GetZero()));
+    const auto abs_v = abs(v);
+    
+    auto sweptAABB = GetFattenedAABB(ComputeAABB(input.proxy, input.transformation,
+                                                 GetEndTransformation(input)),
+                                     conf.tolerance);
+    
+    // Casts against the given child and handles the callback's opcode for the hit if any.
+    // Returns whether the callback terminated the cast.
+    const auto castChild = [&](Fixture* fixture, ChildCounter childIndex) {
+        const auto output = ShapeCast(GetChild(fixture->GetShape(), childIndex),
+                                      fixture->GetBody()->GetTransformation(), input, conf);
+        if (!output.has_value())
+        {
+            return false;
+        }
+        
+        const auto opcode = callback(fixture, childIndex, *output);
+        switch (opcode)
+        {
+            case RayCastOpcode::Terminate:
+                return true;
+            case RayCastOpcode::IgnoreFixture:
+                return false;
+            case RayCastOpcode::ClipRay:
+                input.maxFraction = output->fraction;
+                break;
+            case RayCastOpcode::ResetRay:
+                input.maxFraction = maxFraction;
+                break;
+        }
+        sweptAABB = GetFattenedAABB(ComputeAABB(input.proxy, input.transformation,
+                                                GetEndTransformation(input)),
+                                    conf.tolerance);
+        return false;
+    };
+    
+    GrowableStack<DynamicTree::Size, 256> stack;
+    stack.push(tree.GetRootIndex());
+    while (!empty(stack))
+    {
+        const auto index = stack.top();
+        stack.pop();
+        if (index == DynamicTree::GetInvalidSize())
+        {
+            continue;
+        }
+        
+        const auto aabb = tree.GetAABB(index);
+        if (!TestOverlap(aabb, sweptAABB))
+        {
+            continue;
+        }
+        
+        // Separating axis for the swept AABB center against the grown node AABB.
+        const auto center = GetCenter(aabb);
+        const auto extents = GetExtents(aabb) + shapeExtents;
+        const auto separation = abs(Dot(v, startCenter - center)) - Dot(abs_v, extents);
+        if (separation > 0_m)
+        {
+            continue;
+        }
+        
+        if (DynamicTree::IsBranch(tree.GetHeight(index)))
+        {
+            const auto branchData = tree.GetBranchData(index);
+            stack.push(branchData.child1);
+            stack.push(branchData.child2);
+            continue;
+        }
+        
+        assert(DynamicTree::IsLeaf(tree.GetHeight(index)));
+        const auto leafData = tree.GetLeafData(index);
+        const auto fixture = leafData.fixture;
+        if (fixture->HasSharedProxy() && (fixture->GetChildTree() != &tree))
+        {
+            // Cast against just the children that the swept shape may reach.
+            const auto xfm = GetTransformation(*fixture);
+            const auto completed = QueryChildren(*fixture, GetInverseTransformedAABB(sweptAABB, xfm),
+                                                 [&](ChildCounter child, const AABB&) {
+                return !castChild(fixture, child);
+            });
+            if (!completed)
+            {
+                return true;
+            }
+        }
+        else if (castChild(leafData.fixture, leafData.childIndex))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace d2
+} // namespace playrho
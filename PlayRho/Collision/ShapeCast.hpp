@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_COLLISION_SHAPECAST_HPP
+#define PLAYRHO_COLLISION_SHAPECAST_HPP
+
+/// @file
+/// Declarations of the shape cast structures and related free functions.
+
+#include <PlayRho/Common/BoundedValue.hpp>
+#include <PlayRho/Common/OptionalValue.hpp>
+#include <PlayRho/Collision/DistanceProxy.hpp>
+#include <PlayRho/Collision/RayCastOutput.hpp>
+#include <PlayRho/Collision/TimeOfImpact.hpp>
+
+#include <functional>
+
+namespace playrho {
+namespace d2 {
+
+class DynamicTree;
+class Fixture;
+
+/// @brief Shape cast input data.
+/// @details Describes a convex shape that's swept, without rotating, from its starting
+///   transformation by <code>maxFraction</code> of the given translation.
+/// @note The vertices referenced by the proxy must outlive any use of this input.
+struct ShapeCastInput
+{
+    DistanceProxy proxy; ///< Distance proxy of the convex shape to cast.
+    Transformation transformation = Transform_identity; ///< Starting transformation.
+    Length2 translation = Length2{}; ///< Translation of the whole cast.
+    
+    /// @brief Max fraction.
+    /// @details Unit interval value - a value between 0 and 1 inclusive.
+    UnitInterval<Real> maxFraction = UnitInterval<Real>{1};
+};
+
+/// @brief Shape cast hit data.
+struct ShapeCastHit
+{
+    /// @brief Surface normal at the point of impact.
+    /// @details Points from the hit shape towards the cast shape.
+    UnitVec normal;
+    
+    Length2 point; ///< Point of impact on the surface of the hit shape.
+    
+    /// @brief Fraction of the translation at which the impact occurs.
+    UnitInterval<Real> fraction = UnitInterval<Real>{0};
+};
+
+/// @brief Shape cast output data.
+/// @details This is a type alias for an optional <code>ShapeCastHit</code> instance.
+/// @sa ShapeCast, Optional, ShapeCastHit
+using ShapeCastOutput = Optional<ShapeCastHit>;
+
+/// @brief Fixture shape cast callback function.
+/// @details Called with each fixture child that's hit by the cast shape. The returned
+///   opcode's <code>ClipRay</code> value clips the cast to the given hit's fraction while
+///   its <code>ResetRay</code> value restores the cast to its input maximum fraction.
+using FixtureShapeCastCB = std::function<RayCastOpcode(Fixture* fixture, ChildCounter child,
+                                                       const ShapeCastHit& hit)>;
+
+/// @defgroup ShapeCastGroup Shape Casting Functions
+/// @brief Collection of functions that sweep convex shapes against other shapes.
+/// @{
+
+/// @brief Gets the default shape cast TOI configuration.
+/// @details This targets a separation of the shapes' total vertex radius so that hits
+///   are reported for when the shapes' surfaces first touch.
+PLAYRHO_CONSTEXPR inline ToiConf GetDefaultShapeCastConf() noexcept
+{
+    return ToiConf{}.UseTargetDepth(0_m);
+}
+
+/// @brief Casts the input shape against the given stationary shape.
+///
+/// @details Uses the exact time of impact of the swept input shape against the given
+///   shape to find where along its translation the input shape first touches it.
+///
+/// @note Shapes that overlap at the start of the cast are not reported as hit.
+///
+/// @param proxy Distance proxy of the stationary shape.
+/// @param xf Transformation of the stationary shape.
+/// @param input Shape cast input data.
+/// @param conf Time of impact configuration.
+///
+/// @return Hit data if the input shape touches the given shape within the input's
+///   maximum fraction of its translation, an empty value otherwise.
+///
+ShapeCastOutput ShapeCast(const DistanceProxy& proxy, const Transformation& xf,
+                          const ShapeCastInput& input,
+                          ToiConf conf = GetDefaultShapeCastConf());
+
+/// @brief Shape casts the dynamic tree for all fixtures in the path of the input shape.
+///
+/// @details Traverses the tree using the input shape's swept AABB, conservatively expanded
+///   by the configured tolerance, and a separating axis test of the sweep. Every leaf whose
+///   AABB passes these tests gets an exact time of impact calculation.
+///
+/// @note The callback controls whether you get the closest hit, any hit, or n-hits.
+/// @note Clipping the cast shrinks the swept AABB for the rest of the traversal.
+/// @note For a leaf of a fixture having a shared proxy, just the fixture's children that
+///   the swept AABB overlaps get the exact calculation.
+///
+/// @param tree Dynamic tree to shape cast.
+/// @param input Shape cast input data.
+/// @param callback A user implemented callback function.
+/// @param conf Time of impact configuration.
+///
+/// @return <code>true</code> if terminated by callback, <code>false</code> otherwise.
+///
+bool ShapeCast(const DynamicTree& tree, ShapeCastInput input, const FixtureShapeCastCB& callback,
+               ToiConf conf = GetDefaultShapeCastConf());
+
+/// @}
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_COLLISION_SHAPECAST_HPP
@@ -64,6 +64,33 @@ LengthIndices GetMinSeparationInfo(Length2 origin, UnitVec direction,
     return LengthIndices{minSeparation, {{first, second}}};
 }
 
+/// @brief Gets the minimum separation information for the given structure of arrays of
+///   vertices from the given origin in the given direction.
+/// @note This is the same search as the one over a range of vertices but over unitless
+///   coordinates.
+LengthIndices GetMinSeparationInfo(Real ox, Real oy, Real nx, Real ny,
+                                   const Real* xs, const Real* ys, std::size_t count) noexcept
+{
+    auto minSeparation = std::numeric_limits<Real>::infinity();
+    auto first = InvalidVertex;
+    auto second = InvalidVertex;
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto s = nx * (xs[i] - ox) + ny * (ys[i] - oy);
+        if (minSeparation > s)
+        {
+            minSeparation = s;
+            first = static_cast<VertexCounter>(i);
+            second = InvalidVertex;
+        }
+        else if (minSeparation == s)
+        {
+            second = static_cast<VertexCounter>(i);
+        }
+    }
+    return LengthIndices{minSeparation * Meter, {{first, second}}};
+}
+
 } // anonymous namespace
 
 SeparationInfo GetMaxSeparation4x4(const DistanceProxy& proxy1, Transformation xf1,
@@ -108,6 +135,94 @@ SeparationInfo GetMaxSeparation4x4(const DistanceProxy& proxy1, Transformation x
     return SeparationInfo{separation, firstIndex, secondIndices};
 }
 
+SeparationInfo GetMaxSeparationNxM(const DistanceProxy& proxy1, Transformation xf1,
+                                   const DistanceProxy& proxy2, Transformation xf2,
+                                   Length stop)
+{
+    // Count of proxy1's normals that are evaluated together against each of proxy2's
+    // vertices. The per lane operations are independent of each other so compilers can
+    // map them onto SIMD registers.
+    PLAYRHO_CONSTEXPR const auto Lanes = std::size_t{4};
+    
+    const auto count1 = std::size_t{proxy1.GetVertexCount()};
+    const auto count2 = std::size_t{proxy2.GetVertexCount()};
+    assert(count1 <= MaxShapeVertices);
+    assert(count2 <= MaxShapeVertices);
+    
+    // Get proxy2's vertices relative to proxy1 as a structure of arrays.
+    const auto xf = MulT(xf1, xf2);
+    Real xs[MaxShapeVertices];
+    Real ys[MaxShapeVertices];
+    for (auto j = std::size_t{0}; j < count2; ++j)
+    {
+        const auto vertex = Transform(proxy2.GetVertex(static_cast<VertexCounter>(j)), xf);
+        xs[j] = StripUnit(get<0>(vertex));
+        ys[j] = StripUnit(get<1>(vertex));
+    }
+    
+    // Find the max separation between proxy1 and proxy2 using edge normals from proxy1.
+    const auto stopValue = StripUnit(stop);
+    auto separation = -std::numeric_limits<Real>::infinity();
+    auto firstIndex = InvalidVertex;
+    for (auto i = std::size_t{0}; i < count1; i += Lanes)
+    {
+        Real ox[Lanes];
+        Real oy[Lanes];
+        Real nx[Lanes];
+        Real ny[Lanes];
+        for (auto k = std::size_t{0}; k < Lanes; ++k)
+        {
+            // Pad any lanes past the last normal with the last normal.
+            const auto index = static_cast<VertexCounter>(std::min(i + k, count1 - 1));
+            const auto origin = proxy1.GetVertex(index);
+            const auto normal = proxy1.GetNormal(index);
+            ox[k] = StripUnit(get<0>(origin));
+            oy[k] = StripUnit(get<1>(origin));
+            nx[k] = normal.GetX();
+            ny[k] = normal.GetY();
+        }
+        Real minSeparations[Lanes];
+        std::fill(minSeparations, minSeparations + Lanes, std::numeric_limits<Real>::infinity());
+        for (auto j = std::size_t{0}; j < count2; ++j)
+        {
+            const auto x = xs[j];
+            const auto y = ys[j];
+            for (auto k = std::size_t{0}; k < Lanes; ++k)
+            {
+                const auto s = nx[k] * (x - ox[k]) + ny[k] * (y - oy[k]);
+                minSeparations[k] = (s < minSeparations[k])? s: minSeparations[k];
+            }
+        }
+        const auto end = std::min(i + Lanes, count1);
+        for (auto k = i; k < end; ++k)
+        {
+            const auto minSeparation = minSeparations[k - i];
+            if (stopValue < minSeparation)
+            {
+                const auto ap = GetMinSeparationInfo(ox[k - i], oy[k - i], nx[k - i], ny[k - i],
+                                                     xs, ys, count2);
+                return SeparationInfo{ap.distance, static_cast<VertexCounter>(k), ap.indices};
+            }
+            if (separation < minSeparation)
+            {
+                separation = minSeparation;
+                firstIndex = static_cast<VertexCounter>(k);
+            }
+        }
+    }
+    if (firstIndex == InvalidVertex)
+    {
+        return SeparationInfo{separation * Meter, firstIndex, {{InvalidVertex, InvalidVertex}}};
+    }
+    
+    // Only the winning normal needs the indices of its most anti-parallel vertices.
+    const auto origin = proxy1.GetVertex(firstIndex);
+    const auto normal = proxy1.GetNormal(firstIndex);
+    const auto ap = GetMinSeparationInfo(StripUnit(get<0>(origin)), StripUnit(get<1>(origin)),
+                                         normal.GetX(), normal.GetY(), xs, ys, count2);
+    return SeparationInfo{ap.distance, firstIndex, ap.indices};
+}
+
 SeparationInfo GetMaxSeparation(const DistanceProxy& proxy1, Transformation xf1,
                                 const DistanceProxy& proxy2, Transformation xf2)
 {
@@ -58,6 +58,28 @@ SeparationInfo GetMaxSeparation(const DistanceProxy& proxy1, Transformation xf1,
 SeparationInfo GetMaxSeparation4x4(const DistanceProxy& proxy1, Transformation xf1,
                                    const DistanceProxy& proxy2, Transformation xf2);
 
+/// @brief Gets the max separation information for any number of vertices of the two
+///   given shapes.
+/// @details This generalizes <code>GetMaxSeparation4x4</code> to shapes of up to
+///   <code>MaxShapeVertices</code> vertices. It transforms the second shape's vertices
+///   into the first shape's frame as a structure of arrays and evaluates four of the
+///   first shape's normals at a time against each of those vertices in independent lanes
+///   that compilers can vectorize. Only the winning normal's vertex indices get searched for.
+/// @note This gives the same results as <code>GetMaxSeparation4x4</code> for two
+///   quadrilaterals.
+/// @param proxy1 First shape.
+/// @param xf1 Transformation of the first shape.
+/// @param proxy2 Second shape.
+/// @param xf2 Transformation of the second shape.
+/// @param stop Separation at which to stop searching; the information for the first
+///   normal with a greater separation is returned.
+/// @return Index of the vertex and normal from <code>proxy1</code>,
+///   index of the vertex from <code>proxy2</code> (that had the maximum separation
+///   distance from each other in the direction of that normal), and the maximal distance.
+SeparationInfo GetMaxSeparationNxM(const DistanceProxy& proxy1, Transformation xf1,
+                                   const DistanceProxy& proxy2, Transformation xf2,
+                                   Length stop = MaxFloat * Meter);
+
 /// @brief Gets the max separation information.
 /// @return Index of the vertex and normal from <code>proxy1</code>,
 ///   index of the vertex from <code>proxy2</code> (that had the maximum separation
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/Shape.hpp>
+#include <algorithm>
+#include <typeinfo>
+
+namespace playrho {
+namespace d2 {
+
+HeightFieldShapeConf::HeightFieldShapeConf() = default;
+
+HeightFieldShapeConf& HeightFieldShapeConf::Set(Positive<Length> cellWidth,
+                                                std::vector<Length> heights)
+{
+    if (size(heights) > MaxChildCount)
+    {
+        throw InvalidArgument("too many heights");
+    }
+    m_cellWidth = cellWidth;
+    Reset(std::move(heights));
+    return *this;
+}
+
+void HeightFieldShapeConf::Reset(std::vector<Length> heights)
+{
+    m_heights = std::move(heights);
+    const auto range = std::minmax_element(begin(m_heights), end(m_heights));
+    m_minHeight = (range.first != end(m_heights))? *range.first: 0_m;
+    m_maxHeight = (range.second != end(m_heights))? *range.second: 0_m;
+}
+
+HeightFieldShapeConf& HeightFieldShapeConf::Add(Length height)
+{
+    if (empty(m_heights))
+    {
+        m_minHeight = height;
+        m_maxHeight = height;
+    }
+    else
+    {
+        m_minHeight = std::min(m_minHeight, height);
+        m_maxHeight = std::max(m_maxHeight, height);
+    }
+    m_heights.push_back(height);
+    return *this;
+}
+
+HeightFieldShapeConf& HeightFieldShapeConf::Transform(const Mat22& m)
+{
+    const auto xAxis = m * Length2{Length{m_cellWidth}, 0_m};
+    const auto yAxis = m * Length2{0_m, 1_m};
+    if ((get<0>(xAxis) <= 0_m) || (get<1>(xAxis) != 0_m) || (get<0>(yAxis) != 0_m))
+    {
+        throw InvalidArgument("transformation must keep cells along the positive X axis");
+    }
+    auto heights = std::vector<Length>{};
+    heights.reserve(size(m_heights));
+    for (const auto& height: m_heights)
+    {
+        heights.push_back(get<1>(m * Length2{0_m, height}));
+    }
+    m_cellWidth = get<0>(xAxis);
+    m_origin = m * m_origin;
+    Reset(std::move(heights));
+    return *this;
+}
+
+MassData HeightFieldShapeConf::GetMassData() const noexcept
+{
+    const auto density = this->density;
+    const auto childCount = GetChildCount();
+    if ((density > 0_kgpm2) && (childCount > 0))
+    {
+        // XXX: This overcounts for the overlapping circle shapes like ChainShapeConf does.
+        auto mass = 0_kg;
+        auto I = RotInertia{0};
+        auto center = Length2{};
+        for (auto i = decltype(childCount){0}; i < childCount; ++i)
+        {
+            const auto massData = playrho::d2::GetMassData(vertexRadius, density,
+                                                           GetVertex(i), GetVertex(i + 1));
+            mass += Mass{massData.mass};
+            center += Real{Mass{massData.mass} / Kilogram} * massData.center;
+            I += RotInertia{massData.I};
+        }
+        if (mass > 0_kg)
+        {
+            center /= Real{mass / Kilogram};
+        }
+        return MassData{center, mass, I};
+    }
+    return MassData{};
+}
+
+DistanceProxy HeightFieldShapeConf::GetChild(ChildCounter index) const
+{
+    if (index >= GetChildCount())
+    {
+        throw InvalidArgument("index out of range");
+    }
+    return DistanceProxy{vertexRadius, GetVertex(index), GetVertex(index + 1)};
+}
+
+// Free functions...
+
+AABB GetChildAABB(const HeightFieldShapeConf& arg, ChildCounter index) noexcept
+{
+    assert(index < arg.GetChildCount());
+    const auto v0 = arg.GetVertex(index);
+    const auto v1 = arg.GetVertex(index + 1);
+    return GetFattenedAABB(AABB{v0, v1}, GetVertexRadius(arg));
+}
+
+AABB GetAABB(const HeightFieldShapeConf& arg) noexcept
+{
+    const auto count = arg.GetHeightCount();
+    if (count == 0)
+    {
+        return AABB{};
+    }
+    const auto origin = arg.GetOrigin();
+    const auto right = get<0>(arg.GetVertex(count - 1));
+    return GetFattenedAABB(AABB{LengthInterval{get<0>(origin), right},
+        LengthInterval{get<1>(origin) + arg.GetMinHeight(), get<1>(origin) + arg.GetMaxHeight()}},
+                           GetVertexRadius(arg));
+}
+
+std::pair<ChildCounter, ChildCounter> GetChildRange(const HeightFieldShapeConf& arg,
+                                                    const AABB& aabb) noexcept
+{
+    const auto childCount = arg.GetChildCount();
+    const auto r = Length{GetVertexRadius(arg)};
+    const auto origin = arg.GetOrigin();
+    const auto rangeX = LengthInterval{aabb.ranges[0]}.Move(-get<0>(origin));
+    const auto rangeY = LengthInterval{aabb.ranges[1]}.Move(-get<1>(origin));
+    if ((childCount == 0) ||
+        (rangeY.GetMax() < arg.GetMinHeight() - r) || (rangeY.GetMin() > arg.GetMaxHeight() + r))
+    {
+        return {0, 0};
+    }
+    
+    // Relative to the origin, child i spans from (i * cellWidth - r) to
+    // ((i + 1) * cellWidth + r) along X.
+    const auto cellWidth = Length{arg.GetCellWidth()};
+    const auto lo = Real{(rangeX.GetMin() - r) / cellWidth} - Real{1};
+    const auto hi = Real{(rangeX.GetMax() + r) / cellWidth};
+    if (!(hi >= Real{0}) || !(lo < static_cast<Real>(childCount)))
+    {
+        return {0, 0};
+    }
+    const auto first = (lo > Real{0})? static_cast<ChildCounter>(lo): ChildCounter{0};
+    const auto last = (hi < static_cast<Real>(childCount))?
+        static_cast<ChildCounter>(hi) + 1: childCount;
+    return {first, last};
+}
+
+const HeightFieldShapeConf* GetHeightFieldShapeConf(const Shape& shape)
+{
+    return (GetUseTypeInfo(shape) == typeid(HeightFieldShapeConf))?
+        static_cast<const HeightFieldShapeConf*>(GetData(shape)): nullptr;
+}
+
+} // namespace d2
+} // namespace playrho
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#ifndef PLAYRHO_COLLISION_SHAPES_HEIGHTFIELDSHAPECONF_HPP
+#define PLAYRHO_COLLISION_SHAPES_HEIGHTFIELDSHAPECONF_HPP
+
+#include <PlayRho/Common/Math.hpp>
+#include <PlayRho/Collision/Shapes/ShapeConf.hpp>
+#include <PlayRho/Collision/DistanceProxy.hpp>
+#include <PlayRho/Collision/MassData.hpp>
+#include <PlayRho/Collision/AABB.hpp>
+#include <utility>
+#include <vector>
+
+namespace playrho {
+namespace d2 {
+
+class Shape;
+
+/// @brief Height field shape configuration.
+///
+/// @details A height field shape is a terrain outline of evenly spaced height samples.
+///   Sample <code>i</code> is at the shape-local location
+///   <code>origin + (i * cellWidth, height[i])</code> and every "child" is the two-sided
+///   line segment between a sample and the next one. As the cells are evenly spaced, the
+///   children overlapping any given AABB are found by index arithmetic instead of by
+///   traversing a tree. Fixtures of height field shapes therefore always register just
+///   one broad-phase proxy and need no child tree.
+///
+/// @note The children are the same as those of a <code>ChainShapeConf</code> of the
+///   sample locations. Only the heights are stored though. The vertices and normals of
+///   the children are computed when they're asked for.
+///
+/// @ingroup PartsGroup
+///
+/// @sa ChainShapeConf, FixtureConf::singleProxy.
+///
+class HeightFieldShapeConf: public ShapeBuilder<HeightFieldShapeConf>
+{
+public:
+    /// @brief Gets the default vertex radius.
+    static PLAYRHO_CONSTEXPR inline NonNegative<Length> GetDefaultVertexRadius() noexcept
+    {
+        return NonNegative<Length>{DefaultLinearSlop * Real{2}};
+    }
+    
+    /// @brief Gets the default cell width.
+    static PLAYRHO_CONSTEXPR inline Positive<Length> GetDefaultCellWidth() noexcept
+    {
+        return Positive<Length>{Real{1} * Meter};
+    }
+
+    /// @brief Default constructor.
+    HeightFieldShapeConf();
+    
+    /// @brief Sets the configuration up for the given heights spaced the given width apart.
+    /// @throws InvalidArgument if given too many heights.
+    HeightFieldShapeConf& Set(Positive<Length> cellWidth, std::vector<Length> heights);
+    
+    /// @brief Adds a sample of the given height after the last one.
+    HeightFieldShapeConf& Add(Length height);
+    
+    /// @brief Uses the given location as the location of the first sample at height zero.
+    HeightFieldShapeConf& UseOrigin(Length2 value) noexcept;
+    
+    /// @brief Transforms all the samples by the given transformation matrix.
+    /// @note Only scaling and reflecting transformations keep the cells axis aligned.
+    /// @throws InvalidArgument if the transformation wouldn't keep the cells evenly spaced
+    ///   along the positive X axis.
+    /// @sa https://en.wikipedia.org/wiki/Transformation_matrix
+    HeightFieldShapeConf& Transform(const Mat22& m);
+
+    /// @brief Gets the "child" shape count.
+    ChildCounter GetChildCount() const noexcept
+    {
+        // cell count = sample count - 1
+        const auto count = GetHeightCount();
+        return (count > 1)? count - 1: 0;
+    }
+
+    /// @brief Gets the "child" shape at the given index.
+    /// @throws InvalidArgument if the index is not less than the child count.
+    DistanceProxy GetChild(ChildCounter index) const;
+    
+    /// @brief Gets the mass data.
+    MassData GetMassData() const noexcept;
+    
+    /// @brief Uses the given vertex radius.
+    HeightFieldShapeConf& UseVertexRadius(NonNegative<Length> value) noexcept;
+    
+    /// @brief Gets the cell width.
+    /// @details This is the distance along the X axis between consecutive samples.
+    Positive<Length> GetCellWidth() const noexcept
+    {
+        return m_cellWidth;
+    }
+    
+    /// @brief Gets the origin.
+    /// @details This is the shape-local location that the samples are relative to.
+    Length2 GetOrigin() const noexcept
+    {
+        return m_origin;
+    }
+    
+    /// @brief Gets the height sample count.
+    ChildCounter GetHeightCount() const noexcept
+    {
+        return static_cast<ChildCounter>(size(m_heights));
+    }
+    
+    /// @brief Gets the height of the sample at the given index.
+    /// @note This is relative to the origin.
+    Length GetHeight(ChildCounter index) const
+    {
+        assert(index < GetHeightCount());
+        return m_heights[index];
+    }
+    
+    /// @brief Gets the shape-local location of the sample at the given index.
+    Length2 GetVertex(ChildCounter index) const
+    {
+        assert(index < GetHeightCount());
+        return m_origin + Length2{Real(index) * Length{m_cellWidth}, m_heights[index]};
+    }
+    
+    /// @brief Gets the lowest height.
+    /// @note This is relative to the origin.
+    Length GetMinHeight() const noexcept
+    {
+        return m_minHeight;
+    }
+    
+    /// @brief Gets the highest height.
+    /// @note This is relative to the origin.
+    Length GetMaxHeight() const noexcept
+    {
+        return m_maxHeight;
+    }
+    
+    /// @brief Equality operator.
+    friend bool operator== (const HeightFieldShapeConf& lhs, const HeightFieldShapeConf& rhs) noexcept
+    {
+        return lhs.vertexRadius == rhs.vertexRadius && lhs.friction == rhs.friction
+            && lhs.restitution == rhs.restitution && lhs.density == rhs.density
+            && lhs.m_cellWidth == rhs.m_cellWidth && lhs.m_origin == rhs.m_origin
+            && lhs.m_heights == rhs.m_heights;
+    }
+    
+    /// @brief Inequality operator.
+    friend bool operator!= (const HeightFieldShapeConf& lhs, const HeightFieldShapeConf& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    
+    /// @brief Vertex radius.
+    /// @note This should be a non-negative value.
+    /// @sa ChainShapeConf::vertexRadius.
+    NonNegative<Length> vertexRadius = GetDefaultVertexRadius();
+
+private:
+    /// @brief Resets the heights and height range to the given heights.
+    void Reset(std::vector<Length> heights);
+
+    Positive<Length> m_cellWidth = GetDefaultCellWidth(); ///< Cell width.
+    Length2 m_origin = Length2{}; ///< Location the samples are relative to.
+    std::vector<Length> m_heights; ///< Heights of the samples.
+    Length m_minHeight = 0_m; ///< Lowest height.
+    Length m_maxHeight = 0_m; ///< Highest height.
+};
+
+inline HeightFieldShapeConf& HeightFieldShapeConf::UseVertexRadius(NonNegative<Length> value) noexcept
+{
+    vertexRadius = value;
+    return *this;
+}
+
+inline HeightFieldShapeConf& HeightFieldShapeConf::UseOrigin(Length2 value) noexcept
+{
+    m_origin = value;
+    return *this;
+}
+
+// Free functions...
+
+/// @brief Gets the child count for a given height field shape configuration.
+inline ChildCounter GetChildCount(const HeightFieldShapeConf& arg) noexcept
+{
+    return arg.GetChildCount();
+}
+
+/// @brief Gets the "child" shape for a given height field shape configuration.
+inline DistanceProxy GetChild(const HeightFieldShapeConf& arg, ChildCounter index)
+{
+    return arg.GetChild(index);
+}
+
+/// @brief Gets the mass data for a given height field shape configuration.
+inline MassData GetMassData(const HeightFieldShapeConf& arg) noexcept
+{
+    return arg.GetMassData();
+}
+
+/// @brief Gets the vertex radius of the given shape configuration.
+inline NonNegative<Length> GetVertexRadius(const HeightFieldShapeConf& arg)
+{
+    return arg.vertexRadius;
+}
+
+/// @brief Gets the vertex radius of the given shape configuration.
+inline NonNegative<Length> GetVertexRadius(const HeightFieldShapeConf& arg, ChildCounter)
+{
+    return GetVertexRadius(arg);
+}
+
+/// @brief Transforms the given height field shape configuration's samples by the given
+///   transformation matrix.
+/// @sa https://en.wikipedia.org/wiki/Transformation_matrix
+inline void Transform(HeightFieldShapeConf& arg, const Mat22& m)
+{
+    arg.Transform(m);
+}
+
+/// @brief Gets the shape-local AABB of the given child of the given height field.
+/// @note This includes the vertex radius.
+AABB GetChildAABB(const HeightFieldShapeConf& arg, ChildCounter index) noexcept;
+
+/// @brief Gets the shape-local AABB of the given height field.
+/// @note This includes the vertex radius and takes constant time.
+AABB GetAABB(const HeightFieldShapeConf& arg) noexcept;
+
+/// @brief Gets the range of the children of the given height field that may overlap the
+///   given shape-local AABB.
+/// @details This computes the range from the AABB's X range and the cell width in constant
+///   time. The range is empty if the AABB is entirely above or below all of the heights.
+///   Use <code>GetChildAABB</code> to filter out the children in the range that don't
+///   overlap the AABB.
+/// @return Index of the first child and one past the index of the last child.
+std::pair<ChildCounter, ChildCounter> GetChildRange(const HeightFieldShapeConf& arg,
+                                                    const AABB& aabb) noexcept;
+
+/// @brief Gets the height field shape configuration of the given shape.
+/// @return Non-null pointer to the shape's height field configuration if the shape is of
+///   one, <code>nullptr</code> otherwise.
+const HeightFieldShapeConf* GetHeightFieldShapeConf(const Shape& shape);
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_COLLISION_SHAPES_HEIGHTFIELDSHAPECONF_HPP
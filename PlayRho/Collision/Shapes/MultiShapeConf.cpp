@@ -21,11 +21,427 @@
 #include <PlayRho/Collision/Shapes/MultiShapeConf.hpp>
 #include <PlayRho/Common/VertexSet.hpp>
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <unordered_map>
 
 namespace playrho {
 namespace d2 {
 
+namespace {
+
+/// @brief Gets the normals for the given counter-clockwise ordered convex hull vertices.
+std::vector<UnitVec> GetNormals(const std::vector<Length2>& vertices)
+{
+    const auto count = static_cast<VertexCounter>(size(vertices));
+    auto normals = std::vector<UnitVec>();
+    if (count > 1)
+    {
+        // Compute normals.
+        normals.reserve(count);
+        for (auto i = decltype(count){0}; i < count; ++i)
+        {
+            const auto nextIndex = GetModuloNext(i, count);
+            const auto edge = vertices[nextIndex] - vertices[i];
+            normals.push_back(GetUnitVector(GetFwdPerpendicular(edge)));
+        }
+    }
+    else if (count == 1)
+    {
+        normals.push_back(UnitVec{});
+    }
+    return normals;
+}
+
+/// @brief Whether the turn at vertex b from a to c is a strictly counter-clockwise one.
+inline bool IsConvex(Length2 a, Length2 b, Length2 c) noexcept
+{
+    return Cross(b - a, c - b) > 0_m2;
+}
+
+/// @brief Whether point p is within or on the counter-clockwise triangle a, b, c.
+inline bool IsWithin(Length2 p, Length2 a, Length2 b, Length2 c) noexcept
+{
+    return (Cross(b - a, p - a) >= 0_m2) && (Cross(c - b, p - b) >= 0_m2)
+        && (Cross(a - c, p - c) >= 0_m2);
+}
+
+/// @brief Gets the sign of the turn at vertex b from a to c.
+/// @return 1 for a counter-clockwise turn, -1 for a clockwise one, or 0 if collinear.
+inline int GetTurn(Length2 a, Length2 b, Length2 c) noexcept
+{
+    const auto cross = Cross(b - a, c - b);
+    return (cross > 0_m2)? 1: (cross < 0_m2)? -1: 0;
+}
+
+/// @brief Whether point p, that's collinear with the segment a-b, is on that segment.
+inline bool IsOnSegment(Length2 p, Length2 a, Length2 b) noexcept
+{
+    return (std::min(GetX(a), GetX(b)) <= GetX(p)) && (GetX(p) <= std::max(GetX(a), GetX(b)))
+        && (std::min(GetY(a), GetY(b)) <= GetY(p)) && (GetY(p) <= std::max(GetY(a), GetY(b)));
+}
+
+/// @brief Whether the segments a-b and c-d cross or touch each other.
+inline bool IsIntersecting(Length2 a, Length2 b, Length2 c, Length2 d) noexcept
+{
+    const auto abc = GetTurn(a, b, c);
+    const auto abd = GetTurn(a, b, d);
+    const auto cda = GetTurn(c, d, a);
+    const auto cdb = GetTurn(c, d, b);
+    if ((abc != abd) && (cda != cdb))
+    {
+        return true;
+    }
+    return ((abc == 0) && IsOnSegment(c, a, b)) || ((abd == 0) && IsOnSegment(d, a, b))
+        || ((cda == 0) && IsOnSegment(a, c, d)) || ((cdb == 0) && IsOnSegment(b, c, d));
+}
+
+/// @brief Edge span.
+/// @details Ranges of coordinates that an edge of a polygon spans.
+struct EdgeSpan
+{
+    Length minX; ///< Least x-coordinate of the edge.
+    Length maxX; ///< Greatest x-coordinate of the edge.
+    Length minY; ///< Least y-coordinate of the edge.
+    Length maxY; ///< Greatest y-coordinate of the edge.
+    std::size_t index; ///< Index of the edge's first vertex.
+};
+
+/// @brief Whether any two non-adjacent edges of the given closed polygon cross or touch.
+/// @details Sweeps over the edges in the order of their least x-coordinates so only
+///   edges whose coordinate ranges overlap get tested against each other.
+/// @param vertices Vertices of the polygon.
+/// @param spans Scratch storage for the spans of the edges.
+bool IsSelfIntersecting(const std::vector<Length2>& vertices, std::vector<EdgeSpan>& spans)
+{
+    const auto count = size(vertices);
+    spans.clear();
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto v0 = vertices[i];
+        const auto v1 = vertices[(i + 1) % count];
+        spans.push_back(EdgeSpan{
+            std::min(GetX(v0), GetX(v1)), std::max(GetX(v0), GetX(v1)),
+            std::min(GetY(v0), GetY(v1)), std::max(GetY(v0), GetY(v1)), i
+        });
+    }
+    std::sort(begin(spans), end(spans), [](const EdgeSpan& lhs, const EdgeSpan& rhs) {
+        return lhs.minX < rhs.minX;
+    });
+    for (auto k = std::size_t{0}; k < count; ++k)
+    {
+        const auto i = spans[k].index;
+        for (auto l = k + 1; (l < count) && (spans[l].minX <= spans[k].maxX); ++l)
+        {
+            const auto j = spans[l].index;
+            if ((spans[l].minY > spans[k].maxY) || (spans[k].minY > spans[l].maxY))
+            {
+                continue;
+            }
+            // Adjacent edges share a vertex so they're skipped.
+            if ((j == (i + 1) % count) || (i == (j + 1) % count))
+            {
+                continue;
+            }
+            if (IsIntersecting(vertices[i], vertices[(i + 1) % count],
+                               vertices[j], vertices[(j + 1) % count]))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// @brief Convex decomposer.
+/// @details Decomposes simple polygons into convex pieces using working storage that's
+///   reused from one polygon to the next.
+class ConvexDecomposer
+{
+public:
+    /// @brief Appends the convex hulls of the given polygon's decomposition to the given
+    ///   container.
+    void Decompose(Span<const Length2> polygon, NonNegative<Length> vertexRadius,
+                   VertexCounter maxVertices, std::vector<ConvexHull>& hulls);
+
+private:
+    using Index = std::uint32_t; ///< Vertex index type.
+    using Piece = std::vector<Index>; ///< Counter-clockwise indices of a convex piece.
+
+    /// @brief Loads the given polygon as counter-clockwise ordered vertices.
+    /// @throws InvalidArgument if the polygon has no area or any of its edges cross or
+    ///   touch each other.
+    void Load(Span<const Length2> polygon);
+
+    /// @brief Triangulates the loaded polygon through ear clipping.
+    void Triangulate();
+
+    /// @brief Merges the pieces across their shared edges while they stay convex.
+    void Merge(std::size_t maxVertices);
+
+    /// @brief Whether the ear at the given vertex index has no other vertex within it.
+    bool IsEmptyEar(Index p, Index i, Index q) const noexcept;
+
+    /// @brief Adds a piece for the given triangle.
+    void AddTriangle(Index a, Index b, Index c);
+
+    /// @brief Gets the key for the directed edge from a to b.
+    static std::uint64_t GetKey(Index a, Index b) noexcept
+    {
+        return (std::uint64_t{a} << 32u) | b;
+    }
+
+    std::vector<Length2> m_vertices; ///< Vertices of the loaded polygon.
+    std::vector<Index> m_prev; ///< Previous remaining vertex per vertex.
+    std::vector<Index> m_next; ///< Next remaining vertex per vertex.
+    std::vector<Piece> m_pieces; ///< Pieces. Merged away ones are empty.
+    std::size_t m_pieceCount = 0; ///< Count of pieces in use.
+    std::unordered_map<std::uint64_t, std::size_t> m_owners; ///< Piece per directed edge.
+    Piece m_merged; ///< Scratch piece for merging.
+    std::vector<Length2> m_hull; ///< Scratch vertices for making a hull.
+    std::vector<EdgeSpan> m_spans; ///< Scratch edge spans for the simplicity check.
+};
+
+void ConvexDecomposer::Decompose(Span<const Length2> polygon, NonNegative<Length> vertexRadius,
+                                 VertexCounter maxVertices, std::vector<ConvexHull>& hulls)
+{
+    if (maxVertices < 3)
+    {
+        throw InvalidArgument("ConvexDecomposer::Decompose: max vertices < 3");
+    }
+    Load(polygon);
+    Triangulate();
+    Merge(maxVertices);
+    for (auto k = std::size_t{0}; k < m_pieceCount; ++k)
+    {
+        const auto& piece = m_pieces[k];
+        if (!empty(piece))
+        {
+            m_hull.clear();
+            for (const auto index: piece)
+            {
+                m_hull.push_back(m_vertices[index]);
+            }
+            hulls.push_back(ConvexHull::GetFromConvex(m_hull, vertexRadius));
+        }
+    }
+}
+
+void ConvexDecomposer::Load(Span<const Length2> polygon)
+{
+    m_vertices.clear();
+    for (const auto& v: polygon)
+    {
+        if (empty(m_vertices) || (m_vertices.back() != v))
+        {
+            m_vertices.push_back(v);
+        }
+    }
+    while ((size(m_vertices) > 1) && (m_vertices.back() == m_vertices.front()))
+    {
+        m_vertices.pop_back();
+    }
+    // Collinear vertices don't change the polygon but would keep pieces from merging.
+    for (auto removed = true; removed && (size(m_vertices) > 2);)
+    {
+        removed = false;
+        for (auto i = std::size_t{0}; i < size(m_vertices);)
+        {
+            const auto n = size(m_vertices);
+            const auto prev = m_vertices[(i + n - 1) % n];
+            const auto next = m_vertices[(i + 1) % n];
+            if (Cross(m_vertices[i] - prev, next - m_vertices[i]) == 0_m2)
+            {
+                m_vertices.erase(begin(m_vertices) + static_cast<std::ptrdiff_t>(i));
+                removed = true;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+    if (size(m_vertices) >= std::numeric_limits<Index>::max())
+    {
+        throw InvalidArgument("ConvexDecomposer::Load: too many vertices");
+    }
+    const auto count = size(m_vertices);
+    auto area = 0_m2;
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        area += Cross(m_vertices[i], m_vertices[(i + 1) % count]);
+    }
+    if (!(area != 0_m2))
+    {
+        throw InvalidArgument("ConvexDecomposer::Load: polygon has no area");
+    }
+    if (IsSelfIntersecting(m_vertices, m_spans))
+    {
+        throw InvalidArgument("ConvexDecomposer::Load: polygon isn't simple");
+    }
+    if (area < 0_m2)
+    {
+        std::reverse(begin(m_vertices), end(m_vertices));
+    }
+}
+
+bool ConvexDecomposer::IsEmptyEar(Index p, Index i, Index q) const noexcept
+{
+    const auto a = m_vertices[p];
+    const auto b = m_vertices[i];
+    const auto c = m_vertices[q];
+    for (auto r = m_next[q]; r != p; r = m_next[r])
+    {
+        // Only reflex vertices can be within a convex vertex's ear without an edge crossing.
+        const auto v = m_vertices[r];
+        if (!IsConvex(m_vertices[m_prev[r]], v, m_vertices[m_next[r]]) && IsWithin(v, a, b, c))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ConvexDecomposer::AddTriangle(Index a, Index b, Index c)
+{
+    if (m_pieceCount == size(m_pieces))
+    {
+        m_pieces.emplace_back();
+    }
+    auto& piece = m_pieces[m_pieceCount];
+    piece.clear();
+    piece.push_back(a);
+    piece.push_back(b);
+    piece.push_back(c);
+    ++m_pieceCount;
+}
+
+void ConvexDecomposer::Triangulate()
+{
+    const auto count = static_cast<Index>(size(m_vertices));
+    m_prev.resize(count);
+    m_next.resize(count);
+    for (auto i = Index{0}; i < count; ++i)
+    {
+        m_prev[i] = (i > 0)? i - 1: count - 1;
+        m_next[i] = (i + 1 < count)? i + 1: 0;
+    }
+    m_pieceCount = 0;
+
+    auto remaining = count;
+    auto i = Index{0};
+    auto misses = Index{0};
+    while (remaining > 3)
+    {
+        const auto p = m_prev[i];
+        const auto q = m_next[i];
+        const auto turn = Cross(m_vertices[i] - m_vertices[p], m_vertices[q] - m_vertices[i]);
+        const auto clip = (turn == 0_m2) || ((turn > 0_m2) && IsEmptyEar(p, i, q));
+        if (clip)
+        {
+            // Collinear vertices are dropped without adding a triangle.
+            if (turn != 0_m2)
+            {
+                AddTriangle(p, i, q);
+            }
+            m_next[p] = q;
+            m_prev[q] = p;
+            --remaining;
+            misses = 0;
+        }
+        else if (++misses > remaining)
+        {
+            throw InvalidArgument("ConvexDecomposer::Triangulate: polygon isn't simple");
+        }
+        i = q;
+    }
+    const auto p = m_prev[i];
+    const auto q = m_next[i];
+    if (IsConvex(m_vertices[p], m_vertices[i], m_vertices[q]))
+    {
+        AddTriangle(p, i, q);
+    }
+    if (m_pieceCount == 0)
+    {
+        throw InvalidArgument("ConvexDecomposer::Triangulate: polygon has no area");
+    }
+}
+
+void ConvexDecomposer::Merge(std::size_t maxVertices)
+{
+    m_owners.clear();
+    for (auto k = std::size_t{0}; k < m_pieceCount; ++k)
+    {
+        const auto& piece = m_pieces[k];
+        for (auto j = std::size_t{0}; j < 3; ++j)
+        {
+            m_owners[GetKey(piece[j], piece[(j + 1) % 3])] = k;
+        }
+    }
+
+    for (auto k = std::size_t{0}; k < m_pieceCount; ++k)
+    {
+        auto merged = !empty(m_pieces[k]);
+        while (merged)
+        {
+            merged = false;
+            auto& piece = m_pieces[k];
+            const auto n = size(piece);
+            for (auto j = std::size_t{0}; j < n; ++j)
+            {
+                const auto a = piece[j];
+                const auto b = piece[(j + 1) % n];
+                const auto found = m_owners.find(GetKey(b, a));
+                if ((found == end(m_owners)) || (found->second == k))
+                {
+                    continue;
+                }
+                auto& other = m_pieces[found->second];
+                const auto m = size(other);
+                if (n + m - 2 > maxVertices)
+                {
+                    continue;
+                }
+                const auto pos = static_cast<std::size_t>(std::find(begin(other), end(other), b)
+                                                          - begin(other));
+                assert(other[(pos + 1) % m] == a);
+
+                // Removing the shared edge leaves the other vertices' turns unchanged.
+                const auto& v = m_vertices;
+                if (!IsConvex(v[piece[(j + n - 1) % n]], v[a], v[other[(pos + 2) % m]]) ||
+                    !IsConvex(v[other[(pos + m - 1) % m]], v[b], v[piece[(j + 2) % n]]))
+                {
+                    continue;
+                }
+
+                // Merged piece goes from b around this piece to a, then around the other.
+                m_merged.clear();
+                for (auto t = std::size_t{0}; t < n; ++t)
+                {
+                    m_merged.push_back(piece[(j + 1 + t) % n]);
+                }
+                for (auto t = std::size_t{2}; t < m; ++t)
+                {
+                    m_merged.push_back(other[(pos + t) % m]);
+                }
+                for (auto t = std::size_t{0}; t < m; ++t)
+                {
+                    m_owners[GetKey(other[t], other[(t + 1) % m])] = k;
+                }
+                m_owners.erase(GetKey(a, b));
+                m_owners.erase(GetKey(b, a));
+                other.clear();
+                piece.swap(m_merged);
+                merged = true;
+                break;
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
 /// Computes the mass properties of this shape using its dimensions and density.
 /// The inertia tensor is computed about the local origin.
 /// @return Mass data for this shape.
@@ -56,27 +472,18 @@ ConvexHull ConvexHull::Get(const VertexSet& pointSet, NonNegative<Length> vertex
     auto vertices = GetConvexHullAsVector(pointSet);
     assert(!empty(vertices) && size(vertices) < std::numeric_limits<VertexCounter>::max());
     
-    const auto count = static_cast<VertexCounter>(size(vertices));
-    
-    auto normals = std::vector<UnitVec>();
-    if (count > 1)
-    {
-        // Compute normals.
-        for (auto i = decltype(count){0}; i < count; ++i)
-        {
-            const auto nextIndex = GetModuloNext(i, count);
-            const auto edge = vertices[nextIndex] - vertices[i];
-            normals.push_back(GetUnitVector(GetFwdPerpendicular(edge)));
-        }
-    }
-    else if (count == 1)
-    {
-        normals.push_back(UnitVec{});
-    }
-    
+    auto normals = GetNormals(vertices);
     return ConvexHull{vertices, normals, vertexRadius};
 }
 
+ConvexHull ConvexHull::GetFromConvex(Span<const Length2> vertices, NonNegative<Length> vertexRadius)
+{
+    assert(!vertices.empty() && vertices.size() < std::numeric_limits<VertexCounter>::max());
+    auto verts = std::vector<Length2>(begin(vertices), end(vertices));
+    auto normals = GetNormals(verts);
+    return ConvexHull{verts, normals, vertexRadius};
+}
+
 ConvexHull& ConvexHull::Transform(const Mat22& m) noexcept
 {
     auto newPoints = VertexSet{};
@@ -96,6 +503,15 @@ MultiShapeConf& MultiShapeConf::AddConvexHull(const VertexSet& pointSet,
     return *this;
 }
 
+MultiShapeConf& MultiShapeConf::AddConvexDecomposition(Span<const Length2> polygon,
+                                                       NonNegative<Length> vertexRadius,
+                                                       VertexCounter maxVertices)
+{
+    auto decomposer = ConvexDecomposer{};
+    decomposer.Decompose(polygon, vertexRadius, maxVertices, children);
+    return *this;
+}
+
 MultiShapeConf& MultiShapeConf::Transform(const Mat22& m) noexcept
 {
     std::for_each(begin(children), end(children), [=](ConvexHull& child){
@@ -104,5 +520,21 @@ MultiShapeConf& MultiShapeConf::Transform(const Mat22& m) noexcept
     return *this;
 }
 
+std::vector<MultiShapeConf>
+GetConvexDecompositions(const MultiShapeConf& prototype,
+                        Span<const std::vector<Length2>> polygons,
+                        NonNegative<Length> vertexRadius, VertexCounter maxVertices)
+{
+    auto decomposer = ConvexDecomposer{};
+    auto confs = std::vector<MultiShapeConf>{};
+    confs.reserve(polygons.size());
+    for (const auto& polygon: polygons)
+    {
+        confs.push_back(prototype);
+        decomposer.Decompose(polygon, vertexRadius, maxVertices, confs.back().children);
+    }
+    return confs;
+}
+
 } // namespace d2
 } // namespace playrho
@@ -25,6 +25,7 @@
 #include <PlayRho/Collision/Shapes/ShapeConf.hpp>
 #include <PlayRho/Collision/DistanceProxy.hpp>
 #include <PlayRho/Collision/MassData.hpp>
+#include <PlayRho/Common/Span.hpp>
 #include <vector>
 
 namespace playrho {
@@ -41,6 +42,14 @@ public:
     static ConvexHull Get(const VertexSet& pointSet, NonNegative<Length> vertexRadius =
                           NonNegative<Length>{DefaultLinearSlop * Real{2}});
     
+    /// @brief Gets the convex hull for the given vertices of a convex polygon.
+    /// @details This is a faster alternative to the other <code>Get</code> method for
+    ///   vertices already known to be those of a convex hull. No hull gets calculated.
+    /// @warning Behavior is undefined if the given vertices are not those of a convex
+    ///   polygon given in counter-clockwise order without duplicates.
+    static ConvexHull GetFromConvex(Span<const Length2> vertices, NonNegative<Length> vertexRadius =
+                                    NonNegative<Length>{DefaultLinearSlop * Real{2}});
+    
     /// @brief Gets the distance proxy for this convex hull.
     DistanceProxy GetDistanceProxy() const
     {
@@ -136,6 +145,30 @@ struct MultiShapeConf: public ShapeBuilder<MultiShapeConf>
     MultiShapeConf& AddConvexHull(const VertexSet& pointSet, NonNegative<Length> vertexRadius =
                                   GetDefaultVertexRadius()) noexcept;
     
+    /// @brief Adds convex hulls that together make up the given simple polygon.
+    ///
+    /// @details Decomposes the polygon into convex pieces by triangulating it through
+    ///   ear clipping and then merging triangles across their shared diagonals for as
+    ///   long as the merged pieces stay convex (the Hertel-Mehlhorn algorithm). Without
+    ///   a limiting max vertices, this produces no more than four times the minimum number
+    ///   of pieces. It typically runs in time quadratic in the number of vertices.
+    ///
+    /// @param polygon Vertices of a simple (non-self-intersecting) polygon, concave or
+    ///   convex, in clockwise or counter-clockwise order.
+    /// @param vertexRadius Vertex radius for the added hulls.
+    /// @param maxVertices Maximum number of vertices per added hull.
+    ///
+    /// @note Collinear and repeated consecutive vertices are removed.
+    /// @throws InvalidArgument if the polygon has no area, the polygon isn't simple, or
+    ///   the max vertices is less than three.
+    /// @throws std::bad_alloc if there's a failure allocating storage.
+    ///
+    /// @sa GetConvexDecompositions
+    ///
+    MultiShapeConf& AddConvexDecomposition(Span<const Length2> polygon,
+                                           NonNegative<Length> vertexRadius = GetDefaultVertexRadius(),
+                                           VertexCounter maxVertices = MaxShapeVertices);
+    
     /// @brief Transforms the vertices of all the children by the given transformation matrix.
     /// @sa https://en.wikipedia.org/wiki/Transformation_matrix
     MultiShapeConf& Transform(const Mat22& m) noexcept;
@@ -158,6 +191,25 @@ inline bool operator!= (const MultiShapeConf& lhs, const MultiShapeConf& rhs) no
     return !(lhs == rhs);
 }
 
+/// @brief Gets the convex decompositions of the given polygons.
+/// @details Batch form of <code>MultiShapeConf::AddConvexDecomposition</code> that reuses
+///   its working storage from one polygon to the next.
+/// @param prototype Configuration whose friction, restitution, density and any children
+///   every result starts from.
+/// @param polygons Vertices of the simple polygons to decompose.
+/// @param vertexRadius Vertex radius for the hulls.
+/// @param maxVertices Maximum number of vertices per hull.
+/// @return Configuration per given polygon in the same order as the polygons.
+/// @throws InvalidArgument if any of the polygons has no area or isn't simple, or if the
+///   max vertices is less than three.
+/// @throws std::bad_alloc if there's a failure allocating storage.
+/// @relatedalso MultiShapeConf
+std::vector<MultiShapeConf>
+GetConvexDecompositions(const MultiShapeConf& prototype,
+                        Span<const std::vector<Length2>> polygons,
+                        NonNegative<Length> vertexRadius = MultiShapeConf::GetDefaultVertexRadius(),
+                        VertexCounter maxVertices = MaxShapeVertices);
+
 /// @brief Gets the "child" count for the given shape configuration.
 inline ChildCounter GetChildCount(const MultiShapeConf& arg) noexcept
 {
@@ -189,5 +189,44 @@ bool Validate(Span<const Length2> verts)
     return true;
 }
 
+std::pair<PolygonShapeConf, PolygonShapeConf> Slice(const PolygonShapeConf& shape,
+                                                    Length2 point, UnitVec normal)
+{
+    const auto count = shape.GetVertexCount();
+    auto back = std::vector<Length2>{};
+    auto front = std::vector<Length2>{};
+    back.reserve(count + 1u);
+    front.reserve(count + 1u);
+    for (auto i = VertexCounter{0}; i < count; ++i)
+    {
+        // Sutherland-Hodgman clipping against both half-planes at once.
+        const auto v0 = shape.GetVertex(i);
+        const auto v1 = shape.GetVertex(GetModuloNext(i, count));
+        const auto d0 = Dot(v0 - point, normal);
+        const auto d1 = Dot(v1 - point, normal);
+        if (d0 <= 0_m)
+        {
+            back.push_back(v0);
+        }
+        if (d0 >= 0_m)
+        {
+            front.push_back(v0);
+        }
+        if (((d0 < 0_m) && (d1 > 0_m)) || ((d0 > 0_m) && (d1 < 0_m)))
+        {
+            const auto v = v0 + (v1 - v0) * Real{d0 / (d0 - d1)};
+            back.push_back(v);
+            front.push_back(v);
+        }
+    }
+    
+    auto result = std::make_pair(shape, shape);
+    const auto backCount = size(back);
+    const auto frontCount = size(front);
+    result.first.Set(Span<const Length2>(data(back), (backCount > 2)? backCount: 0));
+    result.second.Set(Span<const Length2>(data(front), (frontCount > 2)? frontCount: 0));
+    return result;
+}
+
 } // namespace d2
 } // namespace playrho
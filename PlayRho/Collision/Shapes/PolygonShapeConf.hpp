@@ -26,6 +26,7 @@
 #include <PlayRho/Collision/MassData.hpp>
 #include <PlayRho/Common/VertexSet.hpp>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace playrho {
@@ -252,6 +253,20 @@ inline void Transform(PolygonShapeConf& arg, const Mat22& m) noexcept
 ///   <code>false</code> otherwise.
 bool Validate(const Span<const Length2> verts);
 
+/// @brief Slices the given polygon configuration along the given line.
+/// @details Clips the polygon against the half-planes on either side of the line through
+///   the given point having the given normal. Both pieces keep the other settings of
+///   the given configuration.
+/// @param shape Polygon configuration to slice.
+/// @param point Point on the slicing line in the shape's coordinate space.
+/// @param normal Normal of the slicing line.
+/// @return Pair of the piece behind the line and the piece in front of it (on the side
+///   the normal points to). If the line doesn't cut through the polygon, or only cuts
+///   off a sliver thinner than the linear slop, one of these has less than three vertices.
+/// @relatedalso PolygonShapeConf
+std::pair<PolygonShapeConf, PolygonShapeConf> Slice(const PolygonShapeConf& shape,
+                                                    Length2 point, UnitVec normal);
+
 } // namespace d2
 } // namespace playrho
 
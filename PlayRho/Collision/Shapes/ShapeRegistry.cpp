@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include <PlayRho/Collision/Shapes/ShapeRegistry.hpp>
+#include <functional>
+#include <typeindex>
+
+namespace playrho {
+namespace d2 {
+
+namespace {
+
+inline std::size_t Combine(std::size_t seed, std::size_t value) noexcept
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline std::size_t HashOf(Real value) noexcept
+{
+    return std::hash<double>{}(static_cast<double>(value));
+}
+
+} // anonymous namespace
+
+Shape ShapeRegistry::Intern(const Shape& shape)
+{
+    const auto found = m_entries.find(GetData(shape));
+    if (found != end(m_entries))
+    {
+        ++(found->second.useCount);
+        return found->second.shape;
+    }
+    const auto hash = GetHash(shape);
+    const auto range = m_hashes.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto& entry = m_entries.at(it->second);
+        if (entry.shape == shape)
+        {
+            ++(entry.useCount);
+            return entry.shape;
+        }
+    }
+
+    auto entry = Entry{shape, GetMassData(shape), AABB{}, {}, 1u};
+    const auto childCount = GetChildCount(shape);
+    entry.children.reserve(childCount);
+    for (auto i = decltype(childCount){0}; i < childCount; ++i)
+    {
+        const auto child = GetChild(shape, i);
+        entry.children.push_back(child);
+        Include(entry.aabb, ComputeAABB(child, Transform_identity));
+    }
+    const auto key = GetData(shape);
+    const auto it = m_hashes.emplace(hash, key);
+    try
+    {
+        m_entries.emplace(key, std::move(entry));
+    }
+    catch (...)
+    {
+        m_hashes.erase(it);
+        throw;
+    }
+    return shape;
+}
+
+bool ShapeRegistry::Release(const Shape& shape) noexcept
+{
+    const auto key = GetData(shape);
+    const auto found = m_entries.find(key);
+    if (found == end(m_entries))
+    {
+        return false;
+    }
+    if (--(found->second.useCount) == 0)
+    {
+        const auto range = m_hashes.equal_range(GetHash(shape));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == key)
+            {
+                m_hashes.erase(it);
+                break;
+            }
+        }
+        m_entries.erase(found);
+    }
+    return true;
+}
+
+const ShapeRegistry::Entry* ShapeRegistry::Find(const Shape& shape) const noexcept
+{
+    const auto found = m_entries.find(GetData(shape));
+    return (found != end(m_entries))? &(found->second): nullptr;
+}
+
+void ShapeRegistry::Clear() noexcept
+{
+    m_hashes.clear();
+    m_entries.clear();
+}
+
+// Free functions...
+
+std::size_t GetHash(const Shape& shape) noexcept
+{
+    auto hash = std::type_index(GetUseTypeInfo(shape)).hash_code();
+    const auto childCount = GetChildCount(shape);
+    hash = Combine(hash, childCount);
+    hash = Combine(hash, HashOf(Real{GetDensity(shape) * SquareMeter / Kilogram}));
+    hash = Combine(hash, HashOf(GetFriction(shape)));
+    hash = Combine(hash, HashOf(GetRestitution(shape)));
+    if (childCount > 0)
+    {
+        const auto child = GetChild(shape, 0);
+        hash = Combine(hash, HashOf(Real{child.GetVertexRadius() / Meter}));
+        hash = Combine(hash, child.GetVertexCount());
+        if (child.GetVertexCount() > 0)
+        {
+            const auto vertex = child.GetVertex(0);
+            hash = Combine(hash, HashOf(Real{get<0>(vertex) / Meter}));
+            hash = Combine(hash, HashOf(Real{get<1>(vertex) / Meter}));
+        }
+    }
+    return hash;
+}
+
+MassData GetMassData(const ShapeRegistry& registry, const Shape& shape) noexcept
+{
+    const auto entry = registry.Find(shape);
+    return entry? entry->massData: GetMassData(shape);
+}
+
+Span<const DistanceProxy> GetChildren(const ShapeRegistry& registry, const Shape& shape) noexcept
+{
+    const auto entry = registry.Find(shape);
+    return entry? Span<const DistanceProxy>(entry->children): Span<const DistanceProxy>{};
+}
+
+} // namespace d2
+} // namespace playrho
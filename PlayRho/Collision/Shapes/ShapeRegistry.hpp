@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#ifndef PLAYRHO_COLLISION_SHAPES_SHAPEREGISTRY_HPP
+#define PLAYRHO_COLLISION_SHAPES_SHAPEREGISTRY_HPP
+
+#include <PlayRho/Collision/Shapes/Shape.hpp>
+#include <PlayRho/Collision/AABB.hpp>
+#include <PlayRho/Collision/MassData.hpp>
+#include <PlayRho/Collision/DistanceProxy.hpp>
+#include <PlayRho/Common/Span.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace playrho {
+namespace d2 {
+
+/// @brief Shape registry.
+///
+/// @details Interns shapes so that equal shapes share one underlying shape configuration
+///   instance and caches the properties of each such instance that are otherwise
+///   recalculated for every fixture made from it. This is meant for the common case of
+///   creating many fixtures from a small number of prototype shapes.
+///
+/// @note Shapes are equal if their underlying configurations compare equal.
+///
+/// @sa World::GetShapeRegistry, WorldConf::UseShapeInterning
+///
+class ShapeRegistry
+{
+public:
+    /// @brief Registration entry.
+    struct Entry
+    {
+        Shape shape; ///< Interned shape.
+        MassData massData; ///< Mass data of the shape.
+        AABB aabb; ///< Shape-local AABB enclosing all of the shape's children.
+        std::vector<DistanceProxy> children; ///< Child proxies of the shape.
+        std::size_t useCount = 0; ///< Count of outstanding interns of the shape.
+    };
+
+    /// @brief Interns the given shape.
+    /// @details Registers the given shape if no equal shape is already registered and
+    ///   increments the use count of the registered shape.
+    /// @return Registered shape that's equal to the given one. This shares its underlying
+    ///   configuration with the given shape only if that was what got registered.
+    /// @throws std::bad_alloc if there's a failure allocating storage.
+    /// @sa Release.
+    Shape Intern(const Shape& shape);
+
+    /// @brief Releases the given interned shape.
+    /// @details Decrements the use count of the given shape's entry and unregisters the
+    ///   shape when its count reaches zero.
+    /// @return <code>true</code> if the given shape was registered, <code>false</code>
+    ///   otherwise.
+    bool Release(const Shape& shape) noexcept;
+
+    /// @brief Finds the entry for the given shape.
+    /// @note This is a constant time lookup by the shape's underlying configuration
+    ///   instance. It doesn't find shapes that are equal but weren't interned.
+    /// @return Non-null pointer to the entry if the shape was interned, else
+    ///   <code>nullptr</code>.
+    const Entry* Find(const Shape& shape) const noexcept;
+
+    /// @brief Gets the number of registered shapes.
+    std::size_t GetSize() const noexcept { return size(m_entries); }
+
+    /// @brief Unregisters all shapes.
+    void Clear() noexcept;
+
+private:
+    /// @brief Entries by the address of their shape's underlying configuration.
+    std::unordered_map<const void*, Entry> m_entries;
+
+    /// @brief Addresses of registered shapes' underlying configurations by shape hash.
+    std::unordered_multimap<std::size_t, const void*> m_hashes;
+};
+
+/// @brief Gets a hash of the given shape.
+/// @details Hash of the shape's type, child count, vertex radius, density, friction,
+///   restitution and first vertex. Equal shapes have equal hashes.
+/// @relatedalso Shape
+std::size_t GetHash(const Shape& shape) noexcept;
+
+/// @brief Gets the mass data of the given shape.
+/// @return Cached mass data if the shape was interned in the given registry, else the
+///   mass data calculated for the shape.
+/// @relatedalso ShapeRegistry
+MassData GetMassData(const ShapeRegistry& registry, const Shape& shape) noexcept;
+
+/// @brief Gets the child proxies of the given shape.
+/// @return Cached child proxies if the shape was interned in the given registry, else
+///   an empty span.
+/// @relatedalso ShapeRegistry
+Span<const DistanceProxy> GetChildren(const ShapeRegistry& registry, const Shape& shape) noexcept;
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_COLLISION_SHAPES_SHAPEREGISTRY_HPP
@@ -547,6 +547,20 @@ namespace playrho {
             return (m_value >= 0)? +1: -1;
         }
 
+        /// @brief Gets this value's internal representation.
+        /// @sa FromBits.
+        PLAYRHO_CONSTEXPR inline value_type GetBits() const noexcept
+        {
+            return m_value;
+        }
+
+        /// @brief Gets the value having the given internal representation.
+        /// @sa GetBits.
+        static PLAYRHO_CONSTEXPR inline Fixed FromBits(value_type bits) noexcept
+        {
+            return Fixed{bits, scalar_type{1}};
+        }
+
     private:
         
         /// @brief Widened type alias.
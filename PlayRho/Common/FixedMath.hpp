@@ -22,7 +22,12 @@
 #define PLAYRHO_COMMON_FIXEDMATH_HPP
 
 #include <PlayRho/Common/Fixed.hpp>
+#include <PlayRho/Common/Wider.hpp>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace playrho {
 
@@ -112,227 +117,326 @@ namespace detail {
 template <typename BT, unsigned int FB>
 constexpr const auto FixedPi = Fixed<BT, FB>{3.14159265358979323846264338327950288};
 
-/// @brief Computes the factorial.
-constexpr inline auto factorial(std::int64_t n)
+/// @brief Number of fraction bits of the intermediate values of the kernels.
+/// @details The transcendental kernels do all of their work on 64-bit integers in the
+///   <code>Q33.30</code> format and only round to the fixed type's format at the end.
+///   This keeps their results bit-identical on every platform.
+constexpr const auto KernelFractionBits = 30u;
+
+/// @brief One in the kernels' intermediate format.
+constexpr const auto KernelOne = std::int64_t{1} << KernelFractionBits;
+
+/// @brief Pi divided by two in the kernels' intermediate format.
+constexpr const auto KernelHalfPi = std::int64_t{1686629713};
+
+/// @brief Pi in the kernels' intermediate format.
+constexpr const auto KernelPi = std::int64_t{3373259426};
+
+/// @brief Natural logarithm of two in the kernels' intermediate format.
+constexpr const auto KernelLn2 = std::int64_t{744261118};
+
+/// @brief Square root of two in the kernels' intermediate format.
+constexpr const auto KernelSqrt2 = std::int64_t{1518500250};
+
+/// @brief Reciprocals of the integers.
+/// @details Element <code>i</code> is <code>1 / i</code> in the kernels' format. These
+///   are the polynomial coefficients multiplied by instead of dividing by integers.
+constexpr const std::int64_t Reciprocals[14] = {
+    0, 1073741824, 536870912, 357913941, 268435456, 214748365, 178956971, 153391689,
+    134217728, 119304647, 107374182, 97612893, 89478485, 82595525
+};
+
+/// @brief Step between the entries of the sine and cosine tables.
+/// @details This is <code>Pi / 128</code> in the kernels' intermediate format.
+constexpr const auto SinCosTableStep = std::int64_t{26353589};
+
+/// @brief Sine table.
+/// @details Element <code>i</code> is the sine of <code>i * SinCosTableStep</code> in the
+///   kernels' format. The table covers the range of <code>0</code> to <code>Pi / 4</code>.
+constexpr const std::int64_t SinTable[33] = {
+    0, 26350943, 52686014, 78989348, 105245102, 131437460, 157550646, 183568928,
+    209476636, 235258163, 260897979, 286380640, 311690796, 336813201, 361732722,
+    386434349, 410903203, 435124544, 459083782, 482766485, 506158387, 529245399,
+    552013613, 574449315, 596538990, 618269332, 639627252, 660599885, 681174596,
+    701338994, 721080931, 740388516, 759250119
+};
+
+/// @brief Cosine table.
+/// @details Element <code>i</code> is the cosine of <code>i * SinCosTableStep</code> in
+///   the kernels' format.
+constexpr const std::int64_t CosTable[33] = {
+    1073741824, 1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190,
+    1057933813, 1053110176, 1047652185, 1041563128, 1034846672, 1027506862, 1019548122,
+    1010975243, 1001793391, 992008096, 981625252, 970651115, 959092293, 946955750,
+    934248796, 920979085, 907154611, 892783702, 877875012, 862437524, 846480536,
+    830013659, 813046813, 795590218, 777654390, 759250131
+};
+
+/// @brief Number of fraction bits of the steps between the entries of the arctangent table.
+constexpr const auto AtanTableStepBits = 5u;
+
+/// @brief Arctangent table.
+/// @details Element <code>i</code> is the arctangent of <code>i / 32</code> in the
+///   kernels' format. The table covers the range of <code>0</code> to <code>1</code>.
+constexpr const std::int64_t AtanTable[(1u << AtanTableStepBits) + 1] = {
+    0, 33543516, 67021687, 100369930, 133525159, 166426484, 199015846, 231238569,
+    263043837, 294385059, 325220151, 355511705, 385227074, 414338361, 442822340,
+    470660297, 497837829, 524344587, 550173994, 575322936, 599791448, 623582386,
+    646701114, 669155185, 690954054, 712108791, 732631822, 752536690, 771837835,
+    790550395, 808690030, 826272767, 843314857
+};
+
+/// @brief Shifts the given value right by the given number of bits rounding to nearest.
+/// @note Halfway values are rounded away from zero.
+constexpr inline std::int64_t RoundingShiftRight(std::int64_t value, unsigned int n) noexcept
 {
-    // n! = n·(n – 1)·(n – 2) · · · 3·2·1
-    auto res = n;
-    for (--n; n > 1; --n)
+    if (n == 0)
     {
-        res *= n;
+        return value;
     }
-    return res;
+    const auto half = std::int64_t{1} << (n - 1);
+    return (value >= 0)? ((value + half) >> n): -((-value + half) >> n);
 }
 
-/// @brief Computes Euler's number raised to the given power argument.
-/// @note Uses Maclaurin series approximation.
-/// @sa http://en.cppreference.com/w/cpp/numeric/math/exp
-/// @sa https://en.wikipedia.org/wiki/Taylor_series
-/// @sa https://en.wikipedia.org/wiki/Exponentiation
-/// @sa https://en.wikipedia.org/wiki/Exponential_function
-template <typename BT, unsigned int FB, int N = 6>
-constexpr inline Fixed<BT, FB> exp(Fixed<BT, FB> arg)
+/// @brief Divides the given value by the given positive divisor rounding to nearest.
+constexpr inline std::int64_t RoundingDivide(std::int64_t value, std::int64_t divisor) noexcept
 {
-    const auto doReciprocal = (arg < 0);
-    if (doReciprocal)
-    {
-        arg = -arg;
-    }
+    return ((value >= 0)? (value + divisor / 2): (value - divisor / 2)) / divisor;
+}
 
-    // Maclaurin series approximation...
-    // e^x = sum(x^n/n!) for n =0 to infinity.
-    // e^x = 1 + x + x^2/2! + x^3/3! + ...
-    // Note: e^(x+y) = e^x * e^y.
-    // Note: convergence is slower for arg > 2 and overflow happens by i == 9
-    auto pt = arg;
-    auto res = pt + 1;
-    auto ft = 1;
-    auto last = pt / ft;
-    for (auto i = 2; i < N; ++i)
+/// @brief Gets the index of the most significant set bit of the given value.
+/// @note <code>T</code> must be an unsigned integral type.
+/// @return Index of the most significant set bit or zero if the value is zero.
+template <typename T>
+constexpr inline unsigned int GetMostSignificantBit(T value) noexcept
+{
+    // Binary searches for the bit rather than shifting through every bit.
+    auto msb = 0u;
+    for (auto step = static_cast<unsigned>(sizeof(T) * 4); step > 0; step /= 2)
     {
-        // have to avoid unnecessarily overflowing...
-        last /= i;
-        last *= arg;
-        res += last;
+        if ((value >> (msb + step)) != 0)
+        {
+            msb += step;
+        }
     }
-    return doReciprocal? 1 / res: res;
+    return msb;
 }
 
-/// @brief Computes the natural logarithm.
-/// @note A better method may be explained in https://math.stackexchange.com/a/61236/408405
-/// @sa http://en.cppreference.com/w/cpp/numeric/math/log
-/// @sa https://en.wikipedia.org/wiki/Natural_logarithm
-template <typename BT, unsigned int FB, int N = 6>
-Fixed<BT, FB> log(Fixed<BT, FB> arg)
+/// @brief Converts the given intermediate value to the given fixed type.
+template <typename BT, unsigned int FB>
+constexpr inline Fixed<BT, FB> FromKernel(std::int64_t value) noexcept
 {
-    if (arg.isnan() || (arg < 0))
-    {
-        return Fixed<BT, FB>::GetNaN();
-    }
-    if (arg == 0)
+    static_assert(FB <= KernelFractionBits, "too many fraction bits for the kernels");
+    return Fixed<BT, FB>::FromBits(static_cast<BT>(RoundingShiftRight(value,
+                                                                      KernelFractionBits - FB)));
+}
+
+/// @brief Sine and cosine intermediate values.
+struct KernelSinCos
+{
+    std::int64_t sin; ///< Sine.
+    std::int64_t cos; ///< Cosine.
+};
+
+/// @brief Computes the sine and cosine of the given finite angle.
+/// @details Reduces the angle to within <code>Pi/4</code> of a multiple of
+///   <code>Pi/2</code>, looks up the sine and cosine of the nearest table entry and
+///   corrects those for the remaining small angle using the angle sum identities.
+/// @return Intermediate values of the sine and cosine.
+template <typename BT, unsigned int FB>
+inline KernelSinCos GetSinCos(Fixed<BT, FB> arg) noexcept
+{
+    constexpr const auto shift = KernelFractionBits - FB;
+    constexpr const auto limit = std::numeric_limits<std::int64_t>::max() >> (shift + 2);
+
+    auto bits = static_cast<std::int64_t>(arg.GetBits());
+    if ((bits > limit) || (bits < -limit))
+    {
+        // Too big for the intermediate format so do a coarser reduction first.
+        bits %= RoundingShiftRight(2 * KernelPi, shift);
+    }
+    const auto angle = bits * (std::int64_t{1} << shift);
+    const auto quadrant = RoundingDivide(angle, KernelHalfPi);
+    const auto r = angle - quadrant * KernelHalfPi;
+
+    // Sine is odd and cosine is even so only the magnitude of r is looked up.
+    const auto t = (r >= 0)? r: -r;
+    const auto i = RoundingDivide(t, SinCosTableStep);
+    const auto h = t - i * SinCosTableStep;
+    const auto h2 = RoundingShiftRight(h * h, KernelFractionBits);
+    const auto sinH = h - RoundingShiftRight(h * h2, KernelFractionBits) / 6;
+    const auto cosH = KernelOne - h2 / 2 + RoundingShiftRight(h2 * h2, KernelFractionBits) / 24;
+    const auto sinT = RoundingShiftRight(SinTable[i] * cosH + CosTable[i] * sinH,
+                                         KernelFractionBits);
+    const auto x = RoundingShiftRight(CosTable[i] * cosH - SinTable[i] * sinH,
+                                      KernelFractionBits);
+    const auto y = (r >= 0)? sinT: -sinT;
+
+    switch (quadrant & 3)
+    {
+        case 0: return KernelSinCos{+y, +x};
+        case 1: return KernelSinCos{+x, -y};
+        case 2: return KernelSinCos{-y, -x};
+        default: break;
+    }
+    return KernelSinCos{-x, +y};
+}
+
+/// @brief Computes the angle of the given vector in the kernels' intermediate format.
+/// @details Reduces the vector to the first octant, where the tangent is at most one,
+///   looks up the arctangent of the nearest table entry and corrects that using the
+///   identity <code>atan(t) = atan(c) + atan((t - c) / (1 + t * c))</code>.
+/// @note The components must share the same scale but may be of any magnitude so long
+///   as they're not both zero.
+/// @return Angle between <code>-Pi</code> and <code>+Pi</code> inclusive.
+inline std::int64_t GetAtan2(std::int64_t y, std::int64_t x) noexcept
+{
+    auto num = static_cast<std::uint64_t>((y >= 0)? y: -y);
+    auto den = static_cast<std::uint64_t>((x >= 0)? x: -x);
+    const auto swap = num > den;
+    if (swap)
     {
-        return Fixed<BT, FB>::GetNegativeInfinity();
+        std::swap(num, den);
     }
-    if (arg == 1)
+
+    // Scales the components down enough for the division not to overflow.
+    constexpr const auto maxDenBits = 63u - KernelFractionBits;
+    const auto msb = GetMostSignificantBit(den);
+    if (msb >= maxDenBits)
     {
-        return Fixed<BT, FB>{0};
+        num >>= msb - maxDenBits + 1;
+        den >>= msb - maxDenBits + 1;
     }
-    if (arg == Fixed<BT, FB>::GetInfinity())
+
+    constexpr const auto stepShift = KernelFractionBits - AtanTableStepBits;
+    const auto t = static_cast<std::int64_t>((num << KernelFractionBits) / den);
+    const auto i = (t + (std::int64_t{1} << (stepShift - 1))) >> stepShift;
+    const auto c = i << stepShift;
+    const auto d = ((t - c) * KernelOne) / (KernelOne + RoundingShiftRight(t * c, KernelFractionBits));
+    const auto d2 = RoundingShiftRight(d * d, KernelFractionBits);
+
+    auto angle = AtanTable[i] + d - RoundingShiftRight(d * d2, KernelFractionBits) / 3;
+    if (swap)
     {
-        return Fixed<BT, FB>::GetInfinity();
+        angle = KernelHalfPi - angle;
     }
-    if (arg <= 2)
+    if (x < 0)
     {
-        // ln(x) = sum((-1)^(n + 1) * (x - 1)^n / n) from n = 1 to infinity
-        // ln(x) = (x - 1) - (x - 1)^2/2 + (x - 1)^3/3 - (x - 1)^4/4 ....
-        arg -= 1;
-        auto res = arg;
-        auto sign = -1;
-        auto pt = arg;
-        for (auto i = 2; i < N; ++i)
-        {
-            pt *= arg;
-            res += sign * pt / i;
-            sign = -sign;
-        }
-        return res;
+        angle = KernelPi - angle;
     }
-    
-    // The following algorithm isn't as accurate as desired.
-    // Is there a better one?
-    // ln(x) = ((x - 1) / x) + ((x - 1) / x)^2/2 + ((x - 1) / x)^3/3 + ...
-    arg = (arg - 1) / arg;
-    auto pt = arg;
-    auto res = pt;
-    for (auto i = 2; i < N; ++i)
-    {
-        pt *= arg;
-        res += pt / i;
-    }
-    return res;
+    return (y < 0)? -angle: angle;
 }
 
-/// @brief Computes the sine of the given argument via Maclaurin series approximation.
-/// @sa https://en.wikipedia.org/wiki/Taylor_series
-template <typename BT, unsigned int FB, int N = 5>
-constexpr inline Fixed<BT, FB> sin(Fixed<BT, FB> arg)
+/// @brief Computes the square root of the given unsigned integer rounded to nearest.
+/// @note <code>T</code> must be an unsigned integral type.
+/// @details Uses the digit-by-digit method starting from the highest power of four
+///   that's not more than the given value.
+/// @sa https://en.wikipedia.org/wiki/Methods_of_computing_square_roots
+template <typename T>
+constexpr inline T RoundedIntegerSqrt(T value) noexcept
 {
-    // Maclaurin series approximation...
-    // sin x = sum((-1^n)*(x^(2n+1))/(2n+1)!)
-    // sin(2) = 0.90929742682
-    // x - x^3/6 + x^5/120 - x^7/5040 + x^9/
-    // 2 - 8/6 = 0.666
-    // 2 - 8/6 + 32/120 = 0.9333
-    // 2 - 8/6 + 32/120 - 128/5040 = 0.90793650793
-    // 2 - 8/6 + 32/120 - 128/5040 + 512/362880 = 0.90934744268
-    auto res = arg;
-    auto sgn = -1;
-    constexpr const auto last = 2 * N + 1;
-    auto pt = arg;
-    auto ft = 1;
-    for (auto i = 3; i <= last; i += 2)
-    {
-        ft *= (i - 1) * i;
-        pt *= arg * arg;
-        const auto term = pt / ft;
-        res += sgn * term;
-        sgn = -sgn;
-    }
-    return res;
+    auto result = T{0};
+    for (auto bit = T{1} << (GetMostSignificantBit(value) & ~1u); bit != 0; bit >>= 2)
+    {
+        // Masking rather than branching avoids hard to predict branches.
+        const auto trial = result + bit;
+        const auto mask = T{0} - static_cast<T>(value >= trial);
+        value -= trial & mask;
+        result = (result >> 1) + (bit & mask);
+    }
+    return (value > result)? result + 1: result;
 }
 
-/// @brief Computes the cosine of the given argument via Maclaurin series approximation.
-/// @sa https://en.wikipedia.org/wiki/Taylor_series
-template <typename BT, unsigned int FB, int N = 5>
-constexpr inline Fixed<BT, FB> cos(Fixed<BT, FB> arg)
+/// @brief Computes the square root of a positive finite value.
+/// @details The square root of the value's internal representation scaled up by
+///   <code>2^FB</code> is the internal representation of the result.
+template <typename BT, unsigned int FB>
+constexpr inline auto ComputeSqrt(Fixed<BT, FB> arg)
 {
-    // Maclaurin series approximation...
-    // cos x = sum((-1^n)*(x^(2n))/(2n)!)
-    // cos(2) = -0.41614683654
-    // 1 - 2^2/2 = -1
-    // 1 - 2^2/2 + 2^4/24 = -0.3333
-    // 1 - 2^2/2 + 2^4/24 - 2^6/720 = -0.422
-    auto res = Fixed<BT, FB>{1};
-    auto sgn = -1;
-    constexpr const auto last = 2 * N;
-    auto ft = 1;
-    auto pt = Fixed<BT, FB>{1};
-    for (auto i = 2; i <= last; i += 2)
-    {
-        ft *= (i - 1) * i;
-        pt *= arg * arg;
-        const auto term = pt / ft;
-        res += sgn * term;
-        sgn = -sgn;
-    }
-    return res;
+    using unsigned_wider_type = typename std::make_unsigned<typename Wider<BT>::type>::type;
+
+    const auto value = static_cast<unsigned_wider_type>(arg.GetBits()) << FB;
+    if ((value >> 32 >> 32) == 0)
+    {
+        // Uses cheaper 64-bit operations whenever possible.
+        const auto result = RoundedIntegerSqrt(static_cast<std::uint64_t>(value));
+        return Fixed<BT, FB>::FromBits(static_cast<BT>(result));
+    }
+    return Fixed<BT, FB>::FromBits(static_cast<BT>(RoundedIntegerSqrt(value)));
 }
 
-/// @brief Computes the arctangent of the given argument via Maclaurin series approximation.
-/// @sa http://en.cppreference.com/w/cpp/numeric/math/atan
-/// @sa https://en.wikipedia.org/wiki/Taylor_series
-template <typename BT, unsigned int FB, int N = 5>
-constexpr inline Fixed<BT, FB> atan(Fixed<BT, FB> arg)
+/// @brief Computes Euler's number raised to the given power argument.
+/// @details Reduces the argument to <code>k * ln(2) + r</code> where <code>|r|</code>
+///   is at most <code>ln(2) / 2</code>, evaluates <code>e^r</code> with a short Maclaurin
+///   polynomial and scales that by <code>2^k</code>.
+/// @note The argument must be finite and within the range for which the result is
+///   neither zero nor infinite.
+/// @sa https://en.wikipedia.org/wiki/Exponential_function
+template <typename BT, unsigned int FB>
+inline Fixed<BT, FB> exp(Fixed<BT, FB> arg) noexcept
 {
-    // Note: if (x > 0) then arctan(x) ==  Pi/2 - arctan(1/x)
-    //       if (x < 0) then arctan(x) == -Pi/2 - arctan(1/x).
-    const auto doReciprocal = (abs(arg) > 1);
-    if (doReciprocal)
+    constexpr const auto shift = KernelFractionBits - FB;
+
+    // Each term of the polynomial adds more than three bits of precision.
+    constexpr const auto degree = static_cast<int>((FB + 3) / 3);
+
+    const auto x = static_cast<std::int64_t>(arg.GetBits()) * (std::int64_t{1} << shift);
+    const auto k = RoundingDivide(x, KernelLn2);
+    const auto r = x - k * KernelLn2;
+    auto p = KernelOne;
+    for (auto i = degree; i > 0; --i)
     {
-        arg = 1 / arg;
+        const auto rp = RoundingShiftRight(r * p, KernelFractionBits);
+        p = KernelOne + RoundingShiftRight(rp * Reciprocals[i], KernelFractionBits);
     }
 
-    // Maclaurin series approximation...
-    // For |arg| <= 1, arg != +/- i
-    // If |arg| > 1 the result is too wrong which is why the reciprocal is done then.
-    auto res = arg;
-    auto sgn = -1;
-    const auto last = 2 * N + 1;
-    auto pt = arg;
-    for (auto i = 3; i <= last; i += 2)
+    const auto n = k - static_cast<std::int64_t>(shift);
+    if (n < 0)
     {
-        pt *= arg * arg;
-        const auto term = pt / i;
-        res += sgn * term;
-        sgn = -sgn;
+        return Fixed<BT, FB>::FromBits(static_cast<BT>((-n < 63)?
+                                                       RoundingShiftRight(p, static_cast<unsigned>(-n)): 0));
     }
-    
-    if (doReciprocal)
+    constexpr const auto maxBits = static_cast<std::int64_t>(Fixed<BT, FB>::GetMax().GetBits());
+    if ((n >= 63) || (p > (maxBits >> n)))
     {
-        return (arg > 0)? FixedPi<BT, FB> / 2 - res: -FixedPi<BT, FB> / 2 - res;
+        return Fixed<BT, FB>::GetInfinity();
     }
-    return res;
+    return Fixed<BT, FB>::FromBits(static_cast<BT>(p * (std::int64_t{1} << n)));
 }
 
-/// @brief Computes the square root of a non-negative value.
-/// @sa https://en.wikipedia.org/wiki/Methods_of_computing_square_roots
+/// @brief Computes the natural logarithm of a positive finite value.
+/// @details Normalizes the argument to <code>m * 2^e</code> where <code>m</code> is in
+///   the range <code>[sqrt(1/2), sqrt(2))</code> and computes <code>ln(m)</code> from the
+///   rapidly converging series <code>2 * atanh((m - 1) / (m + 1))</code>.
+/// @sa https://en.wikipedia.org/wiki/Natural_logarithm#Series
 template <typename BT, unsigned int FB>
-constexpr inline auto ComputeSqrt(Fixed<BT, FB> arg)
+inline Fixed<BT, FB> log(Fixed<BT, FB> arg) noexcept
 {
-    auto temp = Fixed<BT, FB>{1};
-    auto tempSquared = Square(temp);
-    const auto greaterThanOne = arg > 1;
-    auto lower = greaterThanOne? Fixed<BT, FB>{1}: arg;
-    auto upper = greaterThanOne? arg: Fixed<BT, FB>{1};
-    while (arg != tempSquared)
-    {
-        const auto mid = (lower + upper) / 2;
-        if (temp == mid)
-        {
-            break;
-        }
-        temp = mid;
-        tempSquared = Square(temp);
-        if (tempSquared > arg)
-        {
-            upper = temp;
-        }
-        else if (tempSquared < arg)
-        {
-            lower = temp;
-        }
+    // Each term of the series adds more than five bits of precision.
+    constexpr const auto degree = static_cast<int>(FB / 5);
+
+    const auto bits = static_cast<std::int64_t>(arg.GetBits());
+    const auto msb = static_cast<int>(GetMostSignificantBit(static_cast<std::uint64_t>(bits)));
+    auto e = static_cast<std::int64_t>(msb) - static_cast<std::int64_t>(FB);
+    const auto m = (msb <= static_cast<int>(KernelFractionBits))?
+        bits * (std::int64_t{1} << (static_cast<int>(KernelFractionBits) - msb)):
+        (bits >> (msb - static_cast<int>(KernelFractionBits)));
+
+    // Uses (m/2 - 1) / (m/2 + 1) = (m - 2) / (m + 2) when m is more than sqrt(2).
+    const auto big = m > KernelSqrt2;
+    const auto base = big? 2 * KernelOne: KernelOne;
+    if (big)
+    {
+        ++e;
     }
-    return temp;
+    const auto s = RoundingDivide((m - base) * KernelOne, m + base);
+    const auto s2 = RoundingShiftRight(s * s, KernelFractionBits);
+    auto sum = std::int64_t{0};
+    for (auto i = degree; i >= 0; --i)
+    {
+        sum = Reciprocals[2 * i + 1] + RoundingShiftRight(s2 * sum, KernelFractionBits);
+    }
+    return FromKernel<BT, FB>(e * KernelLn2 + RoundingShiftRight(2 * s * sum, KernelFractionBits));
 }
 
 } // namespace detail
@@ -373,8 +477,8 @@ inline Fixed<BT, FB> fmod(Fixed<BT, FB> dividend, Fixed<BT, FB> divisor) noexcep
 }
 
 /// @brief Square root's the given value.
-/// @note This implementation isn't meant to be fast, only correct enough.
-/// @note The IEEE standard (presumably IEC 60559), requires <code>std::sqrt</code> to be exact
+/// @note The result is the representable value nearest to the mathematical square root.
+///   The IEEE standard (presumably IEC 60559), requires <code>std::sqrt</code> to be exact
 ///   to within half of a ULP for floating-point types (float, double). That sets a precedence
 ///   that puts a high expectation on this implementation for fixed-point types.
 /// @note "Domain error" occurs if <code>arg</code> is less than zero.
@@ -383,7 +487,8 @@ inline Fixed<BT, FB> fmod(Fixed<BT, FB> dividend, Fixed<BT, FB> divisor) noexcep
 template <typename BT, unsigned int FB>
 inline auto sqrt(Fixed<BT, FB> arg)
 {
-    if ((arg == Fixed<BT, FB>{1}) || (arg == Fixed<BT, FB>{0}))
+    if ((arg == Fixed<BT, FB>{1}) || (arg == Fixed<BT, FB>{0})
+        || (arg == Fixed<BT, FB>::GetInfinity()))
     {
         return arg;
     }
@@ -403,37 +508,16 @@ inline bool isnormal(Fixed<BT, FB> arg)
     return arg != Fixed<BT, FB>{0} && arg.isfinite();
 }
 
-namespace detail {
-
-/// @brief Normalizes the given angular argument.
-template <typename BT, unsigned int FB>
-inline auto AngularNormalize(Fixed<BT, FB> angleInRadians)
-{
-    constexpr const auto oneRotationInRadians = 2 * FixedPi<BT, FB>;
-
-    angleInRadians = fmod(angleInRadians, oneRotationInRadians);
-    if (angleInRadians > FixedPi<BT, FB>)
-    {
-        // 190_deg becomes 190_deg - 360_deg = -170_deg
-        angleInRadians -= oneRotationInRadians;
-    }
-    else if (angleInRadians < -FixedPi<BT, FB>)
-    {
-        // -200_deg becomes -200_deg + 360_deg = 100_deg
-        angleInRadians += oneRotationInRadians;
-    }
-    return angleInRadians;
-}
-
-} // namespace detail
-
 /// @brief Computes the sine of the argument for Fixed types.
 /// @sa http://en.cppreference.com/w/cpp/numeric/math/sin
 template <typename BT, unsigned int FB>
 inline Fixed<BT, FB> sin(Fixed<BT, FB> arg)
 {
-    arg = detail::AngularNormalize(arg);
-    return detail::sin<BT, FB, 5>(arg);
+    if (!arg.isfinite())
+    {
+        return Fixed<BT, FB>::GetNaN();
+    }
+    return detail::FromKernel<BT, FB>(detail::GetSinCos(arg).sin);
 }
 
 /// @brief Computes the cosine of the argument for Fixed types.
@@ -441,8 +525,11 @@ inline Fixed<BT, FB> sin(Fixed<BT, FB> arg)
 template <typename BT, unsigned int FB>
 inline Fixed<BT, FB> cos(Fixed<BT, FB> arg)
 {
-    arg = detail::AngularNormalize(arg);
-    return detail::cos<BT, FB, 5>(arg);
+    if (!arg.isfinite())
+    {
+        return Fixed<BT, FB>::GetNaN();
+    }
+    return detail::FromKernel<BT, FB>(detail::GetSinCos(arg).cos);
 }
 
 /// @brief Computes the arc tangent.
@@ -463,7 +550,7 @@ inline Fixed<BT, FB> atan(Fixed<BT, FB> arg)
     {
         return -detail::FixedPi<BT, FB> / 2;
     }
-    return detail::atan<BT, FB, 5>(arg);
+    return detail::FromKernel<BT, FB>(detail::GetAtan2(arg.GetBits(), Fixed<BT, FB>{1}.GetBits()));
 }
 
 /// @brief Computes the multi-valued inverse tangent.
@@ -472,25 +559,11 @@ inline Fixed<BT, FB> atan(Fixed<BT, FB> arg)
 template <typename BT, unsigned int FB>
 inline Fixed<BT, FB> atan2(Fixed<BT, FB> y, Fixed<BT, FB> x)
 {
-    // See https://en.wikipedia.org/wiki/Atan2
-    // See https://en.wikipedia.org/wiki/Taylor_series
-    if (x > 0)
-    {
-        return atan(y / x);
-    }
-    if (x < 0)
-    {
-        return atan(y / x) + ((y >= 0)? +1: -1) * detail::FixedPi<BT, FB>;
-    }
-    if (y > 0)
+    if (y.isnan() || x.isnan() || ((y == 0) && (x == 0)))
     {
-        return +detail::FixedPi<BT, FB> / 2;
-    }
-    if (y < 0)
-    {
-        return -detail::FixedPi<BT, FB> / 2;
+        return Fixed<BT, FB>::GetNaN();
     }
-    return Fixed<BT, FB>::GetNaN();
+    return detail::FromKernel<BT, FB>(detail::GetAtan2(y.GetBits(), x.GetBits()));
 }
 
 /// @brief Computes the natural logarithm of the given argument.
@@ -498,7 +571,19 @@ inline Fixed<BT, FB> atan2(Fixed<BT, FB> y, Fixed<BT, FB> x)
 template <typename BT, unsigned int FB>
 inline Fixed<BT, FB> log(Fixed<BT, FB> arg)
 {
-    return (arg < 8)? detail::log<BT, FB, 36>(arg): detail::log<BT, FB, 96>(arg);
+    if (arg.isnan() || (arg < 0))
+    {
+        return Fixed<BT, FB>::GetNaN();
+    }
+    if (arg == 0)
+    {
+        return Fixed<BT, FB>::GetNegativeInfinity();
+    }
+    if (arg == Fixed<BT, FB>::GetInfinity())
+    {
+        return Fixed<BT, FB>::GetInfinity();
+    }
+    return detail::log(arg);
 }
 
 /// @brief Computes the Euler number raised to the power of the given argument.
@@ -506,7 +591,20 @@ inline Fixed<BT, FB> log(Fixed<BT, FB> arg)
 template <typename BT, unsigned int FB>
 inline Fixed<BT, FB> exp(Fixed<BT, FB> arg)
 {
-    return (arg <= 2)? detail::exp<BT, FB, 6>(arg): detail::exp<BT, FB, 24>(arg);
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    // Past these the result is respectively infinite or rounds to zero.
+    if (arg >= static_cast<int>(Fixed<BT, FB>::WholeBits - 1))
+    {
+        return Fixed<BT, FB>::GetInfinity();
+    }
+    if (arg <= -static_cast<int>(FB + 2))
+    {
+        return Fixed<BT, FB>{0};
+    }
+    return detail::exp(arg);
 }
 
 /// @brief Computes the value of the base number raised to the power of the exponent.
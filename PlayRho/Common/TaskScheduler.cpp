@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Common/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+namespace playrho {
+
+/// @brief Work stealing scheduler batch.
+/// @details Tracks the completion of the chunks from one call to <code>ParallelFor</code>.
+struct WorkStealingScheduler::Batch
+{
+    explicit Batch(std::size_t count) noexcept: remaining{count} {}
+    
+    std::atomic<std::size_t> remaining; ///< Count of chunks remaining to be done.
+    std::mutex mutex; ///< Mutex for the completion of the batch.
+    std::condition_variable cv; ///< Condition variable for the completion of the batch.
+    std::exception_ptr exception; ///< First exception thrown by a chunk of the batch.
+};
+
+/// @brief Work stealing scheduler chunk.
+struct WorkStealingScheduler::Chunk
+{
+    const RangeTask* task; ///< Task to run.
+    std::size_t begin; ///< First index of the chunk.
+    std::size_t end; ///< One past the last index of the chunk.
+    Batch* batch; ///< Batch that the chunk is part of.
+};
+
+/// @brief Work stealing scheduler queue.
+/// @details The owning worker pops chunks from its back while others steal from its front.
+struct WorkStealingScheduler::Queue
+{
+    std::mutex mutex; ///< Mutex for the chunks.
+    std::deque<Chunk> chunks; ///< Queued chunks.
+};
+
+std::size_t WorkStealingScheduler::GetDefaultWorkerCount() noexcept
+{
+    const auto concurrency = std::thread::hardware_concurrency();
+    return (concurrency > 1)? static_cast<std::size_t>(concurrency - 1): std::size_t{0};
+}
+
+WorkStealingScheduler::WorkStealingScheduler(std::size_t workerCount)
+{
+    m_queues.reserve(workerCount);
+    for (auto i = decltype(workerCount){0}; i < workerCount; ++i)
+    {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+    m_threads.reserve(workerCount);
+    try
+    {
+        for (auto i = decltype(workerCount){0}; i < workerCount; ++i)
+        {
+            m_threads.emplace_back(&WorkStealingScheduler::WorkerLoop, this, i);
+        }
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto&& thread: m_threads)
+        {
+            thread.join();
+        }
+        throw;
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto&& thread: m_threads)
+    {
+        thread.join();
+    }
+}
+
+std::size_t WorkStealingScheduler::GetConcurrency() const noexcept
+{
+    return size(m_threads) + 1;
+}
+
+void WorkStealingScheduler::ParallelFor(std::size_t count, std::size_t grainSize,
+                                        const RangeTask& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    grainSize = std::max(grainSize, std::size_t{1});
+    const auto numChunks = (count + grainSize - 1) / grainSize;
+    if (empty(m_threads) || (numChunks == 1))
+    {
+        for (auto begin = std::size_t{0}; begin < count; begin += grainSize)
+        {
+            task(begin, std::min(begin + grainSize, count));
+        }
+        return;
+    }
+    
+    auto batch = Batch{numChunks};
+    const auto numQueues = size(m_queues);
+    const auto first = m_next.fetch_add(1) % numQueues;
+    for (auto i = std::size_t{0}; i < numChunks; ++i)
+    {
+        const auto begin = i * grainSize;
+        Push((first + i) % numQueues, Chunk{&task, begin, std::min(begin + grainSize, count), &batch});
+    }
+    {
+        // Locking ensures no worker is between checking for work and waiting.
+        std::lock_guard<std::mutex> lock{m_mutex};
+    }
+    m_cv.notify_all();
+    
+    // Help out rather than just wait.
+    auto chunk = Chunk{};
+    while ((batch.remaining > 0) && TryPop(first, chunk))
+    {
+        Run(chunk);
+    }
+    
+    std::unique_lock<std::mutex> lock{batch.mutex};
+    batch.cv.wait(lock, [&batch]{ return batch.remaining == 0; });
+    if (batch.exception)
+    {
+        std::rethrow_exception(batch.exception);
+    }
+}
+
+void WorkStealingScheduler::Push(std::size_t index, const Chunk& chunk)
+{
+    auto& queue = *m_queues[index];
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    queue.chunks.push_back(chunk);
+    ++m_queued;
+}
+
+bool WorkStealingScheduler::TryPop(std::size_t index, Chunk& chunk)
+{
+    {
+        auto& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!empty(queue.chunks))
+        {
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+            --m_queued;
+            return true;
+        }
+    }
+    const auto numQueues = size(m_queues);
+    for (auto i = std::size_t{1}; i < numQueues; ++i)
+    {
+        auto& queue = *m_queues[(index + i) % numQueues];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!empty(queue.chunks))
+        {
+            chunk = queue.chunks.front();
+            queue.chunks.pop_front();
+            --m_queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingScheduler::Run(const Chunk& chunk) noexcept
+{
+    auto exception = std::exception_ptr{};
+    try
+    {
+        (*chunk.task)(chunk.begin, chunk.end);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+    
+    // The batch may be destroyed as soon as its mutex is released after its last chunk.
+    auto& batch = *chunk.batch;
+    std::lock_guard<std::mutex> lock{batch.mutex};
+    if (exception && !batch.exception)
+    {
+        batch.exception = exception;
+    }
+    if (--batch.remaining == 0)
+    {
+        batch.cv.notify_all();
+    }
+}
+
+void WorkStealingScheduler::WorkerLoop(std::size_t index)
+{
+    auto chunk = Chunk{};
+    for (;;)
+    {
+        if (TryPop(index, chunk))
+        {
+            Run(chunk);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_cv.wait(lock, [this]{ return m_stop || (m_queued > 0); });
+        if (m_stop && (m_queued == 0))
+        {
+            return;
+        }
+    }
+}
+
+} // namespace playrho
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_COMMON_TASKSCHEDULER_HPP
+#define PLAYRHO_COMMON_TASKSCHEDULER_HPP
+
+/// @file
+/// Declarations of the TaskScheduler interface and its default implementation.
+
+#include <PlayRho/Common/Settings.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace playrho {
+
+/// @brief Task scheduler interface.
+///
+/// @details This is the interface through which parallelizable work gets submitted.
+///   Implement it to have this work run on an existing job system &mdash; like that
+///   of a game engine &mdash; instead of on threads of its own.
+///
+/// @sa WorkStealingScheduler, d2::WorldConf::UseTaskScheduler
+///
+class TaskScheduler
+{
+public:
+    /// @brief Range task type.
+    /// @details Function that's called to do the work of the indices from its first
+    ///   argument up to but not including its second argument.
+    using RangeTask = std::function<void(std::size_t begin, std::size_t end)>;
+    
+    virtual ~TaskScheduler() = default;
+    
+    /// @brief Gets the number of threads that tasks may concurrently run on.
+    virtual std::size_t GetConcurrency() const noexcept = 0;
+    
+    /// @brief Runs the given task over the range of indices from zero to the given count.
+    ///
+    /// @details Splits the range into chunks of up to the given grain size and calls the
+    ///   task for each chunk, possibly concurrently, returning once all of them have
+    ///   been done.
+    ///
+    /// @note The calling thread may be used to run chunks.
+    /// @note Implementations must be able to handle calls from multiple threads.
+    ///
+    /// @param count Count of indices to run the task for.
+    /// @param grainSize Maximum count of indices per chunk. Treated as 1 if 0.
+    /// @param task Task to run.
+    ///
+    /// @throws Any exception thrown by the task. When more than one chunk throws, the
+    ///   first of these exceptions is rethrown.
+    ///
+    virtual void ParallelFor(std::size_t count, std::size_t grainSize, const RangeTask& task) = 0;
+};
+
+/// @brief Work stealing task scheduler.
+///
+/// @details This is the default task scheduler implementation. It runs the chunks of
+///   submitted work on a fixed number of worker threads and on the submitting thread.
+///   Each worker thread has a queue of its own that submitted chunks get distributed to.
+///   Threads that run out of work steal chunks from the other queues.
+///
+/// @note The threads are created when this is constructed and destroyed when this is.
+///
+class WorkStealingScheduler: public TaskScheduler
+{
+public:
+    /// @brief Gets the default count of worker threads.
+    /// @details One less than the hardware concurrency since the submitting thread
+    ///   helps run its own work.
+    static std::size_t GetDefaultWorkerCount() noexcept;
+    
+    /// @brief Initializing constructor.
+    /// @param workerCount Count of worker threads to create. With none, submitted
+    ///   work runs entirely on the submitting thread.
+    explicit WorkStealingScheduler(std::size_t workerCount = GetDefaultWorkerCount());
+    
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    
+    WorkStealingScheduler& operator= (const WorkStealingScheduler& other) = delete;
+    
+    /// @brief Destructor.
+    /// @details Stops and joins the worker threads.
+    ~WorkStealingScheduler() override;
+    
+    std::size_t GetConcurrency() const noexcept override;
+    
+    void ParallelFor(std::size_t count, std::size_t grainSize, const RangeTask& task) override;
+    
+private:
+    struct Batch;
+    struct Chunk;
+    struct Queue;
+    
+    /// @brief Pushes the given chunk onto the queue of the given index.
+    void Push(std::size_t index, const Chunk& chunk);
+    
+    /// @brief Tries to pop a chunk from the queue of the given index or to steal one.
+    bool TryPop(std::size_t index, Chunk& chunk);
+    
+    /// @brief Runs the given chunk.
+    static void Run(const Chunk& chunk) noexcept;
+    
+    /// @brief Loop run by the worker thread of the given index.
+    void WorkerLoop(std::size_t index);
+    
+    std::vector<std::unique_ptr<Queue>> m_queues; ///< Per worker queues.
+    std::vector<std::thread> m_threads; ///< Worker threads.
+    std::atomic<std::size_t> m_queued{0}; ///< Count of queued chunks.
+    std::atomic<std::size_t> m_next{0}; ///< Next queue to distribute chunks to.
+    std::mutex m_mutex; ///< Mutex for the worker sleep and wake-ups.
+    std::condition_variable m_cv; ///< Condition variable for waking the workers.
+    bool m_stop = false; ///< Whether the workers are to stop.
+};
+
+} // namespace playrho
+
+#endif // PLAYRHO_COMMON_TASKSCHEDULER_HPP
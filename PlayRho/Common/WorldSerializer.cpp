@@ -0,0 +1,1303 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Common/WorldSerializer.hpp>
+
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
+#include <PlayRho/Dynamics/FixtureConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Dynamics/ContactAtty.hpp>
+#include <PlayRho/Dynamics/Contacts/Contact.hpp>
+#include <PlayRho/Dynamics/Joints/Joint.hpp>
+#include <PlayRho/Dynamics/Joints/JointVisitor.hpp>
+#include <PlayRho/Dynamics/Joints/PulleyJoint.hpp>
+#include <PlayRho/Dynamics/Joints/DistanceJoint.hpp>
+#include <PlayRho/Dynamics/Joints/FrictionJoint.hpp>
+#include <PlayRho/Dynamics/Joints/MotorJoint.hpp>
+#include <PlayRho/Dynamics/Joints/WeldJoint.hpp>
+#include <PlayRho/Dynamics/Joints/TargetJoint.hpp>
+#include <PlayRho/Dynamics/Joints/RevoluteJoint.hpp>
+#include <PlayRho/Dynamics/Joints/PrismaticJoint.hpp>
+#include <PlayRho/Dynamics/Joints/GearJoint.hpp>
+#include <PlayRho/Dynamics/Joints/RopeJoint.hpp>
+#include <PlayRho/Dynamics/Joints/WheelJoint.hpp>
+#include <PlayRho/Collision/Shapes/Shape.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/MultiShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Common/VertexSet.hpp>
+#include <PlayRho/Common/InvalidArgument.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <type_traits>
+#include <typeinfo>
+
+namespace playrho {
+namespace d2 {
+
+namespace {
+
+    /// @brief Identifying bytes at the start of every serialized world.
+    PLAYRHO_CONSTEXPR const std::uint8_t WorldFormatMagic[] = {'P', 'R', 'W', 'B'};
+
+    /// @brief Size of the chunks that stream based loading reads at a time.
+    PLAYRHO_CONSTEXPR const auto StreamChunkSize = std::size_t{4096};
+
+    /// @brief Index value used for a missing body or joint.
+    PLAYRHO_CONSTEXPR const auto InvalidIndex = static_cast<std::uint32_t>(-1);
+
+    /// @brief Shape type tags.
+    enum class ShapeTag: std::uint8_t
+    {
+        Disk = 1,
+        Edge,
+        Polygon,
+        Chain,
+        Multi,
+        HeightField
+    };
+
+    /// @brief Header flags.
+    enum HeaderFlag: std::uint8_t
+    {
+        e_hasContactsFlag = 0x01
+    };
+
+    /// @brief Body flags.
+    enum BodyFlag: std::uint8_t
+    {
+        e_allowSleepFlag = 0x01,
+        e_awakeFlag = 0x02,
+        e_fixedRotationFlag = 0x04,
+        e_bulletFlag = 0x08,
+        e_enabledFlag = 0x10
+    };
+
+    /// @brief Contact flags.
+    enum ContactFlag: std::uint8_t
+    {
+        e_contactEnabledFlag = 0x01,
+        e_contactTouchingFlag = 0x02
+    };
+
+    static_assert(std::is_trivially_copyable<Real>::value, "Real must be trivially copyable");
+
+    bool IsLittleEndian() noexcept
+    {
+        const auto value = std::uint16_t{1};
+        auto byte = std::uint8_t{0};
+        std::memcpy(&byte, &value, 1);
+        return byte == 1;
+    }
+
+    /// @brief Writes values in the world format's byte order to a byte sink.
+    class Writer
+    {
+    public:
+        using Sink = std::function<void(const std::uint8_t* data, std::size_t size)>;
+
+        explicit Writer(Sink sink): m_sink{std::move(sink)}
+        {
+            // Intentionally empty.
+        }
+
+        template <typename T>
+        void Put(T value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "trivially copyable required");
+            std::array<std::uint8_t, sizeof(T)> bytes;
+            std::memcpy(data(bytes), &value, sizeof(T));
+            if (!m_littleEndian)
+            {
+                std::reverse(begin(bytes), end(bytes));
+            }
+            m_sink(data(bytes), sizeof(T));
+        }
+
+        void Put(bool value)
+        {
+            Put(static_cast<std::uint8_t>(value? 1: 0));
+        }
+
+        void Put(Length2 value)
+        {
+            Put(Real{get<0>(value) / Meter});
+            Put(Real{get<1>(value) / Meter});
+        }
+
+        void Put(UnitVec value)
+        {
+            Put(value.GetX());
+            Put(value.GetY());
+        }
+
+        void PutCount(std::size_t value)
+        {
+            Put(static_cast<std::uint32_t>(value));
+        }
+
+        void PutRaw(const std::uint8_t* data, std::size_t size)
+        {
+            m_sink(data, size);
+        }
+
+    private:
+        Sink m_sink;
+        bool m_littleEndian = IsLittleEndian();
+    };
+
+    /// @brief Source of bytes to read serialized data from.
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+
+        /// @brief Reads exactly the given number of bytes into the given buffer.
+        /// @throws InvalidArgument if there aren't enough bytes left.
+        virtual void Read(std::uint8_t* dest, std::size_t size) = 0;
+    };
+
+    /// @brief Source reading from a contiguous, in-memory, range of bytes.
+    class SpanSource final: public Source
+    {
+    public:
+        explicit SpanSource(Span<const std::uint8_t> data) noexcept: m_data{data}
+        {
+            // Intentionally empty.
+        }
+
+        void Read(std::uint8_t* dest, std::size_t size) override
+        {
+            if (size > (m_data.size() - m_offset))
+            {
+                throw InvalidArgument("Deserialize: unexpected end of data");
+            }
+            std::memcpy(dest, m_data.begin() + m_offset, size);
+            m_offset += size;
+        }
+
+    private:
+        Span<const std::uint8_t> m_data;
+        std::size_t m_offset = 0;
+    };
+
+    /// @brief Source reading from an input stream a chunk at a time.
+    class StreamSource final: public Source
+    {
+    public:
+        explicit StreamSource(std::istream& is) noexcept: m_is{is}
+        {
+            // Intentionally empty.
+        }
+
+        void Read(std::uint8_t* dest, std::size_t size) override
+        {
+            while (size > 0)
+            {
+                if (m_offset == m_size)
+                {
+                    Refill();
+                }
+                const auto count = std::min(size, m_size - m_offset);
+                std::memcpy(dest, data(m_buffer) + m_offset, count);
+                m_offset += count;
+                dest += count;
+                size -= count;
+            }
+        }
+
+    private:
+        void Refill()
+        {
+            m_is.read(reinterpret_cast<char*>(data(m_buffer)), StreamChunkSize);
+            m_size = static_cast<std::size_t>(m_is.gcount());
+            m_offset = 0;
+            if (m_size == 0)
+            {
+                throw InvalidArgument("Deserialize: unexpected end of stream");
+            }
+        }
+
+        std::istream& m_is;
+        std::array<std::uint8_t, StreamChunkSize> m_buffer;
+        std::size_t m_size = 0;
+        std::size_t m_offset = 0;
+    };
+
+    /// @brief Writes the joint specific configuration of joints it visits.
+    class JointWriter: public ConstJointVisitor
+    {
+    public:
+        JointWriter(Writer& w, const std::map<const Joint*, std::uint32_t>& joints):
+            writer{w}, jointIndices{joints}
+        {
+            // Intentionally empty.
+        }
+
+        void Visit(const RevoluteJoint& joint) override
+        {
+            const auto def = GetRevoluteJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.referenceAngle / Radian});
+            writer.Put(def.enableLimit);
+            writer.Put(Real{def.lowerAngle / Radian});
+            writer.Put(Real{def.upperAngle / Radian});
+            writer.Put(def.enableMotor);
+            writer.Put(Real{def.motorSpeed / RadianPerSecond});
+            writer.Put(Real{def.maxMotorTorque / NewtonMeter});
+        }
+
+        void Visit(const PrismaticJoint& joint) override
+        {
+            const auto def = GetPrismaticJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(def.localAxisA);
+            writer.Put(Real{def.referenceAngle / Radian});
+            writer.Put(def.enableLimit);
+            writer.Put(Real{def.lowerTranslation / Meter});
+            writer.Put(Real{def.upperTranslation / Meter});
+            writer.Put(def.enableMotor);
+            writer.Put(Real{def.maxMotorForce / Newton});
+            writer.Put(Real{def.motorSpeed / RadianPerSecond});
+        }
+
+        void Visit(const DistanceJoint& joint) override
+        {
+            const auto def = GetDistanceJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.length / Meter});
+            writer.Put(Real{def.frequency / Hertz});
+            writer.Put(def.dampingRatio);
+        }
+
+        void Visit(const PulleyJoint& joint) override
+        {
+            const auto def = GetPulleyJointConf(joint);
+            writer.Put(def.groundAnchorA);
+            writer.Put(def.groundAnchorB);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.lengthA / Meter});
+            writer.Put(Real{def.lengthB / Meter});
+            writer.Put(def.ratio);
+        }
+
+        void Visit(const TargetJoint& joint) override
+        {
+            const auto def = GetTargetJointConf(joint);
+            writer.Put(def.target);
+            writer.Put(Real{def.maxForce / Newton});
+            writer.Put(Real{def.frequency / Hertz});
+            writer.Put(Real{def.dampingRatio});
+        }
+
+        void Visit(const GearJoint& joint) override
+        {
+            const auto def = GetGearJointConf(joint);
+            writer.Put(jointIndices.at(def.joint1));
+            writer.Put(jointIndices.at(def.joint2));
+            writer.Put(def.ratio);
+        }
+
+        void Visit(const WheelJoint& joint) override
+        {
+            const auto def = GetWheelJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(def.localAxisA);
+            writer.Put(def.enableMotor);
+            writer.Put(Real{def.maxMotorTorque / NewtonMeter});
+            writer.Put(Real{def.motorSpeed / RadianPerSecond});
+            writer.Put(Real{def.frequency / Hertz});
+            writer.Put(def.dampingRatio);
+        }
+
+        void Visit(const WeldJoint& joint) override
+        {
+            const auto def = GetWeldJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.referenceAngle / Radian});
+            writer.Put(Real{def.frequency / Hertz});
+            writer.Put(def.dampingRatio);
+        }
+
+        void Visit(const FrictionJoint& joint) override
+        {
+            const auto def = GetFrictionJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.maxForce / Newton});
+            writer.Put(Real{def.maxTorque / NewtonMeter});
+        }
+
+        void Visit(const RopeJoint& joint) override
+        {
+            const auto def = GetRopeJointConf(joint);
+            writer.Put(def.localAnchorA);
+            writer.Put(def.localAnchorB);
+            writer.Put(Real{def.maxLength / Meter});
+        }
+
+        void Visit(const MotorJoint& joint) override
+        {
+            const auto def = GetMotorJointConf(joint);
+            writer.Put(def.linearOffset);
+            writer.Put(Real{def.angularOffset / Radian});
+            writer.Put(Real{def.maxForce / Newton});
+            writer.Put(Real{def.maxTorque / NewtonMeter});
+            writer.Put(def.correctionFactor);
+        }
+
+        Writer& writer;
+        const std::map<const Joint*, std::uint32_t>& jointIndices;
+    };
+
+    void WriteShapeBase(Writer& writer, ShapeTag tag, const BaseShapeConf& conf)
+    {
+        writer.Put(static_cast<std::uint8_t>(tag));
+        writer.Put(Real{conf.friction});
+        writer.Put(Real{conf.restitution});
+        writer.Put(Real{AreaDensity{conf.density} / KilogramPerSquareMeter});
+    }
+
+    void WriteShape(Writer& writer, const Shape& shape)
+    {
+        const auto& ti = GetUseTypeInfo(shape);
+        const auto data = GetData(shape);
+        if (ti == typeid(DiskShapeConf))
+        {
+            const auto& conf = *static_cast<const DiskShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::Disk, conf);
+            writer.Put(Real{Length{conf.vertexRadius} / Meter});
+            writer.Put(conf.location);
+        }
+        else if (ti == typeid(EdgeShapeConf))
+        {
+            const auto& conf = *static_cast<const EdgeShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::Edge, conf);
+            writer.Put(Real{Length{conf.vertexRadius} / Meter});
+            writer.Put(conf.GetVertexA());
+            writer.Put(conf.GetVertexB());
+        }
+        else if (ti == typeid(PolygonShapeConf))
+        {
+            const auto& conf = *static_cast<const PolygonShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::Polygon, conf);
+            writer.Put(Real{Length{conf.vertexRadius} / Meter});
+            writer.PutCount(conf.GetVertexCount());
+            for (const auto& vertex: conf.GetVertices())
+            {
+                writer.Put(vertex);
+            }
+        }
+        else if (ti == typeid(ChainShapeConf))
+        {
+            const auto& conf = *static_cast<const ChainShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::Chain, conf);
+            writer.Put(Real{Length{conf.vertexRadius} / Meter});
+            const auto count = conf.GetVertexCount();
+            writer.PutCount(count);
+            for (auto i = ChildCounter{0}; i < count; ++i)
+            {
+                writer.Put(conf.GetVertex(i));
+            }
+        }
+        else if (ti == typeid(MultiShapeConf))
+        {
+            const auto& conf = *static_cast<const MultiShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::Multi, conf);
+            writer.PutCount(size(conf.children));
+            for (const auto& child: conf.children)
+            {
+                const auto proxy = child.GetDistanceProxy();
+                writer.Put(Real{Length{proxy.GetVertexRadius()} / Meter});
+                writer.PutCount(proxy.GetVertexCount());
+                for (const auto& vertex: proxy.GetVertices())
+                {
+                    writer.Put(vertex);
+                }
+            }
+        }
+        else if (ti == typeid(HeightFieldShapeConf))
+        {
+            const auto& conf = *static_cast<const HeightFieldShapeConf*>(data);
+            WriteShapeBase(writer, ShapeTag::HeightField, conf);
+            writer.Put(Real{Length{conf.vertexRadius} / Meter});
+            writer.Put(Real{Length{conf.GetCellWidth()} / Meter});
+            writer.Put(conf.GetOrigin());
+            const auto count = conf.GetHeightCount();
+            writer.PutCount(count);
+            for (auto i = ChildCounter{0}; i < count; ++i)
+            {
+                writer.Put(Real{conf.GetHeight(i) / Meter});
+            }
+        }
+        else
+        {
+            throw InvalidArgument("Serialize: unsupported shape type");
+        }
+    }
+
+    void WriteManifold(Writer& writer, const Manifold& manifold)
+    {
+        const auto count = manifold.GetPointCount();
+        writer.Put(static_cast<std::uint8_t>(manifold.GetType()));
+        writer.Put(static_cast<std::uint8_t>(count));
+        if (manifold.GetType() == Manifold::e_unset)
+        {
+            return;
+        }
+        writer.Put(manifold.GetLocalNormal());
+        writer.Put(manifold.GetLocalPoint());
+        for (auto i = decltype(count){0}; i < count; ++i)
+        {
+            const auto& point = manifold.GetPoint(i);
+            writer.Put(point.localPoint);
+            writer.Put(static_cast<std::uint8_t>(point.contactFeature.typeA));
+            writer.Put(point.contactFeature.indexA);
+            writer.Put(static_cast<std::uint8_t>(point.contactFeature.typeB));
+            writer.Put(point.contactFeature.indexB);
+            writer.Put(Real{point.normalImpulse / NewtonSecond});
+            writer.Put(Real{point.tangentImpulse / NewtonSecond});
+        }
+    }
+
+    void Write(Writer& writer, const World& world, bool withContacts)
+    {
+        writer.PutRaw(WorldFormatMagic, sizeof(WorldFormatMagic));
+        writer.Put(WorldFormatVersion);
+        writer.Put(std::is_floating_point<Real>::value);
+        writer.Put(static_cast<std::uint8_t>(sizeof(Real)));
+        writer.Put(static_cast<std::uint8_t>(std::numeric_limits<Real>::digits));
+        writer.Put(static_cast<std::uint8_t>(withContacts? e_hasContactsFlag: 0));
+
+        // Collect the shapes, storing shapes shared between fixtures only once.
+        auto shapes = std::vector<Shape>{};
+        auto shapeIndices = std::map<const void*, std::uint32_t>{};
+        auto bodyIndices = std::map<const Body*, std::uint32_t>{};
+        auto fixtureIndices = std::map<const Fixture*, std::uint32_t>{};
+        for (auto&& body: world.GetBodies())
+        {
+            const auto& b = GetRef(body);
+            bodyIndices.emplace(&b, static_cast<std::uint32_t>(size(bodyIndices)));
+            for (auto&& fixture: b.GetFixtures())
+            {
+                const auto& f = GetRef(fixture);
+                fixtureIndices.emplace(&f, static_cast<std::uint32_t>(size(fixtureIndices)));
+                const auto shape = f.GetShape();
+                if (shapeIndices.emplace(GetData(shape),
+                                         static_cast<std::uint32_t>(size(shapes))).second)
+                {
+                    shapes.push_back(shape);
+                }
+            }
+        }
+
+        writer.PutCount(size(shapes));
+        for (const auto& shape: shapes)
+        {
+            WriteShape(writer, shape);
+        }
+
+        writer.PutCount(size(bodyIndices));
+        for (auto&& body: world.GetBodies())
+        {
+            const auto& b = GetRef(body);
+            const auto conf = GetBodyConf(b);
+            writer.Put(static_cast<std::uint8_t>(conf.type));
+            writer.Put(conf.location);
+            writer.Put(Real{conf.angle / Radian});
+            writer.Put(Real{get<0>(conf.linearVelocity) / MeterPerSecond});
+            writer.Put(Real{get<1>(conf.linearVelocity) / MeterPerSecond});
+            writer.Put(Real{conf.angularVelocity / RadianPerSecond});
+            writer.Put(Real{get<0>(conf.linearAcceleration) / MeterPerSquareSecond});
+            writer.Put(Real{get<1>(conf.linearAcceleration) / MeterPerSquareSecond});
+            writer.Put(Real{conf.angularAcceleration / RadianPerSquareSecond});
+            writer.Put(Real{Frequency{conf.linearDamping} / Hertz});
+            writer.Put(Real{Frequency{conf.angularDamping} / Hertz});
+            writer.Put(Real{conf.underActiveTime / Second});
+            writer.Put(static_cast<std::uint8_t>((conf.allowSleep? e_allowSleepFlag: 0)
+                                                 | (conf.awake? e_awakeFlag: 0)
+                                                 | (conf.fixedRotation? e_fixedRotationFlag: 0)
+                                                 | (conf.bullet? e_bulletFlag: 0)
+                                                 | (conf.enabled? e_enabledFlag: 0)));
+
+            // Mass data is stored explicitly since it may have been set independently of
+            // the fixtures.
+            const auto invMass = b.GetInvMass();
+            const auto invRotI = b.GetInvRotInertia();
+            writer.Put(Real{((invMass != InvMass{0})? Mass{Real{1} / invMass}: 0_kg) / Kilogram});
+            writer.Put(Real{((invRotI != InvRotInertia{0})? RotInertia{Real{1} / invRotI}: RotInertia{0})
+                            * SquareRadian / (Kilogram * SquareMeter)});
+            writer.Put(b.GetLocalCenter());
+
+            const auto fixtures = b.GetFixtures();
+            writer.PutCount(size(fixtures));
+            for (auto&& fixture: fixtures)
+            {
+                const auto& f = GetRef(fixture);
+                const auto filter = f.GetFilterData();
+                writer.Put(shapeIndices.at(GetData(f.GetShape())));
+                writer.Put(f.IsSensor());
+                writer.Put(filter.categoryBits);
+                writer.Put(filter.maskBits);
+                writer.Put(filter.groupIndex);
+                writer.Put(f.IsSingleProxy());
+            }
+        }
+
+        const auto joints = world.GetJoints();
+        auto jointIndices = std::map<const Joint*, std::uint32_t>{};
+        auto jointWriter = JointWriter{writer, jointIndices};
+        writer.PutCount(size(joints));
+        for (auto&& joint: joints)
+        {
+            const auto& j = GetRef(joint);
+            const auto bodyA = j.GetBodyA();
+            const auto bodyB = j.GetBodyB();
+            writer.Put(static_cast<std::uint8_t>(GetType(j)));
+            writer.Put(bodyA? bodyIndices.at(bodyA): InvalidIndex);
+            writer.Put(bodyB? bodyIndices.at(bodyB): InvalidIndex);
+            writer.Put(j.GetCollideConnected());
+            j.Accept(jointWriter);
+            jointIndices.emplace(&j, static_cast<std::uint32_t>(size(jointIndices)));
+        }
+
+        if (withContacts)
+        {
+            const auto contacts = world.GetContacts();
+            writer.PutCount(size(contacts));
+            for (auto&& contact: contacts)
+            {
+                const auto& c = GetRef(std::get<Contact*>(contact));
+                writer.Put(fixtureIndices.at(c.GetFixtureA()));
+                writer.Put(static_cast<std::uint32_t>(c.GetChildIndexA()));
+                writer.Put(fixtureIndices.at(c.GetFixtureB()));
+                writer.Put(static_cast<std::uint32_t>(c.GetChildIndexB()));
+                writer.Put(static_cast<std::uint8_t>((c.IsEnabled()? e_contactEnabledFlag: 0)
+                                                     | (c.IsTouching()? e_contactTouchingFlag: 0)));
+                writer.Put(c.GetFriction());
+                writer.Put(c.GetRestitution());
+                writer.Put(Real{c.GetTangentSpeed() / MeterPerSecond});
+                WriteManifold(writer, c.GetManifold());
+            }
+        }
+    }
+
+} // anonymous namespace
+
+/// @brief Reader of serialized worlds.
+/// @note This is a friend of the <code>ContactAtty</code> class for restoring the contacts.
+class WorldReader
+{
+public:
+    WorldReader(World& world, Source& source): m_world{world}, m_source{source}
+    {
+        // Intentionally empty.
+    }
+
+    void Read()
+    {
+        try
+        {
+            ReadHeader();
+            ReadShapes();
+            ReadBodies();
+            ReadJoints();
+            if (m_hasContacts)
+            {
+                ReadContacts();
+            }
+        }
+        catch (...)
+        {
+            Undo();
+            throw;
+        }
+    }
+
+private:
+    /// @brief Contact state read for restoring after the contacts are found.
+    struct ContactRecord
+    {
+        Fixture* fixtureA;
+        ChildCounter indexA;
+        Fixture* fixtureB;
+        ChildCounter indexB;
+        std::uint8_t flags;
+        Real friction;
+        Real restitution;
+        LinearVelocity tangentSpeed;
+        Manifold manifold;
+    };
+
+    /// @brief Destroys the joints and bodies read so far.
+    /// @note Bad data is all detected before the world is stepped, so this leaves the
+    ///   world as it was before reading for such data.
+    void Undo()
+    {
+        if (empty(m_bodies) && empty(m_joints))
+        {
+            return;
+        }
+        for (auto it = rbegin(m_joints); it != rend(m_joints); ++it)
+        {
+            m_world.Destroy(*it);
+        }
+        m_world.DestroyBodies(m_bodies);
+        m_joints.clear();
+        m_fixtures.clear();
+        m_bodies.clear();
+    }
+
+    template <typename T>
+    T Get()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "trivially copyable required");
+        std::array<std::uint8_t, sizeof(T)> bytes;
+        m_source.Read(data(bytes), sizeof(T));
+        if (!m_littleEndian)
+        {
+            std::reverse(begin(bytes), end(bytes));
+        }
+        auto value = T{};
+        std::memcpy(&value, data(bytes), sizeof(T));
+        return value;
+    }
+
+    bool GetBool()
+    {
+        return Get<std::uint8_t>() != 0;
+    }
+
+    Real GetReal()
+    {
+        return Get<Real>();
+    }
+
+    Length2 GetLength2()
+    {
+        const auto x = GetReal();
+        const auto y = GetReal();
+        return Length2{x * Meter, y * Meter};
+    }
+
+    UnitVec GetUnitVec()
+    {
+        const auto x = GetReal();
+        const auto y = GetReal();
+        return std::get<UnitVec>(UnitVec::Get(x, y));
+    }
+
+    std::uint32_t GetCount()
+    {
+        return Get<std::uint32_t>();
+    }
+
+    Body* GetBody()
+    {
+        const auto index = Get<std::uint32_t>();
+        if (index == InvalidIndex)
+        {
+            return nullptr;
+        }
+        if (index >= size(m_bodies))
+        {
+            throw InvalidArgument("Deserialize: invalid body index");
+        }
+        return m_bodies[index];
+    }
+
+    Joint* GetJoint()
+    {
+        const auto index = Get<std::uint32_t>();
+        if (index >= size(m_joints))
+        {
+            throw InvalidArgument("Deserialize: invalid joint index");
+        }
+        return m_joints[index];
+    }
+
+    Fixture* GetFixture()
+    {
+        const auto index = Get<std::uint32_t>();
+        if (index >= size(m_fixtures))
+        {
+            throw InvalidArgument("Deserialize: invalid fixture index");
+        }
+        return m_fixtures[index];
+    }
+
+    void ReadHeader()
+    {
+        std::uint8_t magic[sizeof(WorldFormatMagic)];
+        m_source.Read(magic, sizeof(magic));
+        if (!std::equal(std::begin(magic), std::end(magic), std::begin(WorldFormatMagic)))
+        {
+            throw InvalidArgument("Deserialize: not a serialized world");
+        }
+        m_version = Get<std::uint16_t>();
+        if (m_version > WorldFormatVersion)
+        {
+            throw InvalidArgument("Deserialize: unsupported format version");
+        }
+        const auto isFloatingPoint = GetBool();
+        const auto realSize = Get<std::uint8_t>();
+        const auto realDigits = Get<std::uint8_t>();
+        if ((isFloatingPoint != std::is_floating_point<Real>::value) ||
+            (realSize != sizeof(Real)) ||
+            (realDigits != std::numeric_limits<Real>::digits))
+        {
+            throw InvalidArgument("Deserialize: data written with a different Real type");
+        }
+        m_hasContacts = (Get<std::uint8_t>() & e_hasContactsFlag) != 0;
+    }
+
+    template <typename T>
+    T& ReadShapeBase(T& conf)
+    {
+        conf.UseFriction(NonNegative<Real>(GetReal()));
+        conf.UseRestitution(Finite<Real>(GetReal()));
+        conf.UseDensity(NonNegative<AreaDensity>(GetReal() * KilogramPerSquareMeter));
+        return conf;
+    }
+
+    std::vector<Length2> ReadVertices()
+    {
+        const auto count = GetCount();
+        auto vertices = std::vector<Length2>{};
+        vertices.reserve(std::min(count, std::uint32_t{MaxShapeVertices}));
+        for (auto i = std::uint32_t{0}; i < count; ++i)
+        {
+            vertices.push_back(GetLength2());
+        }
+        return vertices;
+    }
+
+    Shape ReadShape()
+    {
+        switch (static_cast<ShapeTag>(Get<std::uint8_t>()))
+        {
+            case ShapeTag::Disk:
+            {
+                auto conf = DiskShapeConf{};
+                ReadShapeBase(conf);
+                conf.UseRadius(NonNegative<Length>(GetReal() * Meter));
+                conf.UseLocation(GetLength2());
+                return Shape{conf};
+            }
+            case ShapeTag::Edge:
+            {
+                auto conf = EdgeShapeConf{};
+                ReadShapeBase(conf);
+                conf.UseVertexRadius(NonNegative<Length>(GetReal() * Meter));
+                const auto vA = GetLength2();
+                const auto vB = GetLength2();
+                conf.Set(vA, vB);
+                return Shape{conf};
+            }
+            case ShapeTag::Polygon:
+            {
+                auto conf = PolygonShapeConf{};
+                ReadShapeBase(conf);
+                conf.UseVertexRadius(NonNegative<Length>(GetReal() * Meter));
+                const auto vertices = ReadVertices();
+                conf.Set(Span<const Length2>(data(vertices), size(vertices)));
+                return Shape{conf};
+            }
+            case ShapeTag::Chain:
+            {
+                auto conf = ChainShapeConf{};
+                ReadShapeBase(conf);
+                conf.UseVertexRadius(NonNegative<Length>(GetReal() * Meter));
+                conf.Set(ReadVertices());
+                return Shape{conf};
+            }
+            case ShapeTag::Multi:
+            {
+                auto conf = MultiShapeConf{};
+                ReadShapeBase(conf);
+                const auto count = GetCount();
+                for (auto i = std::uint32_t{0}; i < count; ++i)
+                {
+                    const auto vertexRadius = NonNegative<Length>(GetReal() * Meter);
+                    auto vertexSet = VertexSet{};
+                    for (const auto& vertex: ReadVertices())
+                    {
+                        vertexSet.add(vertex);
+                    }
+                    conf.AddConvexHull(vertexSet, vertexRadius);
+                }
+                return Shape{conf};
+            }
+            case ShapeTag::HeightField:
+            {
+                auto conf = HeightFieldShapeConf{};
+                ReadShapeBase(conf);
+                conf.UseVertexRadius(NonNegative<Length>(GetReal() * Meter));
+                const auto cellWidth = Positive<Length>(GetReal() * Meter);
+                conf.UseOrigin(GetLength2());
+                const auto count = GetCount();
+                auto heights = std::vector<Length>{};
+                heights.reserve(std::min(count, std::uint32_t{StreamChunkSize}));
+                for (auto i = std::uint32_t{0}; i < count; ++i)
+                {
+                    heights.push_back(GetReal() * Meter);
+                }
+                conf.Set(cellWidth, heights);
+                return Shape{conf};
+            }
+        }
+        throw InvalidArgument("Deserialize: unknown shape type");
+    }
+
+    void ReadShapes()
+    {
+        const auto count = GetCount();
+        m_shapes.reserve(std::min(count, std::uint32_t{StreamChunkSize}));
+        for (auto i = std::uint32_t{0}; i < count; ++i)
+        {
+            m_shapes.push_back(ReadShape());
+        }
+    }
+
+    void ReadBodies()
+    {
+        const auto count = GetCount();
+        m_bodies.reserve(std::min(count, std::uint32_t{MaxBodies}));
+        for (auto i = std::uint32_t{0}; i < count; ++i)
+        {
+            auto conf = BodyConf{};
+            const auto type = Get<std::uint8_t>();
+            if (type > static_cast<std::uint8_t>(BodyType::Dynamic))
+            {
+                throw InvalidArgument("Deserialize: invalid body type");
+            }
+            conf.type = static_cast<BodyType>(type);
+            conf.location = GetLength2();
+            conf.angle = GetReal() * Radian;
+            const auto vx = GetReal();
+            const auto vy = GetReal();
+            conf.linearVelocity = LinearVelocity2{vx * MeterPerSecond, vy * MeterPerSecond};
+            conf.angularVelocity = GetReal() * RadianPerSecond;
+            const auto ax = GetReal();
+            const auto ay = GetReal();
+            conf.linearAcceleration = LinearAcceleration2{
+                ax * MeterPerSquareSecond, ay * MeterPerSquareSecond
+            };
+            conf.angularAcceleration = GetReal() * RadianPerSquareSecond;
+            conf.linearDamping = NonNegative<Frequency>(GetReal() * Hertz);
+            conf.angularDamping = NonNegative<Frequency>(GetReal() * Hertz);
+            conf.underActiveTime = GetReal() * Second;
+            const auto flags = Get<std::uint8_t>();
+            conf.allowSleep = (flags & e_allowSleepFlag) != 0;
+            conf.awake = (flags & e_awakeFlag) != 0;
+            conf.fixedRotation = (flags & e_fixedRotationFlag) != 0;
+            conf.bullet = (flags & e_bulletFlag) != 0;
+            conf.enabled = (flags & e_enabledFlag) != 0;
+
+            const auto mass = GetReal() * Kilogram;
+            const auto rotInertia = GetReal() * Kilogram * SquareMeter / SquareRadian;
+            const auto localCenter = GetLength2();
+
+            const auto body = m_world.CreateBody(conf);
+            m_bodies.push_back(body);
+            m_awake.push_back(conf.awake);
+
+            const auto fixtureCount = GetCount();
+            for (auto j = std::uint32_t{0}; j < fixtureCount; ++j)
+            {
+                const auto shapeIndex = Get<std::uint32_t>();
+                if (shapeIndex >= size(m_shapes))
+                {
+                    throw InvalidArgument("Deserialize: invalid shape index");
+                }
+                auto fixtureConf = FixtureConf{};
+                fixtureConf.isSensor = GetBool();
+                fixtureConf.filter.categoryBits = Get<Filter::bits_type>();
+                fixtureConf.filter.maskBits = Get<Filter::bits_type>();
+                fixtureConf.filter.groupIndex = Get<Filter::index_type>();
+                fixtureConf.singleProxy = (m_version >= 2)? GetBool(): false;
+                m_fixtures.push_back(body->CreateFixture(m_shapes[shapeIndex], fixtureConf,
+                                                         false));
+            }
+
+            if (body->IsAccelerable())
+            {
+                // Setting the mass data moves the center of mass and adjusts the velocity
+                // for that, so restore the velocity afterwards.
+                const auto velocity = body->GetVelocity();
+                body->SetMassData(MassData{
+                    localCenter,
+                    NonNegative<Mass>(mass),
+                    NonNegative<RotInertia>(rotInertia
+                                            + mass * GetMagnitudeSquared(localCenter) / SquareRadian)
+                });
+                body->SetVelocity(velocity);
+            }
+        }
+    }
+
+    template <typename T>
+    Joint* CreateJoint(T& def, Body* bodyA, Body* bodyB, bool collideConnected)
+    {
+        def.bodyA = bodyA;
+        def.bodyB = bodyB;
+        def.collideConnected = collideConnected;
+        return m_world.CreateJoint(def);
+    }
+
+    Joint* ReadJoint()
+    {
+        const auto type = static_cast<JointType>(Get<std::uint8_t>());
+        const auto bodyA = GetBody();
+        const auto bodyB = GetBody();
+        const auto collideConnected = GetBool();
+        switch (type)
+        {
+            case JointType::Revolute:
+            {
+                auto def = RevoluteJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.referenceAngle = GetReal() * Radian;
+                def.enableLimit = GetBool();
+                def.lowerAngle = GetReal() * Radian;
+                def.upperAngle = GetReal() * Radian;
+                def.enableMotor = GetBool();
+                def.motorSpeed = GetReal() * RadianPerSecond;
+                def.maxMotorTorque = GetReal() * NewtonMeter;
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Prismatic:
+            {
+                auto def = PrismaticJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.localAxisA = GetUnitVec();
+                def.referenceAngle = GetReal() * Radian;
+                def.enableLimit = GetBool();
+                def.lowerTranslation = GetReal() * Meter;
+                def.upperTranslation = GetReal() * Meter;
+                def.enableMotor = GetBool();
+                def.maxMotorForce = GetReal() * Newton;
+                def.motorSpeed = GetReal() * RadianPerSecond;
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Distance:
+            {
+                auto def = DistanceJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.length = GetReal() * Meter;
+                def.frequency = NonNegative<Frequency>(GetReal() * Hertz);
+                def.dampingRatio = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Pulley:
+            {
+                auto def = PulleyJointConf{};
+                def.groundAnchorA = GetLength2();
+                def.groundAnchorB = GetLength2();
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.lengthA = GetReal() * Meter;
+                def.lengthB = GetReal() * Meter;
+                def.ratio = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Target:
+            {
+                auto def = TargetJointConf{};
+                def.target = GetLength2();
+                def.maxForce = NonNegative<Force>(GetReal() * Newton);
+                def.frequency = NonNegative<Frequency>(GetReal() * Hertz);
+                def.dampingRatio = NonNegative<Real>(GetReal());
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Gear:
+            {
+                const auto joint1 = GetJoint();
+                const auto joint2 = GetJoint();
+                auto def = GearJointConf{joint1, joint2};
+                def.ratio = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Wheel:
+            {
+                auto def = WheelJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.localAxisA = GetUnitVec();
+                def.enableMotor = GetBool();
+                def.maxMotorTorque = GetReal() * NewtonMeter;
+                def.motorSpeed = GetReal() * RadianPerSecond;
+                def.frequency = GetReal() * Hertz;
+                def.dampingRatio = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Weld:
+            {
+                auto def = WeldJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.referenceAngle = GetReal() * Radian;
+                def.frequency = GetReal() * Hertz;
+                def.dampingRatio = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Friction:
+            {
+                auto def = FrictionJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.maxForce = NonNegative<Force>(GetReal() * Newton);
+                def.maxTorque = NonNegative<Torque>(GetReal() * NewtonMeter);
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Rope:
+            {
+                auto def = RopeJointConf{};
+                def.localAnchorA = GetLength2();
+                def.localAnchorB = GetLength2();
+                def.maxLength = GetReal() * Meter;
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Motor:
+            {
+                auto def = MotorJointConf{};
+                def.linearOffset = GetLength2();
+                def.angularOffset = GetReal() * Radian;
+                def.maxForce = NonNegative<Force>(GetReal() * Newton);
+                def.maxTorque = NonNegative<Torque>(GetReal() * NewtonMeter);
+                def.correctionFactor = GetReal();
+                return CreateJoint(def, bodyA, bodyB, collideConnected);
+            }
+            case JointType::Unknown:
+                break;
+        }
+        throw InvalidArgument("Deserialize: unknown joint type");
+    }
+
+    void ReadJoints()
+    {
+        const auto count = GetCount();
+        m_joints.reserve(std::min(count, std::uint32_t{MaxJoints}));
+        for (auto i = std::uint32_t{0}; i < count; ++i)
+        {
+            m_joints.push_back(ReadJoint());
+        }
+    }
+
+    Manifold ReadManifold()
+    {
+        const auto type = static_cast<Manifold::Type>(Get<std::uint8_t>());
+        const auto count = Get<std::uint8_t>();
+        if (count > MaxManifoldPoints)
+        {
+            throw InvalidArgument("Deserialize: invalid manifold point count");
+        }
+        if (type == Manifold::e_unset)
+        {
+            return Manifold{};
+        }
+        const auto localNormal = GetUnitVec();
+        const auto localPoint = GetLength2();
+        auto manifold = Manifold{};
+        switch (type)
+        {
+            case Manifold::e_faceA:
+                manifold = Manifold::GetForFaceA(localNormal, localPoint);
+                break;
+            case Manifold::e_faceB:
+                manifold = Manifold::GetForFaceB(localNormal, localPoint);
+                break;
+            case Manifold::e_circles:
+            case Manifold::e_unset:
+                break;
+            default:
+                throw InvalidArgument("Deserialize: invalid manifold type");
+        }
+        for (auto i = std::uint8_t{0}; i < count; ++i)
+        {
+            auto point = Manifold::Point{};
+            point.localPoint = GetLength2();
+            point.contactFeature.typeA = static_cast<ContactFeature::Type>(Get<std::uint8_t>());
+            point.contactFeature.indexA = Get<ContactFeature::Index>();
+            point.contactFeature.typeB = static_cast<ContactFeature::Type>(Get<std::uint8_t>());
+            point.contactFeature.indexB = Get<ContactFeature::Index>();
+            point.normalImpulse = GetReal() * NewtonSecond;
+            point.tangentImpulse = GetReal() * NewtonSecond;
+            if (type == Manifold::e_circles)
+            {
+                manifold = Manifold::GetForCircles(localPoint, point.contactFeature.indexA,
+                                                   point.localPoint, point.contactFeature.indexB);
+                manifold.SetPointImpulses(0, point.normalImpulse, point.tangentImpulse);
+            }
+            else
+            {
+                manifold.AddPoint(point);
+            }
+        }
+        return manifold;
+    }
+
+    static Contact* FindContact(const Fixture& fixtureA, ChildCounter indexA,
+                                const Fixture& fixtureB, ChildCounter indexB) noexcept
+    {
+        for (auto&& ci: fixtureA.GetBody()->GetContacts())
+        {
+            const auto contact = std::get<Contact*>(ci);
+            if ((contact->GetFixtureA() == &fixtureA) && (contact->GetChildIndexA() == indexA) &&
+                (contact->GetFixtureB() == &fixtureB) && (contact->GetChildIndexB() == indexB))
+            {
+                return contact;
+            }
+            if ((contact->GetFixtureA() == &fixtureB) && (contact->GetChildIndexA() == indexB) &&
+                (contact->GetFixtureB() == &fixtureA) && (contact->GetChildIndexB() == indexA))
+            {
+                return contact;
+            }
+        }
+        return nullptr;
+    }
+
+    void ReadContacts()
+    {
+        // Read all of the contacts before changing the world any further so that bad data
+        // is detected while the world can still be restored.
+        const auto count = GetCount();
+        auto records = std::vector<ContactRecord>{};
+        records.reserve(std::min(count, std::uint32_t{StreamChunkSize}));
+        for (auto i = std::uint32_t{0}; i < count; ++i)
+        {
+            auto record = ContactRecord{};
+            record.fixtureA = GetFixture();
+            record.indexA = static_cast<ChildCounter>(Get<std::uint32_t>());
+            record.fixtureB = GetFixture();
+            record.indexB = static_cast<ChildCounter>(Get<std::uint32_t>());
+            record.flags = Get<std::uint8_t>();
+            record.friction = GetReal();
+            record.restitution = GetReal();
+            record.tangentSpeed = GetReal() * MeterPerSecond;
+            record.manifold = ReadManifold();
+            records.push_back(record);
+        }
+
+        // A zero time step creates the proxies and finds the contacts of the new fixtures
+        // without solving anything. The stored contact state is then applied on top.
+        m_world.Step(StepConf{}.SetTime(0_s));
+
+        for (const auto& record: records)
+        {
+            const auto contact = FindContact(*record.fixtureA, record.indexA,
+                                             *record.fixtureB, record.indexB);
+            if (!contact)
+            {
+                // No longer overlapping in the broad-phase so nothing to restore.
+                continue;
+            }
+            contact->SetFriction(record.friction);
+            contact->SetRestitution(record.restitution);
+            contact->SetTangentSpeed(record.tangentSpeed);
+            if ((record.flags & e_contactEnabledFlag) != 0)
+            {
+                contact->SetEnabled();
+            }
+            else
+            {
+                contact->UnsetEnabled();
+            }
+            if ((record.flags & e_contactTouchingFlag) != 0)
+            {
+                ContactAtty::SetTouching(*contact);
+            }
+            ContactAtty::GetMutableManifold(*contact) = record.manifold;
+        }
+
+        // Finding the contacts wakes the bodies, so put back the stored awake states.
+        for (auto i = std::size_t{0}; i < size(m_bodies); ++i)
+        {
+            if (!m_awake[i])
+            {
+                m_bodies[i]->UnsetAwake();
+            }
+        }
+    }
+
+    World& m_world;
+    Source& m_source;
+    bool m_littleEndian = IsLittleEndian();
+    bool m_hasContacts = false;
+    std::uint16_t m_version = 0;
+    std::vector<Shape> m_shapes;
+    std::vector<Body*> m_bodies;
+    std::vector<Fixture*> m_fixtures;
+    std::vector<Joint*> m_joints;
+    std::vector<bool> m_awake;
+
+};
+
+std::vector<std::uint8_t> Serialize(const World& world, bool withContacts)
+{
+    auto result = std::vector<std::uint8_t>{};
+    auto writer = Writer{[&](const std::uint8_t* data, std::size_t size) {
+        result.insert(end(result), data, data + size);
+    }};
+    Write(writer, world, withContacts);
+    return result;
+}
+
+void Serialize(std::ostream& os, const World& world, bool withContacts)
+{
+    auto writer = Writer{[&](const std::uint8_t* data, std::size_t size) {
+        os.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }};
+    Write(writer, world, withContacts);
+}
+
+void Deserialize(World& world, Span<const std::uint8_t> data)
+{
+    auto source = SpanSource{data};
+    WorldReader{world, source}.Read();
+}
+
+void Deserialize(World& world, std::istream& is)
+{
+    auto source = StreamSource{is};
+    WorldReader{world, source}.Read();
+}
+
+} // namespace d2
+} // namespace playrho
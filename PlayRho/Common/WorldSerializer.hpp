@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_COMMON_WORLDSERIALIZER_HPP
+#define PLAYRHO_COMMON_WORLDSERIALIZER_HPP
+
+/// @file
+/// Declarations of the compact binary world serialization functions.
+
+#include <PlayRho/Common/Settings.hpp>
+#include <PlayRho/Common/Span.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace playrho {
+namespace d2 {
+
+    class World;
+
+    /// @brief Version of the binary world format written by <code>Serialize</code>.
+    /// @details Readers accept data of this version or older. Version 2 added the
+    ///   fixtures' single proxy setting and height field shapes.
+    PLAYRHO_CONSTEXPR const auto WorldFormatVersion = std::uint16_t{2};
+
+    /// @brief Serializes the given world into a compact binary format.
+    ///
+    /// @details The data starts with a small header identifying the format, its version,
+    ///   and the <code>Real</code> type the library was built with. This is followed by
+    ///   a table of shapes &mdash; where shapes shared by multiple fixtures are stored
+    ///   only once &mdash; then by the bodies with their fixtures, the joints and,
+    ///   optionally, the contacts.
+    ///
+    /// @note Values are stored in little-endian byte order regardless of the platform.
+    /// @note User data pointers and joint impulses are not stored.
+    /// @warning This should be called outside of a time step.
+    ///
+    /// @param world World to serialize.
+    /// @param withContacts Whether or not to also store the contacts. Contacts store the
+    ///   manifolds and impulses needed to warm start the first step after loading.
+    ///
+    /// @throws InvalidArgument if the world uses a shape type that's not serializable.
+    ///
+    /// @sa Deserialize.
+    ///
+    std::vector<std::uint8_t> Serialize(const World& world, bool withContacts = false);
+
+    /// @brief Serializes the given world to the given output stream.
+    /// @details Writes the same data as <code>Serialize(const World&, bool)</code>
+    ///   without first buffering all of it in memory.
+    /// @throws InvalidArgument if the world uses a shape type that's not serializable.
+    void Serialize(std::ostream& os, const World& world, bool withContacts = false);
+
+    /// @brief Deserializes the given data into the given world.
+    ///
+    /// @details Creates the stored bodies, fixtures, joints and contacts in the given world.
+    ///   The data is read in place, so this works with data from a memory-mapped file.
+    ///
+    /// @note The given world is added to rather than cleared first.
+    /// @note When contacts were stored, this steps the world by zero time to create the
+    ///   broad-phase proxies and the contacts for the loaded fixtures.
+    /// @note All of the data is read and checked before the world is stepped. Whatever was
+    ///   created in the world is destroyed again if this throws, so bad data leaves the
+    ///   given world as it was.
+    ///
+    /// @throws InvalidArgument if the data is not in the expected format, is of a newer
+    ///   version, was written with a different <code>Real</code> type, or is truncated.
+    /// @throws WrongState if the world is locked.
+    ///
+    /// @sa Serialize.
+    ///
+    void Deserialize(World& world, Span<const std::uint8_t> data);
+
+    /// @brief Deserializes the data from the given input stream into the given world.
+    /// @details Reads the stream in fixed size chunks as the data is parsed so that
+    ///   large worlds can be loaded without reading everything into memory first.
+    /// @note This leaves the given world as it was if this throws, like
+    ///   <code>Deserialize(World&, Span<const std::uint8_t>)</code> does.
+    /// @throws InvalidArgument if the data is not in the expected format, is of a newer
+    ///   version, was written with a different <code>Real</code> type, or is truncated.
+    /// @throws WrongState if the world is locked.
+    void Deserialize(World& world, std::istream& is);
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_COMMON_WORLDSERIALIZER_HPP
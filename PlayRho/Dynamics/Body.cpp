@@ -116,6 +116,18 @@ Fixture* Body::CreateFixture(const Shape& shape, const FixtureConf& def,
     return WorldAtty::CreateFixture(*m_world, *this, shape, def, resetMassData);
 }
 
+void Body::CreateFixtures(Span<const Shape> shapes, const FixtureConf& def, bool resetMassData)
+{
+    for (auto&& shape: shapes)
+    {
+        WorldAtty::CreateFixture(*m_world, *this, shape, def, false);
+    }
+    if (resetMassData && IsMassDataDirty())
+    {
+        ResetMassData();
+    }
+}
+
 bool Body::Destroy(Fixture* fixture, bool resetMassData)
 {
     if (fixture->GetBody() != this)
@@ -306,6 +318,20 @@ void Body::SetTransform(Length2 location, Angle angle)
     WorldAtty::RegisterForProxies(*GetWorld(), *this);
 }
 
+void Body::WakeIsland() noexcept
+{
+    WorldAtty::AddAwakeBody(*m_world, *this);
+    for (auto body = std::exchange(m_nextInIsland, nullptr); body && (body != this);)
+    {
+        assert(body->IsSpeedable());
+        assert(!body->IsAwake());
+        body->m_flags |= e_awakeFlag;
+        WorldAtty::AddAwakeBody(*m_world, *body);
+        body = std::exchange(body->m_nextInIsland, nullptr);
+    }
+    WorldAtty::SetWokenBodies(*m_world);
+}
+
 void Body::SetEnabled(bool flag)
 {
     if (IsEnabled() == flag)
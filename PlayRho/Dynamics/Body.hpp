@@ -129,6 +129,10 @@ public:
         
         /// @brief Mass Data Dirty Flag.
         e_massDataDirtyFlag = FlagsType(0x0200),
+        
+        /// @brief Awake listed flag.
+        /// @details Indicates the body is in its world's list of awake bodies.
+        e_awakeListedFlag = FlagsType(0x0400),
     };
     
     /// @brief Gets the flags for the given value.
@@ -172,6 +176,24 @@ public:
                            const FixtureConf& def = GetDefaultFixtureConf(),
                            bool resetMassData = true);
 
+    /// @brief Creates fixtures of the given shapes and attaches them to this body.
+    /// @details Creates a fixture for each of the given shapes as though by calls to
+    ///   <code>CreateFixture(const Shape&, const FixtureConf&, bool)</code> but with
+    ///   the mass data reset at most once.
+    /// @note This function should not be called if the world is locked.
+    /// @param shapes Shapes to create fixtures for.
+    /// @param def Fixture settings to create the fixtures with.
+    /// @param resetMassData Whether or not to reset the mass data of the body.
+    /// @throws WrongState if called while the world is "locked".
+    /// @throws InvalidArgument if called for a shape with a vertex radius less than the
+    ///    minimum vertex radius or more than the maximum vertex radius. The fixtures of
+    ///    any earlier shapes are still created then.
+    /// @sa CreateFixture, GetFixtures
+    /// @sa PhysicalEntities
+    void CreateFixtures(Span<const Shape> shapes,
+                        const FixtureConf& def = GetDefaultFixtureConf(),
+                        bool resetMassData = true);
+
     /// @brief Destroys a fixture.
     ///
     /// @details Destroys a fixture previously created by the
@@ -473,11 +495,26 @@ private:
     /// @brief Unsets this body to the is-in-island state.
     void UnsetIslandedFlag() noexcept;
     
+    /// @brief Whether this body is in its world's list of awake bodies.
+    bool IsAwakeListed() const noexcept;
+    
+    /// @brief Sets this body to the awake listed state.
+    void SetAwakeListedFlag() noexcept;
+    
+    /// @brief Unsets this body from the awake listed state.
+    void UnsetAwakeListedFlag() noexcept;
+    
     /// @brief Sets the body's awake flag.
-    /// @details This is done unconditionally.
+    /// @details This is done unconditionally. Setting this for a sleeping body also wakes
+    ///   the rest of the sleeping island the body was put to sleep with.
     /// @note This should **not** be called unless the body is "speedable".
     /// @warning Behavior is undefined if called for a body that is not "speedable".
     void SetAwakeFlag() noexcept;
+    
+    /// @brief Wakes the rest of the sleeping island this body is in and lets the world
+    ///   know that bodies were woken.
+    /// @details The woken bodies are added to the world's list of awake bodies.
+    void WakeIsland() noexcept;
 
     /// @brief Unsets the body's awake flag.
     void UnsetAwakeFlag() noexcept;
@@ -546,6 +583,12 @@ private:
     LinearAcceleration2 m_linearAcceleration = LinearAcceleration2{};
 
     World* const m_world; ///< World to which this body belongs. 8-bytes.
+    
+    /// @brief Next body of the sleeping island this body is in.
+    /// @details The bodies of an island put to sleep together are linked into a ring so
+    ///   that waking any one of them wakes all of them without searching for the others.
+    ///   This is null for awake bodies. 8-bytes.
+    Body* m_nextInIsland = nullptr;
     void* m_userData; ///< User data. 8-bytes.
     
     Fixtures m_fixtures; ///< Container of fixtures.
@@ -691,7 +734,11 @@ inline void Body::SetAwakeFlag() noexcept
     // Protect the body's invariant that only "speedable" bodies can be awake.
     assert(IsSpeedable());
 
-    m_flags |= e_awakeFlag;
+    if ((m_flags & e_awakeFlag) == 0)
+    {
+        m_flags |= e_awakeFlag;
+        WakeIsland();
+    }
 }
 
 inline void Body::UnsetAwakeFlag() noexcept
@@ -884,6 +931,21 @@ inline void Body::UnsetIslandedFlag() noexcept
     m_flags &= ~e_islandFlag;
 }
 
+inline bool Body::IsAwakeListed() const noexcept
+{
+    return (m_flags & e_awakeListedFlag) != 0;
+}
+
+inline void Body::SetAwakeListedFlag() noexcept
+{
+    m_flags |= e_awakeListedFlag;
+}
+
+inline void Body::UnsetAwakeListedFlag() noexcept
+{
+    m_flags &= ~e_awakeListedFlag;
+}
+
 // Free functions...
 
 /// @brief Gets the given body's acceleration.
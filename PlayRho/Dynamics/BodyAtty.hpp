@@ -122,6 +122,19 @@ private:
         b.SetAwakeFlag();
     }
     
+    /// @brief Gets the next body of the sleeping island the given body is in, if any.
+    static Body* GetNextInIsland(const Body& b) noexcept
+    {
+        return b.m_nextInIsland;
+    }
+    
+    /// @brief Sets the next body of the sleeping island the given body is in.
+    /// @note Bodies of a sleeping island must form a ring.
+    static void SetNextInIsland(Body& b, Body* value) noexcept
+    {
+        b.m_nextInIsland = value;
+    }
+    
     /// @brief Sets the mass data dirty flag for the given body.
     static void SetMassDataDirty(Body& b) noexcept
     {
@@ -298,6 +311,24 @@ private:
         b.UnsetIslandedFlag();
     }
     
+    /// @brief Whether the given body is in its world's list of awake bodies.
+    static bool IsAwakeListed(const Body& b) noexcept
+    {
+        return b.IsAwakeListed();
+    }
+    
+    /// @brief Sets the given body to the awake listed state.
+    static void SetAwakeListed(Body& b) noexcept
+    {
+        b.SetAwakeListedFlag();
+    }
+    
+    /// @brief Unsets the given body's awake listed state.
+    static void UnsetAwakeListed(Body& b) noexcept
+    {
+        b.UnsetAwakeListedFlag();
+    }
+    
     friend class World;
 };
 
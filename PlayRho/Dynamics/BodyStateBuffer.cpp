@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Dynamics/BodyStateBuffer.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace playrho {
+namespace d2 {
+
+void BodyStateBuffer::Write(const World& world, Time deltaTime)
+{
+    auto& frame = m_frames[m_back];
+    frame.states.clear();
+    m_nextPositions.clear();
+    
+    // Bodies keep their relative order in the world and new bodies are added at the end,
+    // so the previous positions are found by walking the last positions alongside.
+    auto last = cbegin(m_positions);
+    for (auto&& b: world.GetBodies())
+    {
+        const auto& body = GetRef(b);
+        const auto position = body.GetSweep().pos1;
+        const auto found = std::find_if(last, cend(m_positions), [&](const auto& entry) {
+            return entry.first == &body;
+        });
+        auto previous = position;
+        if (found != cend(m_positions))
+        {
+            previous = found->second;
+            last = std::next(found);
+        }
+        frame.states.push_back(BodyState{&body, body.GetTransformation(), body.GetVelocity(),
+            position, previous, body.GetLocalCenter()});
+        m_nextPositions.emplace_back(&body, position);
+    }
+    std::swap(m_positions, m_nextPositions);
+    
+    frame.sequence = ++m_sequence;
+    frame.deltaTime = deltaTime;
+    m_back = m_middle.exchange(m_back | FreshFlag, std::memory_order_acq_rel) & IndexMask;
+}
+
+const BodyStateBuffer::Frame& BodyStateBuffer::Acquire() noexcept
+{
+    if ((m_middle.load(std::memory_order_relaxed) & FreshFlag) != 0u)
+    {
+        m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+    }
+    return m_frames[m_front];
+}
+
+} // namespace d2
+} // namespace playrho
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_DYNAMICS_BODYSTATEBUFFER_HPP
+#define PLAYRHO_DYNAMICS_BODYSTATEBUFFER_HPP
+
+/// @file
+/// Declarations of the BodyStateBuffer class and related free functions.
+
+#include <PlayRho/Common/Math.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace playrho {
+namespace d2 {
+
+class Body;
+class World;
+
+/// @brief Published state of a body.
+struct BodyState
+{
+    /// @brief Body the state is of.
+    /// @warning This is only for identifying the body. It's not safe to dereference from
+    ///   threads other than the one stepping the world.
+    const Body* body;
+    
+    Transformation transformation; ///< Transformation of the body.
+    Velocity velocity; ///< Velocity of the body.
+    Position position; ///< Position of the body's center of mass.
+    Position previous; ///< Position of the body's center of mass as of the previous frame.
+    Length2 localCenter; ///< Local center of mass of the body.
+};
+
+/// @brief Body state buffer.
+///
+/// @details Triple buffer of the states of the bodies of a world for reading from another
+///   thread, like a render thread, while the world keeps stepping. Set one through
+///   <code>WorldConf::UseBodyStateBuffer</code> to have a world write its bodies' states
+///   into it at the end of every step.
+///
+/// @note Writing and acquiring are lock-free and never wait on each other. Once the
+///   buffers have grown to the number of bodies, neither allocates memory.
+/// @note Only one thread at a time may write, and only one thread at a time may acquire.
+///
+/// @sa WorldConf::bodyStateBuffer
+///
+class BodyStateBuffer
+{
+public:
+    /// @brief Frame of body states.
+    struct Frame
+    {
+        std::vector<BodyState> states; ///< States of the bodies in world order.
+        std::uint64_t sequence = 0; ///< Number of the frame. Zero if nothing written yet.
+        Time deltaTime = 0_s; ///< Time stepped since the previous frame.
+    };
+    
+    /// @brief Writes the states of the given world's bodies as the latest frame.
+    /// @details Each state's previous position is the position of its body in the
+    ///   previously written frame, or the body's current position if the body is new.
+    /// @param world World to write the body states of.
+    /// @param deltaTime Time stepped since the previous frame.
+    void Write(const World& world, Time deltaTime);
+    
+    /// @brief Acquires the latest written frame for reading.
+    /// @return Frame that stays unchanged until the next call to this method.
+    const Frame& Acquire() noexcept;
+    
+private:
+    /// @brief Flag in the middle buffer index of the middle frame being newer than the
+    ///   acquired one.
+    static PLAYRHO_CONSTEXPR const auto FreshFlag = 0x4u;
+    
+    /// @brief Mask of the buffer index of the middle value.
+    static PLAYRHO_CONSTEXPR const auto IndexMask = 0x3u;
+    
+    std::array<Frame, 3> m_frames; ///< Frames.
+    std::atomic<unsigned> m_middle{0u}; ///< Index of the frame between writing and reading.
+    unsigned m_back = 1u; ///< Index of the frame to write. Only used by the writer.
+    unsigned m_front = 2u; ///< Index of the acquired frame. Only used by the acquirer.
+    std::uint64_t m_sequence = 0; ///< Number of the last written frame.
+    
+    /// @brief Bodies and their positions as of the last written frame.
+    /// @note Only used by the writer.
+    std::vector<std::pair<const Body*, Position>> m_positions;
+    
+    /// @brief Bodies and their positions as of the frame being written.
+    std::vector<std::pair<const Body*, Position>> m_nextPositions;
+};
+
+/// @brief Gets the transformation of the given state's body interpolated between its
+///   previous and current positions.
+/// @param state State to get the transformation of.
+/// @param beta Unit interval of travel between the previous position at 0 and the current
+///   position at 1.
+/// @relatedalso BodyState
+inline Transformation GetTransformation(const BodyState& state, Real beta) noexcept
+{
+    return GetTransformation(GetPosition(state.previous, state.position, beta),
+                             state.localCenter);
+}
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_DYNAMICS_BODYSTATEBUFFER_HPP
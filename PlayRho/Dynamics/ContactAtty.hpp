@@ -32,7 +32,8 @@ namespace d2 {
 /// @brief Contact attorney.
 ///
 /// @details This is the "contact attorney" which provides limited privileged access to the
-///   Contact class for the World class.
+///   Contact class for the World class (and for the WorldReader class that restores
+///   contacts from serialized data).
 ///
 /// @note This class uses the "attorney-client" idiom to control the granularity of
 ///   friend-based access to the Contact class. This is meant to help preserve and enforce
@@ -56,6 +57,12 @@ private:
         to.m_flags = from.m_flags;
     }
 
+    /// @brief Sets the given contact's touching state.
+    static void SetTouching(Contact& c) noexcept
+    {
+        c.SetTouching();
+    }
+
     /// @brief Calls the contact's set TOI method.
     static void SetToi(Contact& c, Real value) noexcept
     {
@@ -117,6 +124,7 @@ private:
     }
     
     friend class World;
+    friend class WorldReader;
 };
 
 } // namespace d2
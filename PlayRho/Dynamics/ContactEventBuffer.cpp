@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Dynamics/ContactEventBuffer.hpp>
+#include <PlayRho/Dynamics/Contacts/Contact.hpp>
+
+#include <iterator>
+
+namespace playrho {
+namespace d2 {
+
+namespace {
+
+inline ContactEvent GetContactEvent(const Contact& contact) noexcept
+{
+    return ContactEvent{
+        contact.GetFixtureA(), contact.GetFixtureB(),
+        contact.GetChildIndexA(), contact.GetChildIndexB()
+    };
+}
+
+inline ContactEvent GetContactEvent(const SensorOverlap& overlap) noexcept
+{
+    return ContactEvent{overlap.sensor, overlap.other, overlap.sensorChild, overlap.otherChild};
+}
+
+} // anonymous namespace
+
+void ContactEventBuffer::AddBegin(const Contact& contact)
+{
+    m_begins.push_back(GetContactEvent(contact));
+}
+
+void ContactEventBuffer::AddEnd(const Contact& contact)
+{
+    m_ends.push_back(GetContactEvent(contact));
+}
+
+void ContactEventBuffer::AddImpulses(const Contact& contact, const ContactImpulsesList& impulses,
+                                     TimestepIters solved)
+{
+    m_impulses.push_back(ContactImpulsesEvent{GetContactEvent(contact), impulses, solved});
+}
+
+void ContactEventBuffer::AddSensorEnter(const SensorOverlap& overlap)
+{
+    m_sensorEnters.push_back(GetContactEvent(overlap));
+}
+
+void ContactEventBuffer::AddSensorExit(const SensorOverlap& overlap)
+{
+    m_sensorExits.push_back(GetContactEvent(overlap));
+}
+
+void ContactEventBuffer::Append(const ContactEventBuffer& other)
+{
+    m_begins.insert(end(m_begins), cbegin(other.m_begins), cend(other.m_begins));
+    m_ends.insert(end(m_ends), cbegin(other.m_ends), cend(other.m_ends));
+    m_impulses.insert(end(m_impulses), cbegin(other.m_impulses), cend(other.m_impulses));
+    m_sensorEnters.insert(end(m_sensorEnters), cbegin(other.m_sensorEnters),
+                          cend(other.m_sensorEnters));
+    m_sensorExits.insert(end(m_sensorExits), cbegin(other.m_sensorExits),
+                         cend(other.m_sensorExits));
+}
+
+} // namespace d2
+} // namespace playrho
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_DYNAMICS_CONTACTEVENTBUFFER_HPP
+#define PLAYRHO_DYNAMICS_CONTACTEVENTBUFFER_HPP
+
+/// @file
+/// Declarations of the ContactEventBuffer class and its event records.
+
+#include <PlayRho/Common/Span.hpp>
+#include <PlayRho/Dynamics/ContactImpulsesList.hpp>
+#include <PlayRho/Dynamics/SensorOverlap.hpp>
+
+#include <vector>
+
+namespace playrho {
+namespace d2 {
+
+class Contact;
+class Fixture;
+
+/// @brief Contact event.
+/// @details Record of a contact beginning or ending to touch, or of a sensor overlap
+///   being entered or exited. For sensor overlaps, fixture A is the sensor.
+/// @warning The fixture pointers are only for identifying the fixtures. They're not safe
+///   to dereference if the fixtures have been destroyed since the event was recorded.
+struct ContactEvent
+{
+    Fixture* fixtureA; ///< Fixture A of the contact.
+    Fixture* fixtureB; ///< Fixture B of the contact.
+    ChildCounter childIndexA; ///< Child index of fixture A's shape.
+    ChildCounter childIndexB; ///< Child index of fixture B's shape.
+};
+
+/// @brief Contact impulses event.
+/// @details Record of the impulses the regular or TOI solver applied for a touching contact.
+struct ContactImpulsesEvent
+{
+    ContactEvent contact; ///< Contact the impulses were applied for.
+    ContactImpulsesList impulses; ///< Impulses applied for the contact's manifold points.
+    
+    /// @brief Position iterations done.
+    /// @details Or <code>StepConf::InvalidIteration</code> if the island wasn't solved.
+    TimestepIters solved;
+};
+
+/// @brief Contact event buffer.
+///
+/// @details Per-step arrays of plain contact event records for a world to append to in
+///   place of calling the virtual methods of a <code>ContactListener</code>. Set one
+///   through <code>World::SetContactEventBuffer</code> and drain it after stepping.
+///
+/// @note Events are appended in the order the world came upon them. Worlds stepping with
+///   a task scheduler record events of parallel work into separate buffers which are
+///   appended afterwards in the order of the work, so the order doesn't depend on how
+///   the work got scheduled.
+/// @note Events keep accumulating until cleared. Clearing keeps the memory of the arrays.
+/// @note Sensor overlap events are only recorded by worlds tracking sensor overlaps.
+/// @note There's no equivalent of <code>ContactListener::PreSolve</code> since that's
+///   for changing contacts before they're solved.
+///
+/// @sa World::SetContactEventBuffer
+///
+class ContactEventBuffer
+{
+public:
+    
+    /// @brief Appends a begin contact event for the given contact.
+    void AddBegin(const Contact& contact);
+    
+    /// @brief Appends an end contact event for the given contact.
+    void AddEnd(const Contact& contact);
+    
+    /// @brief Appends a contact impulses event for the given contact.
+    void AddImpulses(const Contact& contact, const ContactImpulsesList& impulses,
+                     TimestepIters solved);
+    
+    /// @brief Appends a sensor enter event for the given overlap.
+    void AddSensorEnter(const SensorOverlap& overlap);
+    
+    /// @brief Appends a sensor exit event for the given overlap.
+    void AddSensorExit(const SensorOverlap& overlap);
+    
+    /// @brief Appends the events of the given buffer to this one.
+    void Append(const ContactEventBuffer& other);
+    
+    /// @brief Clears the events of this buffer.
+    void Clear() noexcept;
+    
+    /// @brief Whether this buffer has no events.
+    bool IsEmpty() const noexcept;
+    
+    /// @brief Gets the events of contacts that began touching.
+    Span<const ContactEvent> GetBeginEvents() const noexcept;
+    
+    /// @brief Gets the events of contacts that stopped touching or that were destroyed
+    ///   while touching.
+    Span<const ContactEvent> GetEndEvents() const noexcept;
+    
+    /// @brief Gets the events of the impulses applied to touching contacts.
+    Span<const ContactImpulsesEvent> GetImpulsesEvents() const noexcept;
+    
+    /// @brief Gets the events of sensor overlaps that were entered.
+    /// @sa WorldConf::sensorOverlaps
+    Span<const ContactEvent> GetSensorEnterEvents() const noexcept;
+    
+    /// @brief Gets the events of sensor overlaps that were exited or whose fixtures were
+    ///   destroyed.
+    /// @sa WorldConf::sensorOverlaps
+    Span<const ContactEvent> GetSensorExitEvents() const noexcept;
+    
+private:
+    std::vector<ContactEvent> m_begins; ///< Begin contact events.
+    std::vector<ContactEvent> m_ends; ///< End contact events.
+    std::vector<ContactImpulsesEvent> m_impulses; ///< Contact impulses events.
+    std::vector<ContactEvent> m_sensorEnters; ///< Sensor enter events.
+    std::vector<ContactEvent> m_sensorExits; ///< Sensor exit events.
+};
+
+inline void ContactEventBuffer::Clear() noexcept
+{
+    m_begins.clear();
+    m_ends.clear();
+    m_impulses.clear();
+    m_sensorEnters.clear();
+    m_sensorExits.clear();
+}
+
+inline bool ContactEventBuffer::IsEmpty() const noexcept
+{
+    return empty(m_begins) && empty(m_ends) && empty(m_impulses)
+        && empty(m_sensorEnters) && empty(m_sensorExits);
+}
+
+inline Span<const ContactEvent> ContactEventBuffer::GetBeginEvents() const noexcept
+{
+    return Span<const ContactEvent>(data(m_begins), size(m_begins));
+}
+
+inline Span<const ContactEvent> ContactEventBuffer::GetEndEvents() const noexcept
+{
+    return Span<const ContactEvent>(data(m_ends), size(m_ends));
+}
+
+inline Span<const ContactImpulsesEvent> ContactEventBuffer::GetImpulsesEvents() const noexcept
+{
+    return Span<const ContactImpulsesEvent>(data(m_impulses), size(m_impulses));
+}
+
+inline Span<const ContactEvent> ContactEventBuffer::GetSensorEnterEvents() const noexcept
+{
+    return Span<const ContactEvent>(data(m_sensorEnters), size(m_sensorEnters));
+}
+
+inline Span<const ContactEvent> ContactEventBuffer::GetSensorExitEvents() const noexcept
+{
+    return Span<const ContactEvent>(data(m_sensorExits), size(m_sensorExits));
+}
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_DYNAMICS_CONTACTEVENTBUFFER_HPP
@@ -50,11 +50,27 @@ inline DistanceConf GetDistanceConf(const playrho::StepConf& conf)
     distanceConf.maxIterations = conf.maxDistanceIters;
     return distanceConf;
 }
+
+/// @brief Gets the largest distance of the given child's outline from the given center.
+inline Length GetMaxRadius(const DistanceProxy& child, Length2 center) noexcept
+{
+    auto maxRadius = 0_m;
+    for (const auto& vertex: child.GetVertices())
+    {
+        maxRadius = std::max(maxRadius, Length{GetMagnitude(vertex - center)});
+    }
+    return maxRadius + child.GetVertexRadius();
+}
+
 } // namespace
 
 Contact::UpdateConf Contact::GetUpdateConf(const playrho::StepConf& conf) noexcept
 {
-    return UpdateConf{GetDistanceConf(conf), GetManifoldConf(conf)};
+    auto updateConf = UpdateConf{GetDistanceConf(conf), GetManifoldConf(conf)};
+    updateConf.linearCoherence = conf.linearCoherenceTolerance;
+    updateConf.angularCoherenceSine = sin(Real{conf.angularCoherenceTolerance / Radian});
+    updateConf.speculativeTime = conf.doSpeculative? conf.GetTime(): 0_s;
+    return updateConf;
 }
 
 Contact::Contact(Fixture* fA, ChildCounter iA, Fixture* fB, ChildCounter iB):
@@ -109,10 +125,34 @@ void Contact::Update(const UpdateConf& conf, ContactListener* listener)
         
         // Sensors don't generate manifolds.
         m_manifold = Manifold{};
+        m_flags &= ~e_coherentFlag;
+    }
+    else if (IsCoherent(conf, MulT(xfA, xfB)))
+    {
+        // Relative motion since the manifold was calculated is within the coherence
+        // tolerances so the manifold (and its warm starting impulses) gets reused as is.
+        // Its points are in local coordinates so the solvers still see the new separations.
+        newTouching = oldManifold.GetPointCount() > 0;
     }
     else
     {
-        auto newManifold = CollideShapes(childA, xfA, childB, xfB, conf.manifold);
+        auto manifoldConf = conf.manifold;
+        if (conf.speculativeTime != 0_s)
+        {
+            // Bound the speed of any point of the children towards each other by their
+            // relative linear speed plus how fast either child sweeps about its body's center.
+            const auto bodyA = fixtureA->GetBody();
+            const auto bodyB = fixtureB->GetBody();
+            const auto velA = bodyA->GetVelocity();
+            const auto velB = bodyB->GetVelocity();
+            const auto radiusA = GetMaxRadius(childA, bodyA->GetLocalCenter());
+            const auto radiusB = GetMaxRadius(childB, bodyB->GetLocalCenter());
+            const auto speed = GetMagnitude(velB.linear - velA.linear)
+                             + abs(velA.angular) * radiusA / Radian
+                             + abs(velB.angular) * radiusB / Radian;
+            manifoldConf.speculativeDistance = speed * conf.speculativeTime;
+        }
+        auto newManifold = CollideShapes(childA, xfA, childB, xfB, manifoldConf);
 
         const auto old_point_count = oldManifold.GetPointCount();
         const auto new_point_count = newManifold.GetPointCount();
@@ -124,7 +164,7 @@ void Contact::Update(const UpdateConf& conf, ContactListener* listener)
         const auto tolerance = OVERLAP_TOLERANCE;
         const auto overlapping = TestOverlap(childA, xfA, childB, xfB, conf.distance);
         assert(newTouching == (overlapping >= 0_m2) ||
-               abs(overlapping) < tolerance);
+               abs(overlapping) < tolerance || manifoldConf.speculativeDistance != 0_m);
 #endif
 #endif
         // Match old contact ids to new contact ids and copy the stored impulses to warm
@@ -171,6 +211,8 @@ void Contact::Update(const UpdateConf& conf, ContactListener* listener)
         //assert(newManifold != oldManifold);
 
         m_manifold = newManifold;
+        m_coherentXf = MulT(xfA, xfB);
+        m_flags |= e_coherentFlag;
 
 #ifdef MAKE_CONTACT_PROCESSING_ORDER_DEPENDENT
         const auto bodyA = fixtureA->GetBody();
@@ -222,6 +264,25 @@ void Contact::Update(const UpdateConf& conf, ContactListener* listener)
     }
 }
 
+bool Contact::IsCoherent(const UpdateConf& conf, const Transformation& xf) const noexcept
+{
+    if (((m_flags & e_coherentFlag) == 0) || (m_manifold.GetPointCount() == 0))
+    {
+        return false;
+    }
+    if ((conf.linearCoherence <= 0_m) && (conf.angularCoherenceSine <= 0))
+    {
+        return false;
+    }
+    if (GetMagnitudeSquared(xf.p - m_coherentXf.p) > Square(conf.linearCoherence))
+    {
+        return false;
+    }
+    // Rotation from the coherent orientation to the given one.
+    const auto dq = xf.q.Rotate(m_coherentXf.q.FlipY());
+    return (dq.GetX() > 0) && (abs(dq.GetY()) <= conf.angularCoherenceSine);
+}
+
 // Free functions...
 
 Body* GetBodyA(const Contact& contact) noexcept
@@ -90,6 +90,26 @@ public:
     {
         DistanceConf distance; ///< Distance configuration data.
         Manifold::Conf manifold; ///< Manifold configuration data.
+
+        /// @brief Linear coherence tolerance.
+        /// @details Maximum change in the relative position of the fixtures' bodies for
+        ///   which the last calculated manifold gets reused.
+        /// @note A value of zero along with a zero angular coherence sine disables reuse.
+        Length linearCoherence = 0_m;
+
+        /// @brief Sine of the angular coherence tolerance.
+        /// @details Maximum sine of the change in the relative orientation of the fixtures'
+        ///   bodies for which the last calculated manifold gets reused.
+        Real angularCoherenceSine = 0;
+
+        /// @brief Speculative time.
+        /// @details Time by which the bound on the speed at which the fixtures' children
+        ///   approach each other gets multiplied to get the speculative distance for newly
+        ///   calculated manifolds. The bound is the bodies' relative linear speed plus, for
+        ///   each body, its angular speed times its child's farthest reach from its center.
+        /// @note A value of zero disables speculative manifold points.
+        /// @sa Manifold::Conf::speculativeDistance.
+        Time speculativeTime = 0_s;
     };
     
     /// @brief Gets the update configuration from the given step configuration data.
@@ -127,7 +147,10 @@ public:
     ///   1. This contact's manifold has more than 0 contact points, or
     ///   2. This contact has sensors and the two shapes of this contact are found to be
     ///      overlapping.
+    /// @note With speculative contacts enabled, manifold points may have positive
+    ///   separations so this contact may be touching while its shapes are still apart.
     /// @return true if this contact is said to be touching, false otherwise.
+    /// @sa StepConf::doSpeculative.
     bool IsTouching() const noexcept;
 
     /// @brief Enables or disables this contact.
@@ -238,7 +261,10 @@ private:
         e_toiFlag = 0x10,
         
         // This contacts needs its touching state updated.
-        e_dirtyFlag = 0x20
+        e_dirtyFlag = 0x20,
+
+        // This contact's manifold was calculated at the transformation in m_coherentXf.
+        e_coherentFlag = 0x40
     };
     
     /// @brief Flags this contact for filtering.
@@ -256,6 +282,9 @@ private:
     ///   - The fixtures bodies' transformations.
     ///   - The <code>maxCirclesRatio</code> per-step configuration state *OR* the
     ///     <code>maxDistanceIters</code> per-step configuration state.
+    /// @note If the given configuration has non-zero coherence tolerances, the manifold
+    ///   is only recalculated when the relative transformation of the fixtures' bodies
+    ///   has changed by more than those tolerances since the manifold was last calculated.
     ///
     /// @param conf Per-step configuration information.
     /// @param listener Listener that if non-null is called with status information.
@@ -302,6 +331,12 @@ private:
     /// @brief Unsets the is-in-island state.
     void UnsetIslanded() noexcept;
 
+    /// @brief Whether the manifold is still valid for the given relative transformation.
+    /// @details Determines whether the given relative transformation of body B to body A is
+    ///   within the given configuration's coherence tolerances of the relative transformation
+    ///   at which this contact's non-empty manifold was last calculated.
+    bool IsCoherent(const UpdateConf& conf, const Transformation& xf) const noexcept;
+
     // Member variables...
 
     Manifold mutable m_manifold; ///< Manifold of the contact. 64-bytes. @sa Update.
@@ -330,6 +365,11 @@ private:
     Real m_toi;
     
     substep_type m_toiCount = 0; ///< Count of TOI calculations contact has gone through since last reset.
+
+    /// Relative transformation of body B to body A at which the manifold was last calculated.
+    /// @note Only valid if <code>m_flags & e_coherentFlag</code>.
+    /// @sa Update.
+    Transformation m_coherentXf = Transform_identity;
     
     FlagsType m_flags = e_enabledFlag|e_dirtyFlag; ///< Flags.
 };
@@ -31,8 +31,10 @@ namespace d2 {
 ContactKey GetContactKey(const Fixture& fixtureA, ChildCounter childIndexA,
                          const Fixture& fixtureB, ChildCounter childIndexB) noexcept
 {
-    return ContactKey(fixtureA.GetProxy(childIndexA).treeId,
-                      fixtureB.GetProxy(childIndexB).treeId);
+    // Fixtures with shared proxies have a single proxy for all of their children.
+    const auto proxyA = fixtureA.HasSharedProxy()? fixtureA.GetProxy(0): fixtureA.GetProxy(childIndexA);
+    const auto proxyB = fixtureB.HasSharedProxy()? fixtureB.GetProxy(0): fixtureB.GetProxy(childIndexB);
+    return ContactKey(proxyA.treeId, proxyB.treeId);
 }
 
 ContactKey GetContactKey(const Contact& contact) noexcept
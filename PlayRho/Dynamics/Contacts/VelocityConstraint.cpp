@@ -96,6 +96,12 @@ VelocityConstraint::VelocityConstraint(Real friction, Real restitution,
         const auto relA = worldPoint - bA.GetPosition().linear;
         const auto relB = worldPoint - bB.GetPosition().linear;
         AddPoint(get<0>(ci), get<1>(ci), relA, relB, conf);
+        const auto separation = worldManifold.GetSeparation(j);
+        if ((conf.speculativeInvTime != 0_Hz) && (separation > 0_m))
+        {
+            // Speculative point: the bodies may approach until the gap is closed.
+            m_points[j].velocityBias = -separation * conf.speculativeInvTime;
+        }
     }
     
     if (conf.blockSolve && (pointCount == 2))
@@ -189,7 +195,8 @@ VelocityConstraint::Conf GetRegVelocityConstraintConf(const StepConf& conf) noex
     return VelocityConstraint::Conf{
         conf.doWarmStart? conf.dtRatio: 0,
         conf.velocityThreshold,
-        conf.doBlocksolve
+        conf.doBlocksolve,
+        conf.doSpeculative? conf.GetInvTime(): 0_Hz
     };
 }
 
@@ -55,6 +55,13 @@ public:
         Real dtRatio = 1; ///< Delta time ratio.
         LinearVelocity velocityThreshold = DefaultVelocityThreshold; ///< Velocity threshold.
         bool blockSolve = true; ///< Whether to block solve.
+
+        /// @brief Speculative inverse time.
+        /// @details Inverse of the time in which points having a positive separation may
+        ///   close their gap. Such points then get a velocity bias that allows approaching
+        ///   by no more than that instead of getting any restitution.
+        /// @note A value of zero disables this.
+        Frequency speculativeInvTime = 0_Hz;
     };
     
     /// @brief Gets the default configuration for a <code>VelocityConstraint</code>.
@@ -175,6 +182,11 @@ public:
     /// @brief Sets the tangent impulse at the given point.
     void SetTangentImpulseAtPoint(size_type index, Momentum value);
     
+    /// @brief Sets the velocity bias at the given point.
+    /// @note Only meant for keeping a bias set for the same point of an earlier constraint
+    ///   for the same contact.
+    void SetVelocityBiasAtPoint(size_type index, LinearVelocity value);
+    
     /// @brief Velocity constraint point.
     ///
     /// @note Default initialized to values that make this point ineffective if it got
@@ -359,6 +371,12 @@ inline void VelocityConstraint::SetTangentImpulseAtPoint(VelocityConstraint::siz
     PointAt(index).tangentImpulse = value;
 }
 
+inline void VelocityConstraint::SetVelocityBiasAtPoint(VelocityConstraint::size_type index,
+                                                       LinearVelocity value)
+{
+    PointAt(index).velocityBias = value;
+}
+
 // Free functions...
 
 /// @brief Gets the regular phase velocity constraint configuration from the given
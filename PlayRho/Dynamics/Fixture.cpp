@@ -25,6 +25,7 @@
 #include <PlayRho/Dynamics/World.hpp>
 #include <PlayRho/Dynamics/Body.hpp>
 #include <PlayRho/Dynamics/WorldAtty.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
 
 #include <algorithm>
 
@@ -73,6 +74,32 @@ void Fixture::SetSensor(bool sensor) noexcept
                 const auto contact = GetContactPtr(ci);
                 contact->FlagForUpdating();
             });
+            
+            const auto world = body->GetWorld();
+            if (world->IsTrackingSensorOverlaps())
+            {
+                // Contacts are only made for non-sensors so they need re-filtering.
+                WorldAtty::UpdateSensor(*world, *this);
+                Refilter();
+            }
+        }
+    }
+}
+
+void Fixture::SetBody(Body& body) noexcept
+{
+    m_body = &body;
+    if (m_childTree)
+    {
+        const auto capacity = m_childTree->GetNodeCapacity();
+        for (auto i = decltype(capacity){0}; i < capacity; ++i)
+        {
+            if (DynamicTree::IsLeaf(m_childTree->GetHeight(i)))
+            {
+                auto leafData = m_childTree->GetLeafData(i);
+                leafData.body = &body;
+                m_childTree->SetLeafData(i, leafData);
+            }
         }
     }
 }
@@ -101,5 +128,54 @@ Transformation GetTransformation(const Fixture& f) noexcept
     return f.GetBody()->GetTransformation();
 }
 
+bool QueryChildren(const Fixture& fixture, const AABB& aabb, const ChildQueryCallback& callback)
+{
+    if (const auto childTree = fixture.GetChildTree())
+    {
+        auto completed = true;
+        Query(*childTree, aabb, [&](DynamicTree::Size id) {
+            if (!callback(childTree->GetLeafData(id).childIndex, childTree->GetAABB(id)))
+            {
+                completed = false;
+                return DynamicTreeOpcode::End;
+            }
+            return DynamicTreeOpcode::Continue;
+        });
+        return completed;
+    }
+    if (fixture.HasSharedProxy())
+    {
+        if (const auto heightField = GetHeightFieldShapeConf(fixture.GetShape()))
+        {
+            const auto range = GetChildRange(*heightField, aabb);
+            for (auto i = range.first; i < range.second; ++i)
+            {
+                const auto childAABB = GetChildAABB(*heightField, i);
+                if (TestOverlap(childAABB, aabb) && !callback(i, childAABB))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+AABB GetChildrenAABB(const Fixture& fixture)
+{
+    if (const auto childTree = fixture.GetChildTree())
+    {
+        return GetAABB(*childTree);
+    }
+    if (fixture.HasSharedProxy())
+    {
+        if (const auto heightField = GetHeightFieldShapeConf(fixture.GetShape()))
+        {
+            return GetAABB(*heightField);
+        }
+    }
+    return AABB{};
+}
+
 } // namespace d2
 } // namespace playrho
@@ -31,7 +31,9 @@
 #include <PlayRho/Dynamics/Filter.hpp>
 #include <PlayRho/Dynamics/FixtureConf.hpp>
 #include <PlayRho/Dynamics/FixtureProxy.hpp>
+#include <PlayRho/Collision/DynamicTree.hpp>
 #include <PlayRho/Collision/Shapes/Shape.hpp>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -51,7 +53,7 @@ class Body;
 /// @warning you cannot reuse fixtures.
 /// @note Fixtures should be created using the <code>Body::CreateFixture</code> method.
 /// @note Destroy these using the <code>Body::Destroy(Fixture*, bool)</code> method.
-/// @note This structure is 56-bytes large (using a 4-byte Real on at least one 64-bit
+/// @note This structure is 64-bytes large (using a 4-byte Real on at least one 64-bit
 ///   architecture/build).
 ///
 /// @ingroup PhysicalEntities
@@ -122,6 +124,25 @@ public:
     
     /// @brief Gets the proxies.
     Span<const FixtureProxy> GetProxies() const noexcept;
+    
+    /// @brief Gets whether this fixture's shape children share a single proxy.
+    /// @sa FixtureConf::singleProxy.
+    bool IsSingleProxy() const noexcept;
+    
+    /// @brief Gets the child tree.
+    /// @details This is the dynamic tree of this fixture's shape children in body-local
+    ///   coordinates that's built when a single proxy gets created for a shape having more
+    ///   than one child.
+    /// @return Non-null pointer to the child tree if this fixture has a single proxy for
+    ///   more than one child, <code>nullptr</code> otherwise.
+    /// @note Fixtures of height field shapes share a single proxy without a child tree.
+    const DynamicTree* GetChildTree() const noexcept;
+    
+    /// @brief Gets whether more than one of this fixture's shape children share its proxy.
+    /// @details This is the case after proxy creation for fixtures using a single proxy for
+    ///   a shape having more than one child, and for fixtures of height field shapes.
+    /// @sa QueryChildren(const Fixture&, const AABB&, const ChildQueryCallback&).
+    bool HasSharedProxy() const noexcept;
 
 private:
 
@@ -148,7 +169,8 @@ private:
         m_userData{def.userData},
         m_shape{shape},
         m_filter{def.filter},
-        m_isSensor{def.isSensor}
+        m_isSensor{def.isSensor},
+        m_singleProxy{def.singleProxy}
     {
         // Intentionally empty.
     }
@@ -173,12 +195,22 @@ private:
     /// @brief Sets the proxies.
     void SetProxies(std::unique_ptr<FixtureProxy[]> value, std::size_t count) noexcept;
 
-    /// @brief Resets the proxies.
+    /// @brief Resets the proxies and any child tree.
     void ResetProxies() noexcept;
+    
+    /// @brief Sets the child tree.
+    void SetChildTree(std::unique_ptr<DynamicTree> value) noexcept;
+    
+    /// @brief Sets whether the shape's children share this fixture's proxy.
+    void SetSharedProxy(bool value) noexcept;
+    
+    /// @brief Sets the parent body.
+    /// @details Also updates the body cached in the leaves of any child tree.
+    void SetBody(Body& body) noexcept;
 
     // Data ordered here for memory compaction.
     
-    NonNull<Body*> const m_body; ///< Parent body. Set on construction. 8-bytes.
+    NonNull<Body*> m_body; ///< Parent body. Set on construction or split. 8-bytes.
 
     void* m_userData = nullptr; ///< User data. 8-bytes.
 
@@ -190,6 +222,9 @@ private:
     
     FixtureProxies m_proxies; ///< Collection of fixture proxies for the assigned shape. 8-bytes.
     
+    /// Tree of the shape's children when they share a single proxy. 8-bytes.
+    std::unique_ptr<DynamicTree> m_childTree;
+    
     /// Proxy count.
     /// @details This is the fixture shape's child count after proxy creation. 4-bytes.
     ChildCounter m_proxyCount = 0;
@@ -197,6 +232,10 @@ private:
     Filter m_filter; ///< Filter object. 6-bytes.
     
     bool m_isSensor = false; ///< Is/is-not sensor. 1-bytes.
+    
+    bool m_singleProxy = false; ///< Whether children share a single proxy. 1-bytes.
+    
+    bool m_sharedProxy = false; ///< Whether children currently share the proxy. 1-bytes.
 };
 
 inline Shape Fixture::GetShape() const noexcept
@@ -273,6 +312,33 @@ inline void Fixture::ResetProxies() noexcept
         m_proxies.asBuffer.reset();
     }
     m_proxyCount = 0;
+    m_childTree.reset();
+    m_sharedProxy = false;
+}
+
+inline bool Fixture::IsSingleProxy() const noexcept
+{
+    return m_singleProxy;
+}
+
+inline const DynamicTree* Fixture::GetChildTree() const noexcept
+{
+    return m_childTree.get();
+}
+
+inline void Fixture::SetChildTree(std::unique_ptr<DynamicTree> value) noexcept
+{
+    m_childTree = std::move(value);
+}
+
+inline bool Fixture::HasSharedProxy() const noexcept
+{
+    return m_sharedProxy;
+}
+
+inline void Fixture::SetSharedProxy(bool value) noexcept
+{
+    m_sharedProxy = value;
 }
 
 inline Real Fixture::GetFriction() const noexcept
@@ -320,6 +386,43 @@ inline bool ShouldCollide(const Fixture& fixtureA, const Fixture& fixtureB) noex
 {
     return ShouldCollide(fixtureA.GetFilterData(), fixtureB.GetFilterData());
 }
+
+/// @brief Gets the collision filter cached by the given broad-phase leaf data.
+/// @relatedalso Fixture
+PLAYRHO_CONSTEXPR inline Filter GetFilter(const DynamicTree::LeafData& data) noexcept
+{
+    return Filter{data.categoryBits, data.maskBits, data.groupIndex};
+}
+
+/// @brief Sets the collision filter cached by the given broad-phase leaf data.
+/// @relatedalso Fixture
+PLAYRHO_CONSTEXPR inline void SetFilter(DynamicTree::LeafData& data, Filter filter) noexcept
+{
+    data.categoryBits = filter.categoryBits;
+    data.maskBits = filter.maskBits;
+    data.groupIndex = filter.groupIndex;
+}
+
+/// @brief Child query callback type.
+/// @details Called with the index and body-local AABB of a child. Returns
+///   <code>false</code> to end the query or <code>true</code> to continue it.
+using ChildQueryCallback = std::function<bool(ChildCounter, const AABB&)>;
+
+/// @brief Queries the given fixture for the shape children sharing its proxy whose
+///   body-local AABBs overlap the given body-local AABB.
+/// @details Finds the children of height field shapes by index arithmetic and those of
+///   other shapes by querying the fixture's child tree.
+/// @return <code>false</code> if the callback ended the query, <code>true</code> otherwise.
+/// @sa Fixture::HasSharedProxy.
+/// @relatedalso Fixture
+bool QueryChildren(const Fixture& fixture, const AABB& aabb, const ChildQueryCallback& callback);
+
+/// @brief Gets the body-local AABB of all the shape children sharing the given fixture's
+///   proxy.
+/// @return AABB of the children or an unset AABB if the fixture has no shared proxy.
+/// @sa Fixture::HasSharedProxy.
+/// @relatedalso Fixture
+AABB GetChildrenAABB(const Fixture& fixture);
     
 } // namespace d2
 } // namespace playrho
@@ -66,6 +66,24 @@ private:
         fixture.ResetProxies();
     }
     
+    /// @brief Sets the child tree of the given fixture.
+    static void SetChildTree(Fixture& fixture, std::unique_ptr<DynamicTree> value) noexcept
+    {
+        fixture.SetChildTree(std::move(value));
+    }
+    
+    /// @brief Sets whether the given fixture's shape children share its proxy.
+    static void SetSharedProxy(Fixture& fixture, bool value) noexcept
+    {
+        fixture.SetSharedProxy(value);
+    }
+    
+    /// @brief Sets the body of the given fixture.
+    static void SetBody(Fixture& fixture, Body& body) noexcept
+    {
+        fixture.SetBody(body);
+    }
+    
     /// @brief Creates a new fixture for the given body and with the given settings.
     static Fixture* Create(Body& body, const FixtureConf& def, Shape shape)
     {
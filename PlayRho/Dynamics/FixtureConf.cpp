@@ -27,7 +27,8 @@ namespace d2 {
 
 FixtureConf GetFixtureConf(const Fixture& fixture) noexcept
 {
-    return FixtureConf{fixture.GetUserData(), fixture.IsSensor(), fixture.GetFilterData()};
+    return FixtureConf{fixture.GetUserData(), fixture.IsSensor(), fixture.GetFilterData(),
+        fixture.IsSingleProxy()};
 }
 
 } // namespace d2
@@ -49,6 +49,9 @@ struct FixtureConf
     /// @brief Uses the given filter value.
     PLAYRHO_CONSTEXPR inline FixtureConf& UseFilter(Filter value) noexcept;
     
+    /// @brief Uses the given single proxy state value.
+    PLAYRHO_CONSTEXPR inline FixtureConf& UseSingleProxy(bool value) noexcept;
+    
     /// Use this to store application specific fixture data.
     void* userData = nullptr;
     
@@ -58,6 +61,16 @@ struct FixtureConf
     
     /// Contact filtering data.
     Filter filter;
+    
+    /// Whether the shape's children should share a single broad-phase proxy.
+    /// @details When set for a shape having more than one child - like a chain or a
+    ///   multi-shape - the world registers one proxy bounding all of the children and
+    ///   builds a body-local dynamic tree of the children that's queried to find just
+    ///   those children overlapping another proxy. This keeps large shapes, like long
+    ///   terrain outlines, from bloating the world's dynamic tree.
+    /// @note Fixtures of height field shapes always share a single proxy.
+    /// @sa Fixture::GetChildTree, HeightFieldShapeConf.
+    bool singleProxy = false;
 };
 
 PLAYRHO_CONSTEXPR inline FixtureConf& FixtureConf::UseUserData(void* value) noexcept
@@ -78,6 +91,12 @@ PLAYRHO_CONSTEXPR inline FixtureConf& FixtureConf::UseFilter(Filter value) noexc
     return *this;
 }
 
+PLAYRHO_CONSTEXPR inline FixtureConf& FixtureConf::UseSingleProxy(bool value) noexcept
+{
+    singleProxy = value;
+    return *this;
+}
+
 /// @brief Gets the default fixture definition.
 /// @relatedalso FixtureConf
 PLAYRHO_CONSTEXPR inline FixtureConf GetDefaultFixtureConf() noexcept
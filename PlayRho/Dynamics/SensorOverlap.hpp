@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_DYNAMICS_SENSOROVERLAP_HPP
+#define PLAYRHO_DYNAMICS_SENSOROVERLAP_HPP
+
+/// @file
+/// Definition of the SensorOverlap struct and related free functions.
+
+#include <PlayRho/Common/Settings.hpp>
+
+#include <functional>
+#include <tuple>
+
+namespace playrho {
+namespace d2 {
+
+class Fixture;
+
+/// @brief Sensor overlap.
+/// @details Record of a child of a sensor fixture overlapping with a child of another
+///   fixture. Worlds tracking sensor overlaps keep these instead of contacts for sensors.
+/// @note This is 32-bytes large on 64-bit architectures.
+/// @sa WorldConf::sensorOverlaps
+struct SensorOverlap
+{
+    ContactCounter sensorProxy; ///< Tree identifier of the sensor's proxy.
+    ContactCounter otherProxy; ///< Tree identifier of the other fixture's proxy.
+    ChildCounter sensorChild; ///< Child index of the sensor's shape.
+    ChildCounter otherChild; ///< Child index of the other fixture's shape.
+    Fixture* sensor; ///< Sensor fixture.
+    Fixture* other; ///< Other fixture.
+};
+
+/// @brief Equality operator.
+/// @relatedalso SensorOverlap
+PLAYRHO_CONSTEXPR inline bool operator== (const SensorOverlap& lhs, const SensorOverlap& rhs) noexcept
+{
+    return lhs.sensorProxy == rhs.sensorProxy && lhs.otherProxy == rhs.otherProxy
+        && lhs.sensorChild == rhs.sensorChild && lhs.otherChild == rhs.otherChild
+        && lhs.sensor == rhs.sensor && lhs.other == rhs.other;
+}
+
+/// @brief Inequality operator.
+/// @relatedalso SensorOverlap
+PLAYRHO_CONSTEXPR inline bool operator!= (const SensorOverlap& lhs, const SensorOverlap& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Less-than operator.
+/// @details Orders overlaps by their sensor's proxy first so the overlaps of each sensor
+///   are contiguous when sorted.
+/// @note The fixtures are only compared when the proxies and children are the same,
+///   which only happens for overlaps from before and after a proxy got reused.
+/// @relatedalso SensorOverlap
+inline bool operator< (const SensorOverlap& lhs, const SensorOverlap& rhs) noexcept
+{
+    const auto lhsKey = std::tie(lhs.sensorProxy, lhs.otherProxy, lhs.sensorChild, lhs.otherChild);
+    const auto rhsKey = std::tie(rhs.sensorProxy, rhs.otherProxy, rhs.sensorChild, rhs.otherChild);
+    if (lhsKey != rhsKey)
+    {
+        return lhsKey < rhsKey;
+    }
+    if (lhs.sensor != rhs.sensor)
+    {
+        return std::less<const Fixture*>{}(lhs.sensor, rhs.sensor);
+    }
+    return std::less<const Fixture*>{}(lhs.other, rhs.other);
+}
+
+} // namespace d2
+} // namespace playrho
+
+#endif // PLAYRHO_DYNAMICS_SENSOROVERLAP_HPP
@@ -228,7 +228,23 @@ public:
     /// @brief Angular sleep tolerance.
     /// @note Used in the regular phase of step processing.
     AngularVelocity angularSleepTolerance = DefaultAngularSleepTolerance;
-    
+
+    /// @brief Linear coherence tolerance.
+    /// @details Contacts whose bodies' relative position has changed by no more than this
+    ///   amount (and whose relative orientation has changed by no more than the angular
+    ///   coherence tolerance) since their manifold was last calculated, reuse that manifold
+    ///   instead of recalculating it. The manifold's points are in the shapes' local
+    ///   coordinates so separations still get recalculated by the solvers.
+    /// @note Values of zero (the defaults for both tolerances) disable this.
+    /// @note Values should be a fraction of the linear slop.
+    /// @note Used in both the regular and TOI phases of step processing.
+    /// @sa angularCoherenceTolerance.
+    NonNegative<Length> linearCoherenceTolerance = 0_m;
+
+    /// @brief Angular coherence tolerance.
+    /// @sa linearCoherenceTolerance.
+    NonNegative<Angle> angularCoherenceTolerance = 0_deg;
+
     /// @brief Displacement multiplier for directional AABB fattening.
     Real displaceMultiplier = DefaultDistanceMultiplier;
     
@@ -262,6 +278,24 @@ public:
     /// @sa regMinSeparation.
     iteration_type regPositionIterations = 3;
 
+    /// @brief Regular sub-steps.
+    /// @details When non-zero, this selects the sub-stepping solver for the regular phase
+    ///   and is the number of sub-steps the step gets divided into. Every sub-step integrates
+    ///   the velocities, updates the contact and joint velocity constraints for the sub-step's
+    ///   positions, does a single pass over the velocity constraints, integrates the
+    ///   positions, and then does a single relaxing pass over the position constraints.
+    ///   Tall stacks and long joint chains get more stable from more sub-steps than from
+    ///   the same number of extra iterations.
+    /// @note The regular velocity and position iterations are not used when this is non-zero.
+    /// @note Every sub-step gets warm started with the impulses of the sub-step before it.
+    ///   Contact impulses get summed up over the sub-steps so the impulses reported for
+    ///   contacts are those of the whole step. Joint impulses are those of the last sub-step.
+    /// @note Islands are only reported as solved if their position constraints were within
+    ///   tolerance for every one of the sub-steps.
+    /// @note Used in the regular phase of step processing.
+    /// @sa regVelocityIterations, regPositionIterations.
+    iteration_type regSubSteps = 0;
+
     /// @brief TOI velocity iterations.
     /// @details
     /// This is the number of iterations of velocity resolution that will be done in the step.
@@ -315,6 +349,21 @@ public:
     /// @brief Do the block-solve algorithm.
     bool doBlocksolve = true;
 
+    /// @brief Do speculative contacts.
+    /// @details Whether or not to use speculative contacts for continuous collision detection.
+    ///   With these, contact manifolds get points for shapes that are apart by no more than
+    ///   the distance their bodies' relative motion can cover in the step and the regular phase
+    ///   velocity solver only lets such bodies approach each other by their separation. This
+    ///   prevents tunneling at the cost of just the regular phase and so is a cheaper, though
+    ///   less exact, alternative to doing TOI calculations.
+    /// @note Contacts having speculative points are reported as touching, even while their
+    ///   shapes are still apart, so that the regular phase solves them. So
+    ///   <code>ContactListener::BeginContact</code> may get called a step or more before the
+    ///   shapes meet and their bodies' islands get merged from then on.
+    /// @note Used in the regular phase of step processing.
+    /// @sa doToi.
+    bool doSpeculative = false;
+
 private:
     /// @brief Delta time.
     /// @details This is the time step in seconds.
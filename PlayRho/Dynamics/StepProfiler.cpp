@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <PlayRho/Dynamics/StepProfiler.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+
+namespace playrho {
+
+namespace {
+
+inline double ToMicroseconds(std::chrono::nanoseconds value) noexcept
+{
+    return std::chrono::duration<double, std::micro>{value}.count();
+}
+
+} // anonymous namespace
+
+const char* ToString(StepPhase value) noexcept
+{
+    switch (value)
+    {
+        case StepPhase::ProxySync: return "ProxySync";
+        case StepPhase::ContactDestroy: return "ContactDestroy";
+        case StepPhase::FindNewContacts: return "FindNewContacts";
+        case StepPhase::NarrowPhase: return "NarrowPhase";
+        case StepPhase::IslandBuild: return "IslandBuild";
+        case StepPhase::Solve: return "Solve";
+        case StepPhase::VelocitySolve: return "VelocitySolve";
+        case StepPhase::PositionSolve: return "PositionSolve";
+        case StepPhase::Toi: return "Toi";
+        case StepPhase::SensorOverlaps: return "SensorOverlaps";
+    }
+    return "Unknown";
+}
+
+bool IsStepProfilingEnabled() noexcept
+{
+#if defined(PLAYRHO_ENABLE_PROFILING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::chrono::nanoseconds GetThreadCpuTime() noexcept
+{
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    auto ts = timespec{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    {
+        return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+    }
+#endif
+    const auto seconds = static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>{seconds});
+}
+
+void StepProfiler::Record(StepPhase phase, Clock::time_point start, PhaseTime time) noexcept
+{
+    const auto id = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock{m_mutex};
+    try
+    {
+        const auto it = std::find(begin(m_threads), end(m_threads), id);
+        const auto thread = static_cast<std::uint32_t>(it - m_threads.begin());
+        if (it == end(m_threads))
+        {
+            m_threads.push_back(id);
+        }
+        m_events.push_back(Event{phase, thread, start - m_epoch, time});
+    }
+    catch (...)
+    {
+        // Drop the event.
+    }
+}
+
+std::vector<StepProfiler::Event> StepProfiler::GetEvents() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_events;
+}
+
+std::size_t StepProfiler::GetThreadCount() const noexcept
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return size(m_threads);
+}
+
+void StepProfiler::Clear() noexcept
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_events.clear();
+    m_threads.clear();
+    m_epoch = Clock::now();
+}
+
+void WriteChromeTrace(std::ostream& os, const StepProfiler& profiler)
+{
+    const auto events = profiler.GetEvents();
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+    auto first = true;
+    for (auto&& event: events)
+    {
+        os << (first? "\n": ",\n");
+        os << "{\"name\":\"" << ToString(event.phase) << "\"";
+        os << ",\"cat\":\"World::Step\",\"ph\":\"X\",\"pid\":0";
+        os << ",\"tid\":" << event.thread;
+        os << ",\"ts\":" << ToMicroseconds(event.begin);
+        os << ",\"dur\":" << ToMicroseconds(event.time.wall);
+        os << ",\"args\":{\"cpu_us\":" << ToMicroseconds(event.time.cpu);
+        if (GetParent(event.phase) != event.phase)
+        {
+            os << ",\"parent\":\"" << ToString(GetParent(event.phase)) << "\"";
+        }
+        os << "}}";
+        first = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+ProfileScope::~ProfileScope() noexcept
+{
+    if (!m_profiler && !m_accumulator)
+    {
+        return;
+    }
+    const auto time = PhaseTime{
+        std::chrono::duration_cast<std::chrono::nanoseconds>(StepProfiler::Clock::now() - m_wall),
+        GetThreadCpuTime() - m_cpu
+    };
+    if (m_accumulator)
+    {
+        m_accumulator->wall += time.wall;
+        m_accumulator->cpu += time.cpu;
+    }
+    if (m_profiler)
+    {
+        m_profiler->Record(m_phase, m_wall, time);
+    }
+}
+
+} // namespace playrho
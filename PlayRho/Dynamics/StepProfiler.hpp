@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef PLAYRHO_DYNAMICS_STEPPROFILER_HPP
+#define PLAYRHO_DYNAMICS_STEPPROFILER_HPP
+
+/// @file
+/// Declarations of the StepProfiler class and related free functions.
+
+#include <PlayRho/Dynamics/StepStats.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace playrho {
+
+/// @brief Step profiler.
+///
+/// @details Records a timeline of the phases of world steps, per thread, for later
+///   inspection or export. Set one through <code>d2::WorldConf::UseStepProfiler</code>.
+///
+/// @note Events are only recorded when the library is built with step profiling.
+/// @note This is safe to record to from multiple threads.
+///
+/// @sa IsStepProfilingEnabled, WriteChromeTrace
+///
+class StepProfiler
+{
+public:
+    /// @brief Clock type used for the wall clock times.
+    using Clock = std::chrono::steady_clock;
+    
+    /// @brief Profiler event.
+    struct Event
+    {
+        StepPhase phase; ///< Phase that the event is for.
+        std::uint32_t thread; ///< Index of the thread that ran the phase.
+        std::chrono::nanoseconds begin; ///< Time since the profiler's epoch of the start.
+        PhaseTime time; ///< Wall clock and CPU time spent.
+    };
+    
+    /// @brief Records the given event data.
+    /// @details Records the given phase as run by the calling thread.
+    /// @note Events that can't be recorded for lack of memory are dropped.
+    void Record(StepPhase phase, Clock::time_point start, PhaseTime time) noexcept;
+    
+    /// @brief Gets the recorded events.
+    std::vector<Event> GetEvents() const;
+    
+    /// @brief Gets the count of threads that recorded events.
+    std::size_t GetThreadCount() const noexcept;
+    
+    /// @brief Clears the recorded events.
+    void Clear() noexcept;
+    
+private:
+    mutable std::mutex m_mutex; ///< Mutex for all of the following.
+    Clock::time_point m_epoch = Clock::now(); ///< Time that event begin times are relative to.
+    std::vector<std::thread::id> m_threads; ///< Identifiers of threads that recorded events.
+    std::vector<Event> m_events; ///< Recorded events.
+};
+
+/// @brief Writes the events of the given profiler to the given stream in the Chrome
+///   trace event JSON format.
+/// @details The output can be loaded into <code>chrome://tracing</code> or similar
+///   trace viewers where every thread that ran a phase gets a timeline of its own.
+/// @relatedalso StepProfiler
+void WriteChromeTrace(std::ostream& os, const StepProfiler& profiler);
+
+/// @brief Gets the CPU time consumed so far by the calling thread.
+/// @note Where per-thread CPU time isn't available this gets the process CPU time instead.
+std::chrono::nanoseconds GetThreadCpuTime() noexcept;
+
+/// @brief Profile scope.
+/// @details Times its own lifetime as the given step phase adding the time to the given
+///   accumulator and recording it to the given profiler. Either of these may be null.
+///   When both are null, no clocks get read.
+/// @note Use through the <code>PLAYRHO_PROFILE_SCOPE</code> macro so that it gets
+///   compiled out when profiling isn't enabled.
+class ProfileScope
+{
+public:
+    /// @brief Initializing constructor.
+    ProfileScope(StepPhase phase, StepProfiler* profiler, PhaseTime* accumulator) noexcept:
+        m_phase{phase}, m_profiler{profiler}, m_accumulator{accumulator},
+        m_wall{(profiler || accumulator)? StepProfiler::Clock::now():
+               StepProfiler::Clock::time_point{}},
+        m_cpu{(profiler || accumulator)? GetThreadCpuTime(): std::chrono::nanoseconds::zero()}
+    {
+        // Intentionally empty.
+    }
+    
+    ProfileScope(const ProfileScope& other) = delete;
+    
+    ProfileScope& operator= (const ProfileScope& other) = delete;
+    
+    /// @brief Destructor.
+    ~ProfileScope() noexcept;
+    
+private:
+    StepPhase m_phase; ///< Phase being timed.
+    StepProfiler* m_profiler; ///< Profiler to record to.
+    PhaseTime* m_accumulator; ///< Accumulator to add to.
+    StepProfiler::Clock::time_point m_wall; ///< Wall clock time at construction.
+    std::chrono::nanoseconds m_cpu; ///< CPU time at construction.
+};
+
+} // namespace playrho
+
+/// @brief Profile scope macro.
+/// @details Declares a <code>ProfileScope</code> variable of the given name when built
+///   with <code>PLAYRHO_ENABLE_PROFILING</code> defined and expands to a no-op otherwise.
+/// @note The arguments aren't evaluated when profiling isn't enabled.
+#if defined(PLAYRHO_ENABLE_PROFILING)
+#define PLAYRHO_PROFILE_SCOPE(name, phase, profiler, accumulator) \
+    ::playrho::ProfileScope name{phase, profiler, accumulator}
+#else
+#define PLAYRHO_PROFILE_SCOPE(name, phase, profiler, accumulator) \
+    static_cast<void>(0)
+#endif
+
+#endif // PLAYRHO_DYNAMICS_STEPPROFILER_HPP
@@ -23,8 +23,88 @@
 
 #include <PlayRho/Common/Settings.hpp>
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+
 namespace playrho {
     
+    /// @brief Step phase enumeration.
+    /// @details Identifies the phases of <code>d2::World::Step</code> that get timed.
+    /// @note Some phases are sub-phases of others. Their times are included in those of
+    ///   their parent phase.
+    /// @sa GetParent, StepStats::times, StepProfiler
+    enum class StepPhase: std::uint8_t
+    {
+        ProxySync, ///< Creating, destroying, and synchronizing of broad-phase proxies.
+        ContactDestroy, ///< Destroying of contacts that no longer overlap.
+        FindNewContacts, ///< Finding of new contacts from broad-phase proxy overlaps.
+        NarrowPhase, ///< Updating of contact manifolds.
+        IslandBuild, ///< Building of the regular phase islands.
+        Solve, ///< Solving of the regular phase islands.
+        VelocitySolve, ///< Solving of the regular phase velocity constraints. Part of Solve.
+        PositionSolve, ///< Solving of the regular phase position constraints. Part of Solve.
+        Toi, ///< Time of impact phase.
+        SensorOverlaps, ///< Updating of sensor overlaps.
+    };
+    
+    /// @brief Count of step phases.
+    PLAYRHO_CONSTEXPR const auto StepPhaseCount = std::size_t{10};
+    
+    /// @brief Gets a human readable name for the given step phase.
+    /// @relatedalso StepPhase
+    const char* ToString(StepPhase value) noexcept;
+    
+    /// @brief Gets the phase that the given phase is a sub-phase of.
+    /// @return Parent phase of the given phase or the given phase itself if it's a
+    ///   top-level phase.
+    /// @relatedalso StepPhase
+    PLAYRHO_CONSTEXPR inline StepPhase GetParent(StepPhase value) noexcept
+    {
+        switch (value)
+        {
+            case StepPhase::VelocitySolve:
+            case StepPhase::PositionSolve:
+                return StepPhase::Solve;
+            default:
+                break;
+        }
+        return value;
+    }
+    
+    /// @brief Phase time.
+    /// @details Wall clock and CPU time spent in a phase.
+    struct PhaseTime
+    {
+        std::chrono::nanoseconds wall = std::chrono::nanoseconds::zero(); ///< Elapsed wall time.
+        std::chrono::nanoseconds cpu = std::chrono::nanoseconds::zero(); ///< Thread CPU time.
+    };
+    
+    /// @brief Step phase times.
+    /// @details Times indexed by <code>StepPhase</code> value.
+    using StepPhaseTimes = std::array<PhaseTime, StepPhaseCount>;
+    
+    /// @brief Gets the time of the given phase from the given times.
+    /// @relatedalso StepPhase
+    PLAYRHO_CONSTEXPR inline PhaseTime& Get(StepPhaseTimes& times, StepPhase phase) noexcept
+    {
+        return times[static_cast<std::size_t>(phase)];
+    }
+    
+    /// @brief Gets the time of the given phase from the given times.
+    /// @relatedalso StepPhase
+    PLAYRHO_CONSTEXPR inline const PhaseTime& Get(const StepPhaseTimes& times,
+                                                  StepPhase phase) noexcept
+    {
+        return times[static_cast<std::size_t>(phase)];
+    }
+    
+    /// @brief Whether the library was built with step profiling.
+    /// @details Step phases are only timed when the library is built with the
+    ///   <code>PLAYRHO_ENABLE_PROFILING</code> macro defined. Otherwise the profiling code
+    ///   is compiled out and the step phase times are always zero.
+    bool IsStepProfilingEnabled() noexcept;
+    
     /// @brief Pre-phase per-step statistics.
     /// @note This data structure is 24-bytes large (on at least one 64-bit platform).
     struct PreStepStats
@@ -107,7 +187,7 @@ namespace playrho {
     /// @brief Per-step statistics.
     ///
     /// @details These are statistics output from the <code>d2::World::Step</code> method.
-    /// @note This data structure is 116-bytes large (on at least one 64-bit platform with
+    /// @note This data structure is 232-bytes large (on at least one 64-bit platform with
     ///   4-byte Real type).
     /// @note Efficient transfer of this data is predicated on compiler support for
     ///   "named-return-value-optimization" (N.R.V.O.) - a form of "copy elision".
@@ -121,6 +201,13 @@ namespace playrho {
         PreStepStats pre; ///< Pre-phase step statistics.
         RegStepStats reg; ///< Reg-phase step statistics.
         ToiStepStats toi; ///< TOI-phase step statistics.
+        
+        /// @brief Per-phase times.
+        /// @note Phases solved in parallel are timed as a whole on the stepping thread.
+        ///   Their sub-phases get timed per task and summed so these can add up to more
+        ///   than the wall time of their parent phase.
+        /// @note These are zero unless <code>IsStepProfilingEnabled()</code> is true.
+        StepPhaseTimes times;
     };
     
 } // namespace playrho
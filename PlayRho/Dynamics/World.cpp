@@ -32,6 +32,9 @@
 #include <PlayRho/Dynamics/ContactAtty.hpp>
 #include <PlayRho/Dynamics/MovementConf.hpp>
 #include <PlayRho/Dynamics/ContactImpulsesList.hpp>
+#include <PlayRho/Dynamics/StepProfiler.hpp>
+#include <PlayRho/Dynamics/BodyStateBuffer.hpp>
+#include <PlayRho/Dynamics/ContactEventBuffer.hpp>
 
 #include <PlayRho/Dynamics/Joints/Joint.hpp>
 #include <PlayRho/Dynamics/Joints/JointVisitor.hpp>
@@ -56,30 +59,31 @@
 #include <PlayRho/Collision/TimeOfImpact.hpp>
 #include <PlayRho/Collision/RayCastOutput.hpp>
 #include <PlayRho/Collision/DistanceProxy.hpp>
+#include <PlayRho/Collision/Distance.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
 
 #include <PlayRho/Common/LengthError.hpp>
 #include <PlayRho/Common/DynamicMemory.hpp>
 #include <PlayRho/Common/FlagGuard.hpp>
 #include <PlayRho/Common/WrongState.hpp>
+#include <PlayRho/Common/TaskScheduler.hpp>
 
 #include <algorithm>
 #include <new>
 #include <functional>
+#include <iterator>
 #include <type_traits>
 #include <memory>
 #include <set>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 #ifdef DO_PAR_UNSEQ
 #include <atomic>
 #endif
 
-//#define DO_THREADED
-#if defined(DO_THREADED)
-#include <future>
-#endif
-
 #define PLAYRHO_MAGIC(x) (x)
 
 using std::for_each;
@@ -110,6 +114,123 @@ using VelocityConstraints = std::vector<VelocityConstraint>;
 
 namespace {
     
+    /// @brief Count of contacts per chunk of contact updating work for task schedulers.
+    PLAYRHO_CONSTEXPR const auto ContactUpdateGrainSize = std::size_t{64};
+    
+    /// @brief Count of proxies per chunk of broad-phase querying work for task schedulers.
+    PLAYRHO_CONSTEXPR const auto ProxyQueryGrainSize = std::size_t{256};
+    
+    /// @brief Count of sensors per chunk of sensor overlap finding work for task schedulers.
+    PLAYRHO_CONSTEXPR const auto SensorQueryGrainSize = std::size_t{16};
+    
+    /// @brief Count of bodies per chunk of proxy synchronizing work for task schedulers.
+    PLAYRHO_CONSTEXPR const auto ProxySyncGrainSize = std::size_t{64};
+    
+    /// @brief Determines whether synchronizing the given body's proxies for the given
+    ///   transformations would update or register any of them with the given tree.
+    /// @note This only reads the tree, so it can be called concurrently for different bodies.
+    bool NeedsSynchronizing(const DynamicTree& tree, const Body& body,
+                            Transformation xfm1, Transformation xfm2)
+    {
+        for (auto&& f: body.GetFixtures())
+        {
+            const auto& fixture = GetRef(f);
+            if (fixture.HasSharedProxy())
+            {
+                if (xfm1 != xfm2)
+                {
+                    return true;
+                }
+                const auto aabb = GetTransformedAABB(GetChildrenAABB(fixture), xfm1);
+                if (!Contains(tree.GetAABB(fixture.GetProxy(0).treeId), aabb))
+                {
+                    return true;
+                }
+                continue;
+            }
+            const auto shape = fixture.GetShape();
+            const auto childCount = fixture.GetProxyCount();
+            for (auto childIndex = ChildCounter{0}; childIndex < childCount; ++childIndex)
+            {
+                const auto aabb = ComputeAABB(GetChild(shape, childIndex), xfm1, xfm2);
+                if (!Contains(tree.GetAABB(fixture.GetProxy(childIndex).treeId), aabb))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+    /// @brief Gets the time of the given phase from the given times if there are any.
+    /// @return Pointer to the phase's time or <code>nullptr</code>.
+    inline PhaseTime* GetPhaseTime(StepPhaseTimes* times, StepPhase phase) noexcept
+    {
+        return times? &Get(*times, phase): nullptr;
+    }
+    
+    /// @brief Gets the dynamic tree node capacity needed for the given number of leaves.
+    PLAYRHO_CONSTEXPR inline ContactCounter GetTreeCapacity(ContactCounter leaves) noexcept
+    {
+        // A binary tree of n leaves has n - 1 branches.
+        return (leaves > 0)? static_cast<ContactCounter>(std::min(std::size_t{leaves} * 2 - 1,
+            std::size_t{std::numeric_limits<ContactCounter>::max()})): ContactCounter{0};
+    }
+    
+    /// @brief Gets the broad-phase leaf data for the given child of the given fixture.
+    DynamicTree::LeafData GetLeafData(Body* body, Fixture& fixture, ChildCounter childIndex) noexcept
+    {
+        const auto filter = fixture.GetFilterData();
+        return DynamicTree::LeafData{body, &fixture, childIndex,
+            filter.categoryBits, filter.maskBits, filter.groupIndex};
+    }
+    
+    /// @brief Creates the body-local tree of the children of the given fixture's shape.
+    /// @details The leaves are the tight local AABBs of the children. These never change
+    ///   so the tree only gets built once.
+    std::unique_ptr<DynamicTree> CreateChildTree(Body& body, Fixture& fixture)
+    {
+        const auto shape = fixture.GetShape();
+        const auto childCount = GetChildCount(shape);
+        auto tree = std::make_unique<DynamicTree>(childCount * 2 - 1);
+        for (auto childIndex = decltype(childCount){0}; childIndex < childCount; ++childIndex)
+        {
+            tree->CreateLeaf(ComputeAABB(GetChild(shape, childIndex), Transform_identity),
+                             GetLeafData(&body, fixture, childIndex));
+        }
+        return tree;
+    }
+    
+    /// @brief Computes the world AABB of the given child of the given shared proxy fixture.
+    /// @note This is the same AABB as that gotten by transforming the child's body-local
+    ///   AABB reported by <code>QueryChildren</code>.
+    AABB ComputeChildAABB(const Fixture& fixture, ChildCounter childIndex)
+    {
+        const auto aabb = ComputeAABB(GetChild(fixture.GetShape(), childIndex),
+                                      Transform_identity);
+        return GetTransformedAABB(aabb, GetTransformation(fixture));
+    }
+    
+    /// @brief Calls the given function for every child sharing the given fixture's proxy
+    ///   whose world AABB overlaps the given AABB.
+    /// @param fixture Fixture whose children to query.
+    /// @param aabb World AABB to query for.
+    /// @param func Function called with the child index and world AABB of each child.
+    template <typename F>
+    void QueryOverlappingChildren(const Fixture& fixture, const AABB& aabb, F&& func)
+    {
+        const auto xfm = GetTransformation(fixture);
+        QueryChildren(fixture, GetInverseTransformedAABB(aabb, xfm),
+                      [&](ChildCounter childIndex, const AABB& localAABB) {
+            const auto childAABB = GetTransformedAABB(localAABB, xfm);
+            if (TestOverlap(childAABB, aabb))
+            {
+                func(childIndex, childAABB);
+            }
+            return true;
+        });
+    }
+    
     inline void IntegratePositions(BodyConstraints& bodies, Time h)
     {
         assert(IsValid(h));
@@ -121,6 +242,45 @@ namespace {
         });
     }
     
+    /// Integrates the velocities of the given body constraints.
+    /// @details This accelerates and dampens the velocities like the body constraints
+    ///   had been gotten for the given time.
+    /// @param bodyConstraints Body constraints for the bodies at the same indices.
+    inline void IntegrateVelocities(BodyConstraints& bodyConstraints,
+                                    const Island::Bodies& bodies, Time h, MovementConf conf)
+    {
+        assert(size(bodyConstraints) == size(bodies));
+        for_each(begin(bodyConstraints), end(bodyConstraints), [&](BodyConstraint& bc) {
+            const auto& body = *bodies[static_cast<size_t>(&bc - data(bodyConstraints))];
+            if (body.IsAccelerable())
+            {
+                auto velocity = bc.GetVelocity();
+                velocity.linear += h * body.GetLinearAcceleration();
+                velocity.angular += h * body.GetAngularAcceleration();
+                velocity.linear  /= Real{1 + h * body.GetLinearDamping()};
+                velocity.angular /= Real{1 + h * body.GetAngularDamping()};
+                bc.SetVelocity(Cap(velocity, h, conf));
+            }
+        });
+    }
+
+    /// Gets the step configuration for a sub-step of the regular phase.
+    /// @details The time and movement limits are divided by the number of sub-steps so
+    ///   the limits for the whole step stay the same.
+    /// @return Copy of the given configuration if it doesn't have any sub-steps.
+    inline StepConf GetRegSubStepConf(const StepConf& conf) noexcept
+    {
+        auto subConf = conf;
+        if (conf.regSubSteps > 0)
+        {
+            const auto n = static_cast<Real>(conf.regSubSteps);
+            subConf.SetTime(conf.GetTime() / n);
+            subConf.maxTranslation /= n;
+            subConf.maxRotation /= n;
+        }
+        return subConf;
+    }
+
     /// Reports the given constraints to the listener.
     /// @details
     /// This calls the listener's PostSolve method for all size(contacts) elements of
@@ -128,7 +288,7 @@ namespace {
     /// @param listener Listener to call.
     /// @param constraints Array of m_contactCount contact velocity constraint elements.
     inline void Report(ContactListener& listener,
-                       Span<Contact*> contacts,
+                       Span<Contact* const> contacts,
                        const VelocityConstraints& constraints,
                        StepConf::iteration_type solved)
     {
@@ -139,6 +299,86 @@ namespace {
         }
     }
     
+    /// Reports the given constraints to the event buffer.
+    /// @details
+    /// This appends a contact impulses event for all size(contacts) elements of
+    /// the given array of constraints.
+    /// @param events Event buffer to append to.
+    /// @param constraints Array of m_contactCount contact velocity constraint elements.
+    inline void Report(ContactEventBuffer& events,
+                       Span<Contact* const> contacts,
+                       const VelocityConstraints& constraints,
+                       StepConf::iteration_type solved)
+    {
+        const auto numContacts = size(contacts);
+        for (auto i = decltype(numContacts){0}; i < numContacts; ++i)
+        {
+            events.AddImpulses(*contacts[i], GetContactImpulses(constraints[i]), solved);
+        }
+    }
+    
+    /// @brief Contact listener that records the calls made to it for replaying later.
+    /// @details Used by deterministic worlds to have the listener calls made from the
+    ///   chunks of parallel work, made instead from the stepping thread in chunk order.
+    class ContactCallRecorder: public ContactListener
+    {
+    public:
+        void BeginContact(Contact& contact) override
+        {
+            m_calls.push_back(Call{Call::e_begin, &contact, Manifold{}, ContactImpulsesList{}, 0});
+        }
+        
+        void EndContact(Contact& contact) override
+        {
+            m_calls.push_back(Call{Call::e_end, &contact, Manifold{}, ContactImpulsesList{}, 0});
+        }
+        
+        void PreSolve(Contact& contact, const Manifold& oldManifold) override
+        {
+            m_calls.push_back(Call{Call::e_preSolve, &contact, oldManifold,
+                ContactImpulsesList{}, 0});
+        }
+        
+        void PostSolve(Contact& contact, const ContactImpulsesList& impulses,
+                       iteration_type solved) override
+        {
+            m_calls.push_back(Call{Call::e_postSolve, &contact, Manifold{}, impulses, solved});
+        }
+        
+        /// @brief Makes the recorded calls to the given listener in the order recorded.
+        void Replay(ContactListener& listener) const
+        {
+            for (auto&& call: m_calls)
+            {
+                switch (call.type)
+                {
+                    case Call::e_begin: listener.BeginContact(*call.contact); break;
+                    case Call::e_end: listener.EndContact(*call.contact); break;
+                    case Call::e_preSolve: listener.PreSolve(*call.contact, call.oldManifold); break;
+                    case Call::e_postSolve:
+                        listener.PostSolve(*call.contact, call.impulses, call.solved);
+                        break;
+                }
+            }
+        }
+        
+    private:
+        /// @brief Recorded call.
+        struct Call
+        {
+            /// @brief Listener method called.
+            enum Type: std::uint8_t { e_begin, e_end, e_preSolve, e_postSolve };
+            
+            Type type; ///< Method called.
+            Contact* contact; ///< Contact the method was called for.
+            Manifold oldManifold; ///< Old manifold of a pre-solve call.
+            ContactImpulsesList impulses; ///< Impulses of a post-solve call.
+            iteration_type solved; ///< Solved iterations of a post-solve call.
+        };
+        
+        std::vector<Call> m_calls; ///< Recorded calls.
+    };
+    
     inline void AssignImpulses(Manifold& var, const VelocityConstraint& vc)
     {
         assert(var.GetPointCount() >= vc.GetPointCount());
@@ -235,6 +475,44 @@ namespace {
         return constraints;
     }
 
+    /// @brief Gets the velocity constraint for the given contact.
+    /// @details Gets the constraint for the contact's manifold at the current positions of
+    ///   the given body constraints.
+    VelocityConstraint GetVelocityConstraint(const Contact& contact,
+                                             BodyConstraintsMap& bodies,
+                                             const VelocityConstraint::Conf conf)
+    {
+        const auto& manifold = contact.GetManifold();
+        const auto fixtureA = contact.GetFixtureA();
+        const auto fixtureB = contact.GetFixtureB();
+        const auto friction = contact.GetFriction();
+        const auto restitution = contact.GetRestitution();
+        const auto tangentSpeed = contact.GetTangentSpeed();
+        const auto indexA = GetChildIndexA(contact);
+        const auto indexB = GetChildIndexB(contact);
+
+        const auto bodyA = fixtureA->GetBody();
+        const auto shapeA = fixtureA->GetShape();
+        
+        const auto bodyB = fixtureB->GetBody();
+        const auto shapeB = fixtureB->GetShape();
+        
+        const auto bodyConstraintA = At(bodies, bodyA);
+        const auto bodyConstraintB = At(bodies, bodyB);
+        
+        const auto radiusA = GetVertexRadius(shapeA, indexA);
+        const auto radiusB = GetVertexRadius(shapeB, indexB);
+
+        const auto xfA = GetTransformation(bodyConstraintA->GetPosition(),
+                                           bodyConstraintA->GetLocalCenter());
+        const auto xfB = GetTransformation(bodyConstraintB->GetPosition(),
+                                           bodyConstraintB->GetLocalCenter());
+        const auto worldManifold = GetWorldManifold(manifold, xfA, radiusA, xfB, radiusB);
+
+        return VelocityConstraint{friction, restitution, tangentSpeed, worldManifold,
+            *bodyConstraintA, *bodyConstraintB, conf};
+    }
+
     /// @brief Gets the velocity constraints for the given inputs.
     /// @details Inializes the velocity constraints with the position dependent portions of
     ///   the current position constraints.
@@ -249,37 +527,74 @@ namespace {
         auto velConstraints = VelocityConstraints{};
         velConstraints.reserve(size(contacts));
         transform(cbegin(contacts), cend(contacts), back_inserter(velConstraints), [&](const ContactPtr& contact) {
-            const auto& manifold = contact->GetManifold();
-            const auto fixtureA = contact->GetFixtureA();
-            const auto fixtureB = contact->GetFixtureB();
-            const auto friction = contact->GetFriction();
-            const auto restitution = contact->GetRestitution();
-            const auto tangentSpeed = contact->GetTangentSpeed();
-            const auto indexA = GetChildIndexA(*contact);
-            const auto indexB = GetChildIndexB(*contact);
+            return GetVelocityConstraint(*contact, bodies, conf);
+        });
+        return velConstraints;
+    }
 
-            const auto bodyA = fixtureA->GetBody();
-            const auto shapeA = fixtureA->GetShape();
-            
-            const auto bodyB = fixtureB->GetBody();
-            const auto shapeB = fixtureB->GetShape();
-            
-            const auto bodyConstraintA = At(bodies, bodyA);
-            const auto bodyConstraintB = At(bodies, bodyB);
-            
-            const auto radiusA = GetVertexRadius(shapeA, indexA);
-            const auto radiusB = GetVertexRadius(shapeB, indexB);
-    
-            const auto xfA = GetTransformation(bodyConstraintA->GetPosition(),
-                                               bodyConstraintA->GetLocalCenter());
-            const auto xfB = GetTransformation(bodyConstraintB->GetPosition(),
-                                               bodyConstraintB->GetLocalCenter());
-            const auto worldManifold = GetWorldManifold(manifold, xfA, radiusA, xfB, radiusB);
+    /// @brief Updates the given velocity constraints for the current body positions.
+    /// @details Gets the position dependent portions of the constraints, like their normals,
+    ///   points, and masses, anew. Keeps the impulses accumulated so far and the larger of
+    ///   the old and new restitution biases, so bounces set up earlier aren't undone. Biases
+    ///   of speculative points are those for their new separations.
+    /// @note Used between the sub-steps of the regular phase.
+    void UpdateVelocityConstraints(VelocityConstraints& velConstraints,
+                                   const Island::Contacts& contacts,
+                                   BodyConstraintsMap& bodies,
+                                   VelocityConstraint::Conf conf)
+    {
+        assert(size(velConstraints) == size(contacts));
+        conf.dtRatio = 0; // Impulses are taken from the old constraints instead.
+        for_each(begin(velConstraints), end(velConstraints), [&](VelocityConstraint& vc) {
+            const auto i = static_cast<VelocityConstraints::size_type>(&vc - data(velConstraints));
+            auto newVc = GetVelocityConstraint(*contacts[i], bodies, conf);
+            const auto count = std::min(vc.GetPointCount(), newVc.GetPointCount());
+            for (auto j = decltype(count){0}; j < count; ++j)
+            {
+                newVc.SetNormalImpulseAtPoint(j, GetNormalImpulseAtPoint(vc, j));
+                newVc.SetTangentImpulseAtPoint(j, GetTangentImpulseAtPoint(vc, j));
+                const auto newBias = GetVelocityBiasAtPoint(newVc, j);
+                const auto oldBias = GetVelocityBiasAtPoint(vc, j);
+                // Speculative points have negative biases.
+                if ((newBias >= 0_mps) && (oldBias > newBias))
+                {
+                    newVc.SetVelocityBiasAtPoint(j, oldBias);
+                }
+            }
+            vc = newVc;
+        });
+    }
+
+    /// @brief Normal and tangent impulses of the points of a velocity constraint.
+    struct PointImpulses
+    {
+        Momentum2 normal = Momentum2{}; ///< Normal impulses.
+        Momentum2 tangent = Momentum2{}; ///< Tangent impulses.
+    };
 
-            return VelocityConstraint{friction, restitution, tangentSpeed, worldManifold,
-                *bodyConstraintA, *bodyConstraintB, conf};
+    /// @brief Adds the impulses of the given velocity constraints to the given sums.
+    /// @details Used to sum up the impulses of the sub-steps of the regular phase.
+    inline void AddImpulses(std::vector<PointImpulses>& sums,
+                            const VelocityConstraints& velConstraints)
+    {
+        assert(size(sums) == size(velConstraints));
+        for_each(cbegin(velConstraints), cend(velConstraints), [&](const VelocityConstraint& vc) {
+            auto& sum = sums[static_cast<std::size_t>(&vc - data(velConstraints))];
+            sum.normal += GetNormalImpulses(vc);
+            sum.tangent += GetTangentImpulses(vc);
+        });
+    }
+
+    /// @brief Sets the impulses of the given velocity constraints to the given sums.
+    inline void SetImpulses(VelocityConstraints& velConstraints,
+                            const std::vector<PointImpulses>& sums)
+    {
+        assert(size(sums) == size(velConstraints));
+        for_each(begin(velConstraints), end(velConstraints), [&](VelocityConstraint& vc) {
+            const auto& sum = sums[static_cast<std::size_t>(&vc - data(velConstraints))];
+            SetNormalImpulses(vc, sum.normal);
+            SetTangentImpulses(vc, sum.tangent);
         });
-        return velConstraints;
     }
 
     /// "Solves" the velocity constraints.
@@ -354,7 +669,17 @@ namespace {
         return minSeparation;
     }
 #endif
-    
+
+    /// @brief Gets the contact update configuration for the TOI phase.
+    /// @note TOI contacts are updated at their time of impact so speculative manifold
+    ///   points are never wanted for them.
+    inline Contact::UpdateConf GetToiUpdateConf(const StepConf& conf) noexcept
+    {
+        auto updateConf = Contact::GetUpdateConf(conf);
+        updateConf.speculativeTime = 0_s;
+        return updateConf;
+    }
+
     inline Time GetUnderActiveTime(const Body& b, const StepConf& conf) noexcept
     {
         const auto underactive = IsUnderActive(b.GetVelocity(), conf.linearSleepTolerance,
@@ -363,7 +688,7 @@ namespace {
         return (sleepable && underactive)? b.GetUnderActiveTime() + conf.GetTime(): 0_s;
     }
 
-    inline Time UpdateUnderActiveTimes(Island::Bodies& bodies, const StepConf& conf)
+    inline Time UpdateUnderActiveTimes(const Island::Bodies& bodies, const StepConf& conf)
     {
         auto minUnderActiveTime = std::numeric_limits<Time>::infinity();
         for_each(cbegin(bodies), cend(bodies), [&](Body *b)
@@ -378,7 +703,7 @@ namespace {
         return minUnderActiveTime;
     }
     
-    inline BodyCounter Sleepem(Island::Bodies& bodies)
+    inline BodyCounter Sleepem(const Island::Bodies& bodies)
     {
         auto unawoken = BodyCounter{0};
         for_each(cbegin(bodies), cend(bodies), [&](Body *b)
@@ -396,6 +721,23 @@ namespace {
         return state == TOIOutput::e_touching;
     }
     
+    /// @brief Whether the given contact needs processing by the world's step.
+    /// @details This is the case for contacts with an awake body and for contacts that
+    ///   need filtering.
+    inline bool IsAwakeContact(const KeyedContactPtr& c) noexcept
+    {
+        const auto& contact = GetRef(std::get<Contact*>(c));
+        return IsActive(contact) || contact.NeedsFiltering();
+    }
+    
+    void FlagContactsForFiltering(const Body& body) noexcept
+    {
+        for (auto& ci: body.GetContacts())
+        {
+            GetContactPtr(ci)->FlagForFiltering();
+        }
+    }
+    
     void FlagContactsForFiltering(const Body& bodyA, const Body& bodyB) noexcept
     {
         for (auto& ci: bodyB.GetContacts())
@@ -418,32 +760,62 @@ namespace {
 } // anonymous namespace
 
 World::World(const WorldConf& def):
-    m_tree{def.initialTreeSize},
+    m_tree{std::max(def.initialTreeSize, GetTreeCapacity(def.proxyCapacity))},
     m_minVertexRadius{def.minVertexRadius},
-    m_maxVertexRadius{def.maxVertexRadius}
+    m_maxVertexRadius{def.maxVertexRadius},
+    m_taskScheduler{def.taskScheduler},
+    m_stepProfiler{def.stepProfiler},
+    m_bodyStateBuffer{def.bodyStateBuffer},
+    m_shapeRegistry{def.shapeInterning? std::make_unique<ShapeRegistry>(): nullptr}
 {
     if (def.minVertexRadius > def.maxVertexRadius)
     {
         throw InvalidArgument("max vertex radius must be >= min vertex radius");
     }
-    m_proxyKeys.reserve(1024);
-    m_proxies.reserve(1024);
+    if (def.deterministic)
+    {
+        m_flags |= e_deterministic;
+    }
+    if (def.sensorOverlaps)
+    {
+        m_flags |= e_sensorOverlaps;
+    }
+    if (def.aabbSensorOverlaps)
+    {
+        m_flags |= e_aabbSensorOverlaps;
+    }
+    m_bodies.reserve(def.bodyCapacity);
+    m_awakeBodies.reserve(def.bodyCapacity);
+    m_contacts.reserve(def.contactCapacity);
+    m_joints.reserve(def.jointCapacity);
+    m_bodiesForProxies.reserve(def.bodyCapacity);
+    m_fixturesForProxies.reserve(def.proxyCapacity);
+    m_proxyKeys.reserve(std::max(std::size_t{1024}, std::size_t{def.proxyCapacity}));
+    m_proxies.reserve(std::max(std::size_t{1024}, std::size_t{def.proxyCapacity}));
 }
 
 World::World(const World& other):
     m_tree{other.m_tree},
     m_destructionListener{other.m_destructionListener},
     m_contactListener{other.m_contactListener},
+    m_contactEventBuffer{other.m_contactEventBuffer},
     m_flags{other.m_flags},
     m_inv_dt0{other.m_inv_dt0},
     m_minVertexRadius{other.m_minVertexRadius},
-    m_maxVertexRadius{other.m_maxVertexRadius}
+    m_maxVertexRadius{other.m_maxVertexRadius},
+    m_taskScheduler{other.m_taskScheduler},
+    m_stepProfiler{other.m_stepProfiler},
+    m_shapeRegistry{other.m_shapeRegistry?
+        std::make_unique<ShapeRegistry>(*other.m_shapeRegistry): nullptr}
 {
     auto bodyMap = std::map<const Body*, Body*>();
     auto fixtureMap = std::map<const Fixture*, Fixture*>();
     CopyBodies(bodyMap, fixtureMap, other.GetBodies());
+    CopyAwakeBodies(bodyMap, other.m_awakeBodies);
     CopyJoints(bodyMap, other.GetJoints());
     CopyContacts(bodyMap, fixtureMap, other.GetContacts());
+    CopySensors(fixtureMap, other);
+    m_sleepingContactCount = other.m_sleepingContactCount;
 }
 
 World& World::operator= (const World& other)
@@ -452,17 +824,26 @@ World& World::operator= (const World& other)
     
     m_destructionListener = other.m_destructionListener;
     m_contactListener = other.m_contactListener;
+    m_contactEventBuffer = other.m_contactEventBuffer;
     m_flags = other.m_flags;
     m_inv_dt0 = other.m_inv_dt0;
     m_minVertexRadius = other.m_minVertexRadius;
     m_maxVertexRadius = other.m_maxVertexRadius;
+    m_taskScheduler = other.m_taskScheduler;
+    m_stepProfiler = other.m_stepProfiler;
+    m_bodyStateBuffer = nullptr;
+    m_shapeRegistry = other.m_shapeRegistry?
+        std::make_unique<ShapeRegistry>(*other.m_shapeRegistry): nullptr;
     m_tree = other.m_tree;
 
     auto bodyMap = std::map<const Body*, Body*>();
     auto fixtureMap = std::map<const Fixture*, Fixture*>();
     CopyBodies(bodyMap, fixtureMap, other.GetBodies());
+    CopyAwakeBodies(bodyMap, other.m_awakeBodies);
     CopyJoints(bodyMap, other.GetJoints());
     CopyContacts(bodyMap, fixtureMap, other.GetContacts());
+    CopySensors(fixtureMap, other);
+    m_sleepingContactCount = other.m_sleepingContactCount;
 
     return *this;
 }
@@ -487,6 +868,7 @@ void World::InternalClear() noexcept
     m_proxies.clear();
     m_fixturesForProxies.clear();
     m_bodiesForProxies.clear();
+    m_sensorTouchedProxies.clear();
 
     for_each(cbegin(m_joints), cend(m_joints), [&](const Joint *j) {
         if (m_destructionListener)
@@ -516,8 +898,17 @@ void World::InternalClear() noexcept
     });
 
     m_bodies.clear();
+    m_awakeBodies.clear();
+    m_toiBodies.clear();
     m_joints.clear();
     m_contacts.clear();
+    m_sleepingContactCount = 0;
+    m_sensors.clear();
+    m_sensorOverlaps.clear();
+    if (m_shapeRegistry)
+    {
+        m_shapeRegistry->Clear();
+    }
 }
 
 void World::CopyBodies(std::map<const Body*, Body*>& bodyMap,
@@ -541,14 +932,49 @@ void World::CopyBodies(std::map<const Body*, Body*>& bodyMap,
             {
                 const auto fp = otherFixture.GetProxy(childIndex);
                 proxies[childIndex] = FixtureProxy{fp.treeId};
-                const auto newData = DynamicTree::LeafData{newBody, newFixture, childIndex};
+                const auto newData = GetLeafData(newBody, *newFixture, childIndex);
                 m_tree.SetLeafData(fp.treeId, newData);
             }
             FixtureAtty::SetProxies(*newFixture, std::move(proxies), childCount);
+            FixtureAtty::SetSharedProxy(*newFixture, otherFixture.HasSharedProxy());
+            if (otherFixture.GetChildTree())
+            {
+                FixtureAtty::SetChildTree(*newFixture, CreateChildTree(*newBody, *newFixture));
+            }
         }
         newBody->SetMassData(GetMassData(GetRef(otherBody)));
         bodyMap[GetPtr(otherBody)] = newBody;
     }
+    for (const auto& otherBody: range)
+    {
+        const auto next = BodyAtty::GetNextInIsland(GetRef(otherBody));
+        if (next)
+        {
+            BodyAtty::SetNextInIsland(*bodyMap.at(GetPtr(otherBody)), bodyMap.at(next));
+        }
+    }
+}
+
+void World::CopyAwakeBodies(const std::map<const Body*, Body*>& bodyMap, const Bodies& bodies)
+{
+    // The copied bodies got listed in the order they were created. Relist them in the
+    // order of the other world so the copy steps the same as it.
+    const auto created = m_awakeBodies;
+    for_each(begin(created), end(created), [](Body* body) {
+        BodyAtty::UnsetAwakeListed(*body);
+    });
+    m_awakeBodies.clear();
+    for (const auto& otherBody: bodies)
+    {
+        const auto body = bodyMap.at(otherBody);
+        if (body->IsAwake())
+        {
+            AddAwakeBody(*body);
+        }
+    }
+    for_each(begin(created), end(created), [&](Body* body) {
+        AddAwakeBody(*body);
+    });
 }
 
 void World::CopyContacts(const std::map<const Body*, Body*>& bodyMap,
@@ -592,6 +1018,24 @@ void World::CopyContacts(const std::map<const Body*, Body*>& bodyMap,
     }
 }
 
+void World::CopySensors(const std::map<const Fixture*, Fixture*>& fixtureMap, const World& other)
+{
+    for (auto&& sensor: other.m_sensors)
+    {
+        m_sensors.push_back(fixtureMap.at(sensor));
+    }
+    m_sensorOverlaps.reserve(size(other.m_sensorOverlaps));
+    for (auto&& overlap: other.m_sensorOverlaps)
+    {
+        auto newOverlap = overlap;
+        newOverlap.sensor = fixtureMap.at(overlap.sensor);
+        newOverlap.other = fixtureMap.at(overlap.other);
+        m_sensorOverlaps.push_back(newOverlap);
+    }
+    // The other world's tree got copied so its proxy identifiers are the same.
+    m_sensorTouchedProxies = other.m_sensorTouchedProxies;
+}
+
 void World::CopyJoints(const std::map<const Body*, Body*>& bodyMap,
                        SizedRange<World::Joints::const_iterator> range)
 {
@@ -726,6 +1170,7 @@ Body* World::CreateBody(const BodyConf& def)
         throw LengthError("World::CreateBody: operation would exceed MaxBodies");
     }
     
+    ReserveAwakeBodies(size(m_bodies) + 1);
     auto& b = *BodyAtty::CreateBody(this, def);
 
     // Add to world bodies collection.
@@ -737,13 +1182,75 @@ Body* World::CreateBody(const BodyConf& def)
     //   front).
     //
     m_bodies.push_back(&b);
+    if (b.IsAwake())
+    {
+        AddAwakeBody(b);
+    }
 
     return &b;
 }
 
+SizedRange<World::Bodies::iterator> World::CreateBodies(Span<const BodyConf> defs)
+{
+    if (IsLocked())
+    {
+        throw WrongState("World::CreateBodies: world is locked");
+    }
+    
+    const auto first = size(m_bodies);
+    if (size(defs) > MaxBodies - first)
+    {
+        throw LengthError("World::CreateBodies: operation would exceed MaxBodies");
+    }
+    
+    // Grows geometrically so repeated bulk creations stay amortized constant time.
+    if (first + size(defs) > m_bodies.capacity())
+    {
+        m_bodies.reserve(std::max(first + size(defs), m_bodies.capacity() * 2));
+    }
+    ReserveAwakeBodies(first + size(defs));
+    const auto numAwakeBodies = size(m_awakeBodies);
+    try
+    {
+        for (auto&& def: defs)
+        {
+            const auto body = BodyAtty::CreateBody(this, def);
+            m_bodies.push_back(body);
+            if (body->IsAwake())
+            {
+                AddAwakeBody(*body);
+            }
+        }
+    }
+    catch (...)
+    {
+        for_each(begin(m_bodies) + static_cast<Bodies::difference_type>(first), end(m_bodies),
+                 [](Body* b) { BodyAtty::Delete(b); });
+        m_bodies.resize(first);
+        m_awakeBodies.resize(numAwakeBodies);
+        throw;
+    }
+    return SizedRange<Bodies::iterator>{begin(m_bodies) + static_cast<Bodies::difference_type>(first),
+        end(m_bodies), size(defs)};
+}
+
+void World::ReserveAwakeBodies(Bodies::size_type count)
+{
+    // Grows geometrically so creating bodies one at a time stays amortized constant time.
+    if (count > m_awakeBodies.capacity())
+    {
+        m_awakeBodies.reserve(std::max(count, m_awakeBodies.capacity() * 2));
+    }
+}
+
 void World::Remove(const Body& b) noexcept
 {
     UnregisterForProxies(b);
+    if (BodyAtty::IsAwakeListed(b))
+    {
+        m_awakeBodies.erase(find(begin(m_awakeBodies), end(m_awakeBodies), &b));
+    }
+    m_toiBodies.erase(remove(begin(m_toiBodies), end(m_toiBodies), &b), end(m_toiBodies));
     const auto it = find_if(cbegin(m_bodies), cend(m_bodies), [&](const Bodies::value_type& body) {
         return GetPtr(body) == &b;
     });
@@ -764,6 +1271,12 @@ void World::Destroy(Body* body)
         throw WrongState("World::Destroy: world is locked");
     }
     
+    // Wake the body's sleeping island as a unit so the island isn't left linked to it.
+    if (body->IsSpeedable())
+    {
+        BodyAtty::SetAwakeFlag(*body);
+    }
+    
     // Delete the attached joints.
     BodyAtty::ClearJoints(*body, [&](Joint& joint) {
         if (m_destructionListener)
@@ -778,6 +1291,9 @@ void World::Destroy(Body* body)
         Destroy(&contact, body);
         return true;
     });
+    EraseSensorOverlaps([&](const Fixture& fixture) {
+        return fixture.GetBody() == body;
+    });
     
     // Delete the attached fixtures. This destroys broad-phase proxies.
     BodyAtty::ClearFixtures(*body, [&](Fixture& fixture) {
@@ -787,43 +1303,215 @@ void World::Destroy(Body* body)
         }
         UnregisterForProxies(fixture);
         DestroyProxies(fixture);
+        if (m_shapeRegistry)
+        {
+            m_shapeRegistry->Release(fixture.GetShape());
+        }
         FixtureAtty::Delete(&fixture);
     });
     
     Remove(*body);
 }
 
-Joint* World::CreateJoint(const JointConf& def)
+void World::DestroyBodies(Span<Body* const> bodies)
 {
     if (IsLocked())
     {
-        throw WrongState("World::CreateJoint: world is locked");
+        throw WrongState("World::DestroyBodies: world is locked");
     }
     
-    if (size(m_joints) >= MaxJoints)
+    auto doomed = std::vector<const Body*>(begin(bodies), end(bodies));
+    sort(begin(doomed), end(doomed));
+    if (std::adjacent_find(begin(doomed), end(doomed)) != end(doomed))
     {
-        throw LengthError("World::CreateJoint: operation would exceed MaxJoints");
+        throw InvalidArgument("World::DestroyBodies: duplicate body");
     }
+    const auto isDoomed = [&](const Body* body) {
+        return std::binary_search(begin(doomed), end(doomed), body);
+    };
     
-    // Note: creating a joint doesn't wake the bodies.
-    const auto j = JointAtty::Create(def);
-
-    Add(j);
- 
-    const auto bodyA = j->GetBodyA();
-    const auto bodyB = j->GetBodyB();
-
-    // If the joint prevents collisions, then flag any contacts for filtering.
-    if ((!def.collideConnected) && bodyA && bodyB)
+    auto contacts = std::vector<Contact*>{};
+    for (auto&& body: bodies)
     {
-        FlagContactsForFiltering(*bodyA, *bodyB);
+        assert(body->GetWorld() == this);
+        
+        // Wake the body's sleeping island as a unit so the island isn't left linked to it.
+        if (body->IsSpeedable())
+        {
+            BodyAtty::SetAwakeFlag(*body);
+        }
+        
+        BodyAtty::ClearJoints(*body, [&](Joint& joint) {
+            if (m_destructionListener)
+            {
+                m_destructionListener->SayGoodbye(joint);
+            }
+            InternalDestroy(joint);
+        });
+        
+        for (auto&& ci: body->GetContacts())
+        {
+            contacts.push_back(GetPtr(std::get<Contact*>(ci)));
+        }
     }
     
-    return j;
-}
-
-bool World::Add(Joint* j)
-{
+    // Contacts between two of the bodies were gathered from both.
+    sort(begin(contacts), end(contacts));
+    contacts.erase(unique(begin(contacts), end(contacts)), end(contacts));
+    const auto isContactDoomed = [&](const Contacts::value_type& c) {
+        return std::binary_search(begin(contacts), end(contacts), GetPtr(std::get<Contact*>(c)));
+    };
+    
+    // Removing is stable so the awake contacts still precede the sleeping ones.
+    const auto numSleepingErased = std::count_if(GetAwakeContactsEnd(), end(m_contacts),
+                                                 isContactDoomed);
+    m_contacts.erase(std::remove_if(begin(m_contacts), end(m_contacts), isContactDoomed),
+                     end(m_contacts));
+    m_sleepingContactCount -= static_cast<Contacts::size_type>(numSleepingErased);
+    for_each(begin(contacts), end(contacts), [&](Contact* contact) {
+        InternalDestroy(contact);
+    });
+    
+    m_fixturesForProxies.erase(std::remove_if(begin(m_fixturesForProxies), end(m_fixturesForProxies),
+                                              [&](const Fixture* f) {
+        return isDoomed(f->GetBody());
+    }), end(m_fixturesForProxies));
+    m_bodiesForProxies.erase(std::remove_if(begin(m_bodiesForProxies), end(m_bodiesForProxies),
+                                            isDoomed), end(m_bodiesForProxies));
+    EraseSensorOverlaps([&](const Fixture& fixture) {
+        return isDoomed(fixture.GetBody());
+    });
+    
+    for (auto&& body: bodies)
+    {
+        BodyAtty::ClearFixtures(*body, [&](Fixture& fixture) {
+            if (m_destructionListener)
+            {
+                m_destructionListener->SayGoodbye(fixture);
+            }
+            DestroyProxies(fixture);
+            if (m_shapeRegistry)
+            {
+                m_shapeRegistry->Release(fixture.GetShape());
+            }
+            FixtureAtty::Delete(&fixture);
+        });
+    }
+    
+    m_bodies.erase(std::remove_if(begin(m_bodies), end(m_bodies), isDoomed), end(m_bodies));
+    m_awakeBodies.erase(std::remove_if(begin(m_awakeBodies), end(m_awakeBodies), isDoomed),
+                        end(m_awakeBodies));
+    m_toiBodies.erase(std::remove_if(begin(m_toiBodies), end(m_toiBodies), isDoomed),
+                      end(m_toiBodies));
+    for_each(begin(bodies), end(bodies), [](Body* body) {
+        BodyAtty::Delete(body);
+    });
+}
+
+Body* World::Split(Body& body, Span<Fixture* const> fixtures)
+{
+    assert(body.GetWorld() == this);
+    
+    if (IsLocked())
+    {
+        throw WrongState("World::Split: world is locked");
+    }
+    
+    for (auto iter = begin(fixtures); iter != end(fixtures); ++iter)
+    {
+        if (!*iter || ((*iter)->GetBody() != &body))
+        {
+            throw InvalidArgument("World::Split: fixture not of body");
+        }
+        if (std::find(begin(fixtures), iter, *iter) != iter)
+        {
+            throw InvalidArgument("World::Split: duplicate fixture");
+        }
+    }
+    
+    const auto newBody = CreateBody(GetBodyConf(body));
+    
+    // The new body has no fixtures yet so its center is its origin.
+    BodyAtty::SetVelocity(*newBody, Velocity{
+        GetLinearVelocityFromWorldPoint(body, body.GetLocation()),
+        body.GetVelocity().angular
+    });
+    
+    for (auto&& fixture: fixtures)
+    {
+        BodyAtty::RemoveFixture(body, fixture);
+        BodyAtty::AddFixture(*newBody, fixture);
+        FixtureAtty::SetBody(*fixture, *newBody);
+        const auto proxyCount = fixture->GetProxyCount();
+        for (auto i = decltype(proxyCount){0}; i < proxyCount; ++i)
+        {
+            const auto treeId = fixture->GetProxy(i).treeId;
+            auto leafData = m_tree.GetLeafData(treeId);
+            leafData.body = newBody;
+            m_tree.SetLeafData(treeId, leafData);
+        }
+        
+        // Contacts with the fixtures remaining on the given body have to be found.
+        InternalTouchProxies(*fixture);
+    }
+    
+    // Moves contacts with other bodies to the new body. These may need re-filtering since
+    // the new body isn't attached to the given body's joints.
+    BodyAtty::EraseContacts(body, [&](Contact& contact) {
+        if ((contact.GetFixtureA()->GetBody() == newBody) ||
+            (contact.GetFixtureB()->GetBody() == newBody))
+        {
+            BodyAtty::Insert(*newBody, GetContactKey(contact), &contact);
+            contact.FlagForFiltering();
+            return true;
+        }
+        return false;
+    });
+    
+    SetWokenBodies();
+    SetNewFixtures();
+    
+    BodyAtty::SetMassDataDirty(body);
+    body.ResetMassData();
+    newBody->ResetMassData();
+    
+    return newBody;
+}
+
+Joint* World::CreateJoint(const JointConf& def)
+{
+    if (IsLocked())
+    {
+        throw WrongState("World::CreateJoint: world is locked");
+    }
+    
+    if (size(m_joints) >= MaxJoints)
+    {
+        throw LengthError("World::CreateJoint: operation would exceed MaxJoints");
+    }
+    
+    // Note: creating a joint doesn't wake the bodies.
+    const auto j = JointAtty::Create(def);
+
+    Add(j);
+ 
+    const auto bodyA = j->GetBodyA();
+    const auto bodyB = j->GetBodyB();
+
+    // If the joint prevents collisions, then flag any contacts for filtering.
+    if ((!def.collideConnected) && bodyA && bodyB)
+    {
+        FlagContactsForFiltering(*bodyA, *bodyB);
+        SetWokenBodies();
+        TouchSensorProxies(*bodyA);
+        TouchSensorProxies(*bodyB);
+    }
+    
+    return j;
+}
+
+bool World::Add(Joint* j)
+{
     assert(j);
     m_joints.push_back(j);
     const auto bodyA = j->GetBodyA();
@@ -881,10 +1569,13 @@ void World::InternalDestroy(Joint& joint) noexcept
     if ((!collideConnected) && bodyA && bodyB)
     {
         FlagContactsForFiltering(*bodyA, *bodyB);
+        SetWokenBodies();
+        TouchSensorProxies(*bodyA);
+        TouchSensorProxies(*bodyB);
     }
 }
 
-void World::AddToIsland(Island& island, Body& seed,
+void World::AddToIsland(Island& island, BodyStack& stack, Body& seed,
                   Bodies::size_type& remNumBodies,
                   Contacts::size_type& remNumContacts,
                   Joints::size_type& remNumJoints)
@@ -897,11 +1588,7 @@ void World::AddToIsland(Island& island, Body& seed,
     assert(remNumBodies < MaxBodies);
     
     // Perform a depth first search (DFS) on the constraint graph.
-
-    // Create a stack for bodies to be is-in-island that aren't already in the island.
-    auto stack = BodyStack{};
-    stack.reserve(remNumBodies);
-
+    assert(empty(stack));
     stack.push_back(&seed);
     SetIslanded(&seed);
     AddToIsland(island, stack, remNumBodies, remNumContacts, remNumJoints);
@@ -1018,8 +1705,9 @@ World::Bodies::size_type World::RemoveUnspeedablesFromIslanded(const std::vector
     return numRemoved;
 }
 
-RegStepStats World::SolveReg(const StepConf& conf)
+RegStepStats World::SolveReg(const StepConf& conf, StepPhaseTimes& times)
 {
+    static_cast<void>(times); // Unused unless profiling is enabled.
     auto stats = RegStepStats{};
     assert(stats.islandsFound == 0);
     assert(stats.islandsSolved == 0);
@@ -1028,95 +1716,220 @@ RegStepStats World::SolveReg(const StepConf& conf)
     auto remNumContacts = size(m_contacts); ///< Remaining number of contacts.
     auto remNumJoints = size(m_joints); ///< Remaining number of joints.
 
-    // Clear all the island flags.
-    // This builds the logical set of bodies, contacts, and joints eligible for resolution.
-    // As bodies, contacts, or joints get added to resolution islands, they're essentially
-    // removed from this eligible set.
-    for_each(begin(m_bodies), end(m_bodies), [](Bodies::value_type& b) {
-        BodyAtty::UnsetIslanded(GetRef(b));
-    });
-    for_each(begin(m_contacts), end(m_contacts), [](Contacts::value_type& c) {
-        ContactAtty::UnsetIslanded(GetRef(std::get<Contact*>(c)));
-    });
-    for_each(begin(m_joints), end(m_joints), [](Joints::value_type& j) {
-        JointAtty::UnsetIslanded(GetRef(j));
-    });
+    // Bodies, contacts, and joints without their island flags set make up the logical set
+    // eligible for resolution. As they get added to resolution islands, they're essentially
+    // removed from this eligible set. Island flags of contacts and joints are unset when
+    // their island gets solved and those of bodies are unset when their proxies get
+    // synchronized below, so there's no clearing of flags here.
+    assert(std::none_of(begin(m_contacts), GetAwakeContactsEnd(), [](Contacts::value_type& c) {
+        return ContactAtty::IsIslanded(GetRef(std::get<Contact*>(c)));
+    }));
 
-#if defined(DO_THREADED)
-    std::vector<std::future<World::IslandSolverResults>> futures;
-    futures.reserve(remNumBodies);
-#endif
-    // Build and simulate all awake islands.
-    for (auto&& b: m_bodies)
+    // Speedable bodies added to islands this step.
+    auto islandedBodies = std::vector<Body*>{};
+    islandedBodies.reserve(size(m_awakeBodies));
+
+    // Islands to solve with the task scheduler. Island building is sequential, but as
+    // islands don't share any speedable bodies, contacts, or joints, they can be solved
+    // in parallel with each other.
+    auto islands = std::vector<Island>{};
+
+    // Island and stack every island gets built with. These are reused so their capacities
+    // grow to that of the biggest island rather than getting allocated for every island.
+    auto island = Island{0, 0, 0};
+    auto stack = BodyStack{};
+
+    // Build and simulate all awake islands. Islands are only seeded from the awake bodies
+    // list so sleeping bodies cost nothing here. Bodies woken while building islands get
+    // appended to the list, so it's walked by index. Bodies found asleep that weren't
+    // islanded this step are dropped from the list as it's walked.
+    auto numAwakeBodies = Bodies::size_type{0};
+    for (auto i = Bodies::size_type{0}; i < size(m_awakeBodies); ++i)
     {
-        auto& body = GetRef(b);
-        assert(!body.IsAwake() || body.IsSpeedable());
-        if (!IsIslanded(&body) && body.IsAwake() && body.IsEnabled())
+        auto& body = *m_awakeBodies[i];
+        assert(BodyAtty::IsAwakeListed(body));
+        if (!body.IsAwake() && !IsIslanded(&body))
+        {
+            BodyAtty::UnsetAwakeListed(body);
+            continue;
+        }
+        m_awakeBodies[numAwakeBodies++] = &body;
+        assert(body.IsSpeedable());
+        if (!IsIslanded(&body) && body.IsEnabled())
         {
             ++stats.islandsFound;
 
-            // Size the island for the remaining un-evaluated bodies, contacts, and joints.
-            Island island(remNumBodies, remNumContacts, remNumJoints);
+            {
+                PLAYRHO_PROFILE_SCOPE(buildScope, StepPhase::IslandBuild, m_stepProfiler,
+                                      &Get(times, StepPhase::IslandBuild));
+                island.m_bodies.clear();
+                island.m_contacts.clear();
+                island.m_joints.clear();
+                AddToIsland(island, stack, body, remNumBodies, remNumContacts, remNumJoints);
+                remNumBodies += RemoveUnspeedablesFromIslanded(island.m_bodies);
+                std::copy_if(cbegin(island.m_bodies), cend(island.m_bodies),
+                             std::back_inserter(islandedBodies),
+                             [](Body* b) { return b->IsSpeedable(); });
+            }
 
-            AddToIsland(island, body, remNumBodies, remNumContacts, remNumJoints);
-            remNumBodies += RemoveUnspeedablesFromIslanded(island.m_bodies);
+            if (m_taskScheduler)
+            {
+                // Copying allocates just what the island needs.
+                islands.push_back(island);
+            }
+            else
+            {
+                // Updates bodies' sweep.pos0 to current sweep.pos1 and bodies' sweep.pos1 to new positions
+                PLAYRHO_PROFILE_SCOPE(solveScope, StepPhase::Solve, m_stepProfiler,
+                                      &Get(times, StepPhase::Solve));
+                const auto solverResults = SolveRegIslandViaGS(conf, island, m_contactListener,
+                                                                m_contactEventBuffer, &times);
+                Update(stats, solverResults);
+            }
+        }
+    }
+    m_awakeBodies.resize(numAwakeBodies);
 
-#if defined(DO_THREADED)
-            // Updates bodies' sweep.pos0 to current sweep.pos1 and bodies' sweep.pos1 to new positions
-            futures.push_back(std::async(std::launch::async, &World::SolveRegIslandViaGS,
-                                         this, conf, island));
-#else
-            const auto solverResults = SolveRegIslandViaGS(conf, island);
+    if (!empty(islands))
+    {
+        PLAYRHO_PROFILE_SCOPE(solveScope, StepPhase::Solve, m_stepProfiler,
+                              &Get(times, StepPhase::Solve));
+        // Results are reduced in island order (and not as islands finish) so the statistics
+        // don't depend on how the islands got scheduled.
+        auto results = std::vector<IslandStats>(size(islands));
+        auto recorders = std::vector<ContactCallRecorder>(
+            (m_contactListener && IsDeterministic())? size(islands): std::size_t{0});
+        auto events = std::vector<ContactEventBuffer>(
+            m_contactEventBuffer? size(islands): std::size_t{0});
+        auto islandTimes = std::vector<StepPhaseTimes>(
+            IsStepProfilingEnabled()? size(islands): std::size_t{0});
+        m_taskScheduler->ParallelFor(size(islands), 1, [&](std::size_t first, std::size_t last) {
+            PLAYRHO_PROFILE_SCOPE(taskScope, StepPhase::Solve, m_stepProfiler, nullptr);
+            for (auto i = first; i < last; ++i)
+            {
+                const auto listener = empty(recorders)? m_contactListener: &recorders[i];
+                const auto islandEvents = empty(events)? nullptr: &events[i];
+                const auto islandTime = empty(islandTimes)? nullptr: &islandTimes[i];
+                results[i] = SolveRegIslandViaGS(conf, islands[i], listener,
+                                                 islandEvents, islandTime);
+            }
+        });
+        for (auto&& recorder: recorders)
+        {
+            recorder.Replay(*m_contactListener);
+        }
+        for (auto&& islandEvents: events)
+        {
+            m_contactEventBuffer->Append(islandEvents);
+        }
+        for (auto&& solverResults: results)
+        {
             Update(stats, solverResults);
-#endif
+        }
+        for (auto&& islandTime: islandTimes)
+        {
+            for (auto phase: {StepPhase::VelocitySolve, StepPhase::PositionSolve})
+            {
+                Get(times, phase).wall += Get(islandTime, phase).wall;
+                Get(times, phase).cpu += Get(islandTime, phase).cpu;
+            }
         }
     }
 
-#if defined(DO_THREADED)
-    for (auto&& future: futures)
+    if (stats.bodiesSlept > 0)
     {
-        const auto solverResults = future.get();
-        Update(stats, solverResults);
+        SleepContacts();
     }
-#endif
 
-    for (auto&& b: m_bodies)
     {
-        auto& body = GetRef(b);
-        // A non-static body that was in an island may have moved.
-        if (IsIslanded(&body) && body.IsSpeedable())
+        PLAYRHO_PROFILE_SCOPE(syncScope, StepPhase::ProxySync, m_stepProfiler,
+                              &Get(times, StepPhase::ProxySync));
+        // Finding the bodies whose proxies need updating only reads the tree, so that's
+        // done in parallel. The tree gets updated serially in the order of the bodies.
+        auto needsSync = std::vector<std::uint8_t>{};
+        if (m_taskScheduler && (size(islandedBodies) > ProxySyncGrainSize))
+        {
+            needsSync.resize(size(islandedBodies));
+            m_taskScheduler->ParallelFor(size(islandedBodies), ProxySyncGrainSize,
+                                         [&](std::size_t first, std::size_t last) {
+                PLAYRHO_PROFILE_SCOPE(taskScope, StepPhase::ProxySync, m_stepProfiler, nullptr);
+                for (auto i = first; i < last; ++i)
+                {
+                    const auto body = islandedBodies[i];
+                    needsSync[i] = NeedsSynchronizing(m_tree, *body,
+                                                      GetTransform0(body->GetSweep()),
+                                                      body->GetTransformation());
+                }
+            });
+        }
+        for (auto i = std::size_t{0}; i < size(islandedBodies); ++i)
         {
+            // A non-static body that was in an island may have moved.
+            const auto body = islandedBodies[i];
+            assert(IsIslanded(body));
+            UnsetIslanded(body);
             // Update fixtures (for broad-phase).
-            stats.proxiesMoved += Synchronize(body, GetTransform0(body.GetSweep()), body.GetTransformation(),
-                        conf.displaceMultiplier, conf.aabbExtension);
+            if (empty(needsSync) || needsSync[i])
+            {
+                stats.proxiesMoved += Synchronize(*body, GetTransform0(body->GetSweep()),
+                                                  body->GetTransformation(),
+                                                  conf.displaceMultiplier,
+                                                  conf.aabbExtension);
+            }
+            if (!body->IsAwake())
+            {
+                // Put to sleep this step so its sensor overlaps need testing again as it
+                // may have moved within its proxies' enlarged AABBs. This is done here
+                // rather than in Sleepem since islands may have been solved in parallel.
+                TouchSensorProxies(*body);
+            }
         }
     }
 
     // Look for new contacts.
+    PLAYRHO_PROFILE_SCOPE(findScope, StepPhase::FindNewContacts, m_stepProfiler,
+                          &Get(times, StepPhase::FindNewContacts));
     stats.contactsAdded = FindNewContacts();
     
     return stats;
 }
 
-IslandStats World::SolveRegIslandViaGS(const StepConf& conf, Island island)
+IslandStats World::SolveRegIslandViaGS(const StepConf& conf, const Island& island,
+                                       ContactListener* listener,
+                                       ContactEventBuffer* events,
+                                       StepPhaseTimes* times)
 {
     assert(!empty(island.m_bodies) || !empty(island.m_contacts) || !empty(island.m_joints));
+    static_cast<void>(times); // Unused unless profiling is enabled.
     
     auto results = IslandStats{};
     results.positionIterations = conf.regPositionIterations;
     const auto h = conf.GetTime(); ///< Time step.
 
     // Update bodies' pos0 values.
+    // Unspeedable bodies are skipped as they can be in other islands being solved at the
+    // same time and their positions don't change anyway.
     for_each(cbegin(island.m_bodies), cend(island.m_bodies), [&](Body* body) {
-        BodyAtty::SetPosition0(*body, GetPosition1(*body)); // like Advance0(1) on the sweep.
+        if (body->IsSpeedable())
+        {
+            BodyAtty::SetPosition0(*body, GetPosition1(*body)); // like Advance0(1) on the sweep.
+        }
     });
     
     // Copy bodies' pos1 and velocity data into local arrays.
-    auto bodyConstraints = GetBodyConstraints(island.m_bodies, h, GetMovementConf(conf));
+    // When sub-stepping, velocities are only integrated for the first sub-step here.
+    const auto subConf = GetRegSubStepConf(conf);
+    const auto subMovementConf = GetMovementConf(subConf);
+    auto vcConf = GetRegVelocityConstraintConf(subConf);
+    if (conf.regSubSteps > 0)
+    {
+        // Manifolds have the impulses of whole steps but these are of single sub-steps.
+        vcConf.dtRatio /= static_cast<Real>(conf.regSubSteps);
+    }
+    auto bodyConstraints = GetBodyConstraints(island.m_bodies, subConf.GetTime(), subMovementConf);
     auto bodyConstraintsMap = GetBodyConstraintsMap(island.m_bodies, bodyConstraints);
     auto posConstraints = GetPositionConstraints(island.m_contacts, bodyConstraintsMap);
-    auto velConstraints = GetVelocityConstraints(island.m_contacts, bodyConstraintsMap,
-                                                      GetRegVelocityConstraintConf(conf));
+    auto velConstraints = GetVelocityConstraints(island.m_contacts, bodyConstraintsMap, vcConf);
     
     if (conf.doWarmStart)
     {
@@ -1125,56 +1938,131 @@ IslandStats World::SolveRegIslandViaGS(const StepConf& conf, Island island)
 
     const auto psConf = GetRegConstraintSolverConf(conf);
 
-    for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* joint) {
-        JointAtty::InitVelocityConstraints(*joint, bodyConstraintsMap, conf, psConf);
-    });
-    
-    results.velocityIterations = conf.regVelocityIterations;
-    for (auto i = decltype(conf.regVelocityIterations){0}; i < conf.regVelocityIterations; ++i)
+    auto stepImpulses = std::vector<PointImpulses>{};
+    if (conf.regSubSteps > 0)
     {
-        auto jointsOkay = true;
-        for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
-            jointsOkay &= JointAtty::SolveVelocityConstraints(*j, bodyConstraintsMap, conf);
-        });
+        // The constraints get updated for the positions of every sub-step and get warm
+        // started with the impulses of the sub-step before. The contacts' impulses of the
+        // sub-steps get summed up so they're reported as those of the step.
+        results.velocityIterations = conf.regSubSteps;
+        results.positionIterations = conf.regSubSteps;
+        results.solved = true;
+        stepImpulses.resize(size(velConstraints));
+        auto jointConf = subConf;
+        for (auto i = decltype(conf.regSubSteps){0}; i < conf.regSubSteps; ++i)
+        {
+            {
+                PLAYRHO_PROFILE_SCOPE(velocityScope, StepPhase::VelocitySolve, m_stepProfiler,
+                                      GetPhaseTime(times, StepPhase::VelocitySolve));
+                if (i > 0)
+                {
+                    IntegrateVelocities(bodyConstraints, island.m_bodies, subConf.GetTime(),
+                                        subMovementConf);
+                    UpdateVelocityConstraints(velConstraints, island.m_contacts,
+                                              bodyConstraintsMap, vcConf);
+                    WarmStartVelocities(velConstraints);
+                    jointConf.dtRatio = 1;
+                    jointConf.doWarmStart = true;
+                }
 
-        // Note that the new incremental impulse can potentially be orders of magnitude
-        // greater than the last incremental impulse used in this loop.
-        const auto newIncImpulse = SolveVelocityConstraintsViaGS(velConstraints);
-        results.maxIncImpulse = std::max(results.maxIncImpulse, newIncImpulse);
+                // Joints store their own impulses which so are those of the last sub-step.
+                for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* joint) {
+                    JointAtty::InitVelocityConstraints(*joint, bodyConstraintsMap, jointConf,
+                                                       psConf);
+                });
+                for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
+                    JointAtty::SolveVelocityConstraints(*j, bodyConstraintsMap, subConf);
+                });
+                const auto newIncImpulse = SolveVelocityConstraintsViaGS(velConstraints);
+                results.maxIncImpulse = std::max(results.maxIncImpulse, newIncImpulse);
+                AddImpulses(stepImpulses, velConstraints);
+            }
 
-        if (jointsOkay && (newIncImpulse <= conf.regMinMomentum))
-        {
-            // No joint related velocity constraints were out of tolerance.
-            // No body related velocity constraints were out of tolerance.
-            // There does not appear to be any benefit to doing more loops now.
-            // XXX: Is it really safe to bail now? Not certain of that.
-            // Bail now assuming that this is helpful to do...
-            results.velocityIterations = i + 1;
-            break;
+            PLAYRHO_PROFILE_SCOPE(positionScope, StepPhase::PositionSolve, m_stepProfiler,
+                                  GetPhaseTime(times, StepPhase::PositionSolve));
+            IntegratePositions(bodyConstraints, subConf.GetTime());
+
+            // Relax the positions once per sub-step. The remaining error gets worked off
+            // by the following sub-steps.
+            const auto minSeparation = SolvePositionConstraintsViaGS(posConstraints, psConf);
+            results.minSeparation = std::min(results.minSeparation, minSeparation);
+            auto jointsOkay = true;
+            for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
+                jointsOkay &= JointAtty::SolvePositionConstraints(*j, bodyConstraintsMap, psConf);
+            });
+            // Solved only if within tolerance for every one of the sub-steps.
+            results.solved = results.solved && jointsOkay &&
+                (minSeparation >= conf.regMinSeparation);
         }
+        // The last sub-step's impulses warm start the next step better than the average
+        // of the sub-steps' impulses does, so those are what get stored, scaled to the step.
+        const auto n = static_cast<Real>(conf.regSubSteps);
+        for_each(begin(velConstraints), end(velConstraints), [&](VelocityConstraint& vc) {
+            SetNormalImpulses(vc, GetNormalImpulses(vc) * n);
+            SetTangentImpulses(vc, GetTangentImpulses(vc) * n);
+        });
     }
-    
-    // updates array of tentative new body positions per the velocities as if there were no obstacles...
-    IntegratePositions(bodyConstraints, h);
-    
-    // Solve position constraints
-    for (auto i = decltype(conf.regPositionIterations){0}; i < conf.regPositionIterations; ++i)
+    else
     {
-        const auto minSeparation = SolvePositionConstraintsViaGS(posConstraints, psConf);
-        results.minSeparation = std::min(results.minSeparation, minSeparation);
-        const auto contactsOkay = (minSeparation >= conf.regMinSeparation);
+        {
+            PLAYRHO_PROFILE_SCOPE(velocityScope, StepPhase::VelocitySolve, m_stepProfiler,
+                                  GetPhaseTime(times, StepPhase::VelocitySolve));
+            for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* joint) {
+                JointAtty::InitVelocityConstraints(*joint, bodyConstraintsMap, conf, psConf);
+            });
+            
+            results.velocityIterations = conf.regVelocityIterations;
+            for (auto i = decltype(conf.regVelocityIterations){0};
+                 i < conf.regVelocityIterations; ++i)
+            {
+                auto jointsOkay = true;
+                for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
+                    jointsOkay &= JointAtty::SolveVelocityConstraints(*j, bodyConstraintsMap,
+                                                                      conf);
+                });
+
+                // Note that the new incremental impulse can potentially be orders of magnitude
+                // greater than the last incremental impulse used in this loop.
+                const auto newIncImpulse = SolveVelocityConstraintsViaGS(velConstraints);
+                results.maxIncImpulse = std::max(results.maxIncImpulse, newIncImpulse);
+
+                if (jointsOkay && (newIncImpulse <= conf.regMinMomentum))
+                {
+                    // No joint related velocity constraints were out of tolerance.
+                    // No body related velocity constraints were out of tolerance.
+                    // There does not appear to be any benefit to doing more loops now.
+                    // XXX: Is it really safe to bail now? Not certain of that.
+                    // Bail now assuming that this is helpful to do...
+                    results.velocityIterations = i + 1;
+                    break;
+                }
+            }
+        }
+        
+        PLAYRHO_PROFILE_SCOPE(positionScope, StepPhase::PositionSolve, m_stepProfiler,
+                              GetPhaseTime(times, StepPhase::PositionSolve));
+        // updates array of tentative new body positions per the velocities as if there were no obstacles...
+        IntegratePositions(bodyConstraints, h);
+        
+        // Solve position constraints
+        for (auto i = decltype(conf.regPositionIterations){0}; i < conf.regPositionIterations; ++i)
+        {
+            const auto minSeparation = SolvePositionConstraintsViaGS(posConstraints, psConf);
+            results.minSeparation = std::min(results.minSeparation, minSeparation);
+            const auto contactsOkay = (minSeparation >= conf.regMinSeparation);
 
-        auto jointsOkay = true;
-        for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
-            jointsOkay &= JointAtty::SolvePositionConstraints(*j, bodyConstraintsMap, psConf);
-        });
+            auto jointsOkay = true;
+            for_each(cbegin(island.m_joints), cend(island.m_joints), [&](Joint* j) {
+                jointsOkay &= JointAtty::SolvePositionConstraints(*j, bodyConstraintsMap, psConf);
+            });
 
-        if (contactsOkay && jointsOkay)
-        {
-            // Reached tolerance, early out...
-            results.positionIterations = i + 1;
-            results.solved = true;
-            break;
+            if (contactsOkay && jointsOkay)
+            {
+                // Reached tolerance, early out...
+                results.positionIterations = i + 1;
+                results.solved = true;
+                break;
+            }
         }
     }
     
@@ -1190,14 +2078,27 @@ IslandStats World::SolveRegIslandViaGS(const StepConf& conf, Island island)
         assert(i < size(bodyConstraints));
         // Could normalize position here to avoid unbounded angles but angular
         // normalization isn't handled correctly by joints that constrain rotation.
-        UpdateBody(*island.m_bodies[i], bc.GetPosition(), bc.GetVelocity());
+        auto& body = *island.m_bodies[i];
+        if (body.IsSpeedable())
+        {
+            UpdateBody(body, bc.GetPosition(), bc.GetVelocity());
+        }
     });
     
     // XXX: Should contacts needing updating be updated now??
 
-    if (m_contactListener)
+    if (conf.regSubSteps > 0)
+    {
+        SetImpulses(velConstraints, stepImpulses);
+    }
+    if (listener)
     {
-        Report(*m_contactListener, island.m_contacts, velConstraints,
+        Report(*listener, island.m_contacts, velConstraints,
+               results.solved? results.positionIterations - 1: StepConf::InvalidIteration);
+    }
+    if (events)
+    {
+        Report(*events, island.m_contacts, velConstraints,
                results.solved? results.positionIterations - 1: StepConf::InvalidIteration);
     }
     
@@ -1207,22 +2108,60 @@ IslandStats World::SolveRegIslandViaGS(const StepConf& conf, Island island)
     {
         results.bodiesSlept = static_cast<decltype(results.bodiesSlept)>(Sleepem(island.m_bodies));
     }
+    if (results.bodiesSlept > 0)
+    {
+        // Link the island's bodies into a ring so waking any of them wakes all of them.
+        // This is safe to do concurrently since islands don't share speedable bodies.
+        auto first = static_cast<Body*>(nullptr);
+        auto last = static_cast<Body*>(nullptr);
+        for_each(cbegin(island.m_bodies), cend(island.m_bodies), [&](Body* body) {
+            if (body->IsSpeedable() && !body->IsAwake())
+            {
+                assert(!BodyAtty::GetNextInIsland(*body));
+                if (last)
+                {
+                    BodyAtty::SetNextInIsland(*last, body);
+                }
+                else
+                {
+                    first = body;
+                }
+                last = body;
+            }
+        });
+        if (last)
+        {
+            BodyAtty::SetNextInIsland(*last, first);
+        }
+    }
+    
+    // Unset the island flags now rather than for all contacts and joints every step.
+    for_each(cbegin(island.m_contacts), cend(island.m_contacts), [](Contact* contact) {
+        ContactAtty::UnsetIslanded(*contact);
+    });
+    for_each(cbegin(island.m_joints), cend(island.m_joints), [](Joint* joint) {
+        JointAtty::UnsetIslanded(*joint);
+    });
 
     return results;
 }
 
 void World::ResetBodiesForSolveTOI() noexcept
 {
-    for_each(begin(m_bodies), end(m_bodies), [&](Bodies::value_type& body) {
-        auto& b = GetRef(body);
-        BodyAtty::UnsetIslanded(b);
-        BodyAtty::ResetAlpha0(b);
+    // Island flags of bodies are unset as their islands get handled, and only bodies that
+    // the time of impact phase advanced can have non-zero alpha-0 values.
+    assert(std::none_of(begin(m_bodies), end(m_bodies), [](Bodies::value_type& body) {
+        return BodyAtty::IsIslanded(GetRef(body));
+    }));
+    for_each(begin(m_toiBodies), end(m_toiBodies), [&](Body* body) {
+        BodyAtty::ResetAlpha0(*body);
     });
+    m_toiBodies.clear();
 }
 
 void World::ResetContactsForSolveTOI() noexcept
 {
-    for_each(begin(m_contacts), end(m_contacts), [&](Contacts::value_type &c) {
+    for_each(begin(m_contacts), GetAwakeContactsEnd(), [&](Contacts::value_type &c) {
         auto& contact = GetRef(std::get<Contact*>(c));
         ContactAtty::UnsetIslanded(contact);
         ContactAtty::UnsetToi(contact);
@@ -1234,9 +2173,12 @@ World::UpdateContactsData World::UpdateContactTOIs(const StepConf& conf)
 {
     auto results = UpdateContactsData{};
 
+    // Bodies woken by the previous time of impact island need their contacts considered.
+    WakeContacts();
+
     const auto toiConf = GetToiConf(conf);
     
-    for (auto&& contact: m_contacts)
+    for (auto&& contact: Range<Contacts::iterator>{begin(m_contacts), GetAwakeContactsEnd()})
     {
         auto& c = GetRef(std::get<Contact*>(contact));
         if (c.HasValidToi())
@@ -1271,6 +2213,13 @@ World::UpdateContactsData World::UpdateContactTOIs(const StepConf& conf)
          */
         const auto alpha0 = std::max(bA->GetSweep().GetAlpha0(), bB->GetSweep().GetAlpha0());
         assert(alpha0 >= 0 && alpha0 < 1);
+        for (auto&& body: {bA, bB})
+        {
+            if ((body->GetSweep().GetAlpha0() == 0) && (alpha0 != 0))
+            {
+                m_toiBodies.push_back(body);
+            }
+        }
         BodyAtty::Advance0(*bA, alpha0);
         BodyAtty::Advance0(*bB, alpha0);
         
@@ -1299,7 +2248,7 @@ World::ContactToiData World::GetSoonestContact() const noexcept
     auto minToi = nextafter(Real{1}, Real{0});
     auto found = static_cast<Contact*>(nullptr);
     auto count = ContactCounter{0};
-    for (auto&& contact: m_contacts)
+    for (auto&& contact: Range<Contacts::const_iterator>{cbegin(m_contacts), GetAwakeContactsEnd()})
     {
         const auto c = GetPtr(std::get<Contact*>(contact));
         if (c->HasValidToi())
@@ -1357,6 +2306,7 @@ ToiStepStats World::SolveToi(const StepConf& conf)
                                           static_cast<decltype(stats.maxSimulContacts)>(ncount));
         stats.contactsFound += ncount;
         auto islandsFound = 0u;
+        const auto numToiBodies = size(m_toiBodies);
         if (!IsIslanded(contact))
         {
             /*
@@ -1383,10 +2333,11 @@ ToiStepStats World::SolveToi(const StepConf& conf)
         }
         stats.islandsFound += islandsFound;
 
-        // Reset island flags and synchronize broad-phase proxies.
-        for (auto&& b: m_bodies)
+        // Reset island flags and synchronize broad-phase proxies of the island's bodies.
+        // These are the bodies just added to the TOI bodies that are still islanded.
+        for (auto i = numToiBodies; i < size(m_toiBodies); ++i)
         {
-            auto& body = GetRef(b);
+            auto& body = *m_toiBodies[i];
             if (IsIslanded(&body))
             {
                 UnsetIslanded(&body);
@@ -1456,7 +2407,8 @@ IslandStats World::SolveToi(const StepConf& conf, Contact& contact)
         contact.SetEnabled();
         if (contact.NeedsUpdating())
         {
-            ContactAtty::Update(contact, Contact::GetUpdateConf(conf), m_contactListener);
+            UpdateContact(contact, GetToiUpdateConf(conf), m_contactListener,
+                          m_contactEventBuffer);
             ++contactsUpdated;
         }
         else
@@ -1512,8 +2464,10 @@ IslandStats World::SolveToi(const StepConf& conf, Contact& contact)
         //   Calling Body::ResetUnderActiveTime() has performance implications.
     }
 
-    // Build the island
-    Island island(size(m_bodies), size(m_contacts), 0);
+    // Build the island. It starts with room for just the two bodies and the contact, as
+    // reserving room for all of the world's bodies and contacts for every time of impact
+    // was most of the memory allocated by stepping.
+    Island island(2, 1, 0);
 
      // These asserts get triggered sometimes if contacts within TOI are iterated over.
     assert(!IsIslanded(bA));
@@ -1543,6 +2497,9 @@ IslandStats World::SolveToi(const StepConf& conf, Contact& contact)
     }
     
     RemoveUnspeedablesFromIslanded(island.m_bodies);
+    
+    // The island's bodies have all been advanced and need their alpha-0 values reset.
+    m_toiBodies.insert(end(m_toiBodies), cbegin(island.m_bodies), cend(island.m_bodies));
 
     // Now solve for remainder of time step.
     //
@@ -1566,6 +2523,25 @@ void World::UpdateBody(Body& body, const Position& pos, const Velocity& vel)
     BodyAtty::SetTransformation(body, GetTransformation(GetPosition1(body), body.GetLocalCenter()));
 }
 
+void World::UpdateContact(Contact& contact, const Contact::UpdateConf& conf,
+                          ContactListener* listener, ContactEventBuffer* events)
+{
+    const auto wasTouching = contact.IsTouching();
+    ContactAtty::Update(contact, conf, listener);
+    if (events)
+    {
+        const auto touching = contact.IsTouching();
+        if (!wasTouching && touching)
+        {
+            events->AddBegin(contact);
+        }
+        else if (wasTouching && !touching)
+        {
+            events->AddEnd(contact);
+        }
+    }
+}
+
 IslandStats World::SolveToiViaGS(const StepConf& conf, Island& island)
 {
     auto results = IslandStats{};
@@ -1687,6 +2663,10 @@ IslandStats World::SolveToiViaGS(const StepConf& conf, Island& island)
     {
         Report(*m_contactListener, island.m_contacts, velConstraints, results.positionIterations);
     }
+    if (m_contactEventBuffer)
+    {
+        Report(*m_contactEventBuffer, island.m_contacts, velConstraints, results.positionIterations);
+    }
     
     return results;
 }
@@ -1714,7 +2694,7 @@ World::ProcessContactsForTOI(Island& island, Body& body, Real toi,
     assert(results.contactsUpdated == 0);
     assert(results.contactsSkipped == 0);
     
-    const auto updateConf = Contact::GetUpdateConf(conf);
+    const auto updateConf = GetToiUpdateConf(conf);
 
     auto processContactFunc = [&](Contact* contact, Body* other)
     {
@@ -1730,7 +2710,7 @@ World::ProcessContactsForTOI(Island& island, Body& body, Real toi,
             contact->SetEnabled();
             if (contact->NeedsUpdating())
             {
-                ContactAtty::Update(*contact, updateConf, m_contactListener);
+                UpdateContact(*contact, updateConf, m_contactListener, m_contactEventBuffer);
                 ++results.contactsUpdated;
             }
             else
@@ -1816,18 +2796,27 @@ StepStats World::Step(const StepConf& conf)
     {
         FlagGuard<decltype(m_flags)> flagGaurd(m_flags, e_locked);
 
-        CreateAndDestroyProxies(conf);
-        stepStats.pre.proxiesMoved = SynchronizeProxies(conf);
-        // pre.proxiesMoved is usually zero but sometimes isn't.
+        {
+            PLAYRHO_PROFILE_SCOPE(syncScope, StepPhase::ProxySync, m_stepProfiler,
+                                  &Get(stepStats.times, StepPhase::ProxySync));
+            CreateAndDestroyProxies(conf);
+            stepStats.pre.proxiesMoved = SynchronizeProxies(conf);
+            // pre.proxiesMoved is usually zero but sometimes isn't.
+        }
 
         {
+            PLAYRHO_PROFILE_SCOPE(destroyScope, StepPhase::ContactDestroy, m_stepProfiler,
+                                  &Get(stepStats.times, StepPhase::ContactDestroy));
             // Note: this may update bodies (in addition to the contacts container).
-            const auto destroyStats = DestroyContacts(m_contacts);
+            WakeContacts();
+            const auto destroyStats = DestroyContacts();
             stepStats.pre.destroyed = destroyStats.erased;
         }
 
         if (HasNewFixtures())
         {
+            PLAYRHO_PROFILE_SCOPE(findScope, StepPhase::FindNewContacts, m_stepProfiler,
+                                  &Get(stepStats.times, StepPhase::FindNewContacts));
             UnsetNewFixtures();
             
             // New fixtures were added: need to find and create the new contacts.
@@ -1839,25 +2828,42 @@ StepStats World::Step(const StepConf& conf)
         {
             m_inv_dt0 = conf.GetInvTime();
 
-            // Could potentially run UpdateContacts multithreaded over split lists...
-            const auto updateStats = UpdateContacts(m_contacts, conf);
-            stepStats.pre.ignored = updateStats.ignored;
-            stepStats.pre.updated = updateStats.updated;
-            stepStats.pre.skipped = updateStats.skipped;
+            {
+                PLAYRHO_PROFILE_SCOPE(updateScope, StepPhase::NarrowPhase, m_stepProfiler,
+                                      &Get(stepStats.times, StepPhase::NarrowPhase));
+                WakeContacts();
+                const auto updateStats = UpdateContacts(conf);
+                stepStats.pre.ignored = updateStats.ignored;
+                stepStats.pre.updated = updateStats.updated;
+                stepStats.pre.skipped = updateStats.skipped;
+            }
 
             // Integrate velocities, solve velocity constraints, and integrate positions.
             if (IsStepComplete())
             {
-                stepStats.reg = SolveReg(conf);
+                stepStats.reg = SolveReg(conf, stepStats.times);
             }
 
             // Handle TOI events.
             if (conf.doToi)
             {
+                PLAYRHO_PROFILE_SCOPE(toiScope, StepPhase::Toi, m_stepProfiler,
+                                      &Get(stepStats.times, StepPhase::Toi));
                 stepStats.toi = SolveToi(conf);
             }
+            
+            if (IsTrackingSensorOverlaps())
+            {
+                PLAYRHO_PROFILE_SCOPE(sensorScope, StepPhase::SensorOverlaps, m_stepProfiler,
+                                      &Get(stepStats.times, StepPhase::SensorOverlaps));
+                UpdateSensorOverlaps(conf);
+            }
         }
     }
+    if (m_bodyStateBuffer)
+    {
+        m_bodyStateBuffer->Write(*this, conf.GetTime());
+    }
     return stepStats;
 }
 
@@ -1897,6 +2903,10 @@ void World::InternalDestroy(Contact* contact, Body* from)
         // EndContact hadn't been called in DestroyOrUpdateContacts() since is-touching, so call it now
         m_contactListener->EndContact(*contact);
     }
+    if (m_contactEventBuffer && contact->IsTouching())
+    {
+        m_contactEventBuffer->AddEnd(*contact);
+    }
     
     const auto fixtureA = contact->GetFixtureA();
     const auto fixtureB = contact->GetFixtureB();
@@ -1930,20 +2940,25 @@ void World::Destroy(Contact* contact, Body* from)
 
     InternalDestroy(contact, from);
     
-    const auto it = find_if(cbegin(m_contacts), cend(m_contacts),
+    const auto it = find_if(begin(m_contacts), end(m_contacts),
                             [&](const Contacts::value_type& c) {
         return GetPtr(std::get<Contact*>(c)) == contact;
     });
-    if (it != cend(m_contacts))
+    if (it != end(m_contacts))
     {
+        if (it >= GetAwakeContactsEnd())
+        {
+            --m_sleepingContactCount;
+        }
         m_contacts.erase(it);
     }
 }
 
-World::DestroyContactsStats World::DestroyContacts(Contacts& contacts)
+World::DestroyContactsStats World::DestroyContacts()
 {
-    const auto beforeSize = size(contacts);
-    contacts.erase(std::remove_if(begin(contacts), end(contacts), [&](Contacts::value_type& c)
+    const auto beforeSize = size(m_contacts);
+    const auto awakeEnd = GetAwakeContactsEnd();
+    const auto newAwakeEnd = std::remove_if(begin(m_contacts), awakeEnd, [&](Contacts::value_type& c)
     {
         const auto key = std::get<ContactKey>(c);
         auto& contact = GetRef(std::get<Contact*>(c));
@@ -1955,15 +2970,30 @@ World::DestroyContactsStats World::DestroyContacts(Contacts& contacts)
             return true;
         }
         
-        // Is this contact flagged for filtering?
-        if (contact.NeedsFiltering())
+        const auto fixtureA = contact.GetFixtureA();
+        const auto fixtureB = contact.GetFixtureB();
+        if (fixtureA->HasSharedProxy() || fixtureB->HasSharedProxy())
         {
-            const auto fixtureA = contact.GetFixtureA();
-            const auto fixtureB = contact.GetFixtureB();
-            const auto bodyA = fixtureA->GetBody();
+            // Destroy contacts whose children cease to overlap in the mid-phase.
+            const auto aabbA = fixtureA->HasSharedProxy()?
+                ComputeChildAABB(*fixtureA, contact.GetChildIndexA()): m_tree.GetAABB(key.GetMin());
+            const auto aabbB = fixtureB->HasSharedProxy()?
+                ComputeChildAABB(*fixtureB, contact.GetChildIndexB()): m_tree.GetAABB(key.GetMax());
+            if (!TestOverlap(aabbA, aabbB))
+            {
+                InternalDestroy(&contact);
+                return true;
+            }
+        }
+        
+        // Is this contact flagged for filtering?
+        if (contact.NeedsFiltering())
+        {
+            const auto bodyA = fixtureA->GetBody();
             const auto bodyB = fixtureB->GetBody();
 
-            if (!ShouldCollide(*bodyB, *bodyA) || !ShouldCollide(*fixtureA, *fixtureB))
+            if (!ShouldCollide(*bodyB, *bodyA) || !ShouldCollide(*fixtureA, *fixtureB) ||
+                (IsTrackingSensorOverlaps() && (fixtureA->IsSensor() || fixtureB->IsSensor())))
             {
                 InternalDestroy(&contact);
                 return true;
@@ -1972,8 +3002,15 @@ World::DestroyContactsStats World::DestroyContacts(Contacts& contacts)
         }
 
         return false;
-    }), end(contacts));
-    const auto afterSize = size(contacts);
+    });
+    
+    // Fill the gap left by the destroyed contacts with sleeping contacts from the end.
+    const auto numErased = awakeEnd - newAwakeEnd;
+    const auto numMoved = std::min(numErased,
+                                   static_cast<Contacts::difference_type>(m_sleepingContactCount));
+    std::move(end(m_contacts) - numMoved, end(m_contacts), newAwakeEnd);
+    m_contacts.erase(end(m_contacts) - numErased, end(m_contacts));
+    const auto afterSize = size(m_contacts);
 
     auto stats = DestroyContactsStats{};
     stats.ignored = static_cast<ContactCounter>(afterSize);
@@ -1981,29 +3018,29 @@ World::DestroyContactsStats World::DestroyContacts(Contacts& contacts)
     return stats;
 }
 
-World::UpdateContactsStats World::UpdateContacts(Contacts& contacts, const StepConf& conf)
+World::UpdateContactsStats World::UpdateContacts(const StepConf& conf)
 {
 #ifdef DO_PAR_UNSEQ
-    atomic<uint32_t> ignored;
+    atomic<uint32_t> ignored{static_cast<uint32_t>(m_sleepingContactCount)};
     atomic<uint32_t> updated;
     atomic<uint32_t> skipped;
 #else
-    auto ignored = uint32_t{0};
+    auto ignored = static_cast<uint32_t>(m_sleepingContactCount);
     auto updated = uint32_t{0};
     auto skipped = uint32_t{0};
 #endif
 
     const auto updateConf = Contact::GetUpdateConf(conf);
     
-#if defined(DO_THREADED)
-    std::vector<Contact*> contactsNeedingUpdate;
-    contactsNeedingUpdate.reserve(size(contacts));
-    std::vector<std::future<void>> futures;
-    futures.reserve(size(contacts));
-#endif
+    // Contacts to update with the task scheduler.
+    auto contactsNeedingUpdate = std::vector<Contact*>{};
+    if (m_taskScheduler)
+    {
+        contactsNeedingUpdate.reserve(size(m_contacts) - m_sleepingContactCount);
+    }
 
     // Update awake contacts.
-    for_each(/*execution::par_unseq,*/ begin(contacts), end(contacts),
+    for_each(/*execution::par_unseq,*/ begin(m_contacts), GetAwakeContactsEnd(),
              [&](Contacts::value_type& c) {
         auto& contact = GetRef(std::get<Contact*>(c));
 #if 0
@@ -2039,13 +3076,14 @@ World::UpdateContactsStats World::UpdateContacts(Contacts& contacts, const StepC
         if (contact.NeedsUpdating())
         {
             // The following may call listener but is otherwise thread-safe.
-#if defined(DO_THREADED)
-            contactsNeedingUpdate.push_back(&contact);
-            //futures.push_back(async(&ContactAtty::Update, *contact, conf, m_contactListener)));
-            //futures.push_back(async(launch::async, [=]{ ContactAtty::Update(*contact, conf, m_contactListener); }));
-#else
-            ContactAtty::Update(contact, updateConf, m_contactListener);
-#endif
+            if (m_taskScheduler)
+            {
+                contactsNeedingUpdate.push_back(&contact);
+            }
+            else
+            {
+                UpdateContact(contact, updateConf, m_contactListener, m_contactEventBuffer);
+            }
         	++updated;
         }
         else
@@ -2055,35 +3093,35 @@ World::UpdateContactsStats World::UpdateContacts(Contacts& contacts, const StepC
 #endif
     });
     
-#if defined(DO_THREADED)
-    auto numJobs = size(contactsNeedingUpdate);
-    const auto jobsPerCore = numJobs / 4;
-    for (auto i = decltype(numJobs){0}; numJobs > 0 && i < 3; ++i)
-    {
-        futures.push_back(std::async(std::launch::async, [=]{
-            const auto offset = jobsPerCore * i;
-            for (auto j = decltype(jobsPerCore){0}; j < jobsPerCore; ++j)
-            {
-	            ContactAtty::Update(*contactsNeedingUpdate[offset + j], updateConf, m_contactListener);
-            }
-        }));
-        numJobs -= jobsPerCore;
-    }
-    if (numJobs > 0)
+    if (!empty(contactsNeedingUpdate))
     {
-        futures.push_back(std::async(std::launch::async, [=]{
-            const auto offset = jobsPerCore * 3;
-            for (auto j = decltype(numJobs){0}; j < numJobs; ++j)
+        const auto numChunks = (size(contactsNeedingUpdate) + ContactUpdateGrainSize - 1)
+            / ContactUpdateGrainSize;
+        auto recorders = std::vector<ContactCallRecorder>(
+            (m_contactListener && IsDeterministic())? numChunks: std::size_t{0});
+        auto events = std::vector<ContactEventBuffer>(
+            m_contactEventBuffer? numChunks: std::size_t{0});
+        m_taskScheduler->ParallelFor(size(contactsNeedingUpdate), ContactUpdateGrainSize,
+                                     [&](std::size_t first, std::size_t last) {
+            PLAYRHO_PROFILE_SCOPE(taskScope, StepPhase::NarrowPhase, m_stepProfiler, nullptr);
+            const auto listener = empty(recorders)? m_contactListener:
+                &recorders[first / ContactUpdateGrainSize];
+            const auto chunkEvents = empty(events)? nullptr:
+                &events[first / ContactUpdateGrainSize];
+            for (auto i = first; i < last; ++i)
             {
-                ContactAtty::Update(*contactsNeedingUpdate[offset + j], updateConf, m_contactListener);
+                UpdateContact(*contactsNeedingUpdate[i], updateConf, listener, chunkEvents);
             }
-        }));
-    }
-    for (auto&& future: futures)
-    {
-        future.get();
+        });
+        for (auto&& recorder: recorders)
+        {
+            recorder.Replay(*m_contactListener);
+        }
+        for (auto&& chunkEvents: events)
+        {
+            m_contactEventBuffer->Append(chunkEvents);
+        }
     }
-#endif
     
     return UpdateContactsStats{
         static_cast<ContactCounter>(ignored),
@@ -2092,6 +3130,31 @@ World::UpdateContactsStats World::UpdateContacts(Contacts& contacts, const StepC
     };
 }
 
+void World::SleepContacts() noexcept
+{
+    const auto awakeEnd = GetAwakeContactsEnd();
+    const auto sleepingBegin = std::stable_partition(begin(m_contacts), awakeEnd, IsAwakeContact);
+    for_each(sleepingBegin, awakeEnd, [](Contacts::value_type& c) {
+        auto& contact = GetRef(std::get<Contact*>(c));
+        ContactAtty::UnsetIslanded(contact);
+        ContactAtty::UnsetToi(contact);
+        ContactAtty::ResetToiCount(contact);
+    });
+    m_sleepingContactCount += static_cast<Contacts::size_type>(awakeEnd - sleepingBegin);
+}
+
+void World::WakeContacts() noexcept
+{
+    if ((m_flags & e_wokenBodies) == 0u)
+    {
+        return;
+    }
+    m_flags &= ~e_wokenBodies;
+    const auto awakeEnd = GetAwakeContactsEnd();
+    const auto sleepingBegin = std::stable_partition(awakeEnd, end(m_contacts), IsAwakeContact);
+    m_sleepingContactCount -= static_cast<Contacts::size_type>(sleepingBegin - awakeEnd);
+}
+
 void World::UnregisterForProcessing(ProxyId pid) noexcept
 {
     const auto itEnd = end(m_proxies);
@@ -2109,23 +3172,51 @@ ContactCounter World::FindNewContacts()
     // Accumalate contact keys for pairs of nodes that are overlapping and aren't identical.
     // Note that if the dynamic tree node provides the body pointer, it's assumed to be faster
     // to eliminate any node pairs that have the same body here before the key pairs are
-    // sorted.
-    for_each(cbegin(m_proxies), cend(m_proxies), [&](ProxyId pid) {
-        const auto body0 = m_tree.GetLeafData(pid).body;
+    // sorted. Likewise for pairs whose cached fixture filters don't collide.
+    const auto queryProxy = [&](ProxyId pid, ContactKeyQueue& keys) {
+        const auto leaf0 = m_tree.GetLeafData(pid);
+        const auto filter0 = GetFilter(leaf0);
         const auto aabb = m_tree.GetAABB(pid);
         Query(m_tree, aabb, [&](DynamicTree::Size nodeId) {
-            const auto body1 = m_tree.GetLeafData(nodeId).body;
+            const auto leaf1 = m_tree.GetLeafData(nodeId);
             // A proxy cannot form a pair with itself.
-            if ((nodeId != pid) && (body0 != body1))
+            if ((nodeId != pid) && (leaf0.body != leaf1.body) &&
+                ShouldCollide(filter0, GetFilter(leaf1)))
             {
-                m_proxyKeys.push_back(ContactKey{nodeId, pid});
+                keys.push_back(ContactKey{nodeId, pid});
             }
             return DynamicTreeOpcode::Continue;
         });
-    });
+    };
+    if (m_taskScheduler && (size(m_proxies) > ProxyQueryGrainSize))
+    {
+        // Each chunk accumulates into its own queue and the queues get concatenated in
+        // chunk order so the keys don't depend on how the chunks got scheduled.
+        const auto numChunks = (size(m_proxies) + ProxyQueryGrainSize - 1) / ProxyQueryGrainSize;
+        auto chunkKeys = std::vector<ContactKeyQueue>(numChunks);
+        m_taskScheduler->ParallelFor(size(m_proxies), ProxyQueryGrainSize,
+                                     [&](std::size_t first, std::size_t last) {
+            auto& keys = chunkKeys[first / ProxyQueryGrainSize];
+            for (auto i = first; i < last; ++i)
+            {
+                queryProxy(m_proxies[i], keys);
+            }
+        });
+        for (auto&& keys: chunkKeys)
+        {
+            m_proxyKeys.insert(end(m_proxyKeys), cbegin(keys), cend(keys));
+        }
+    }
+    else
+    {
+        for_each(cbegin(m_proxies), cend(m_proxies), [&](ProxyId pid) {
+            queryProxy(pid, m_proxyKeys);
+        });
+    }
     m_proxies.clear();
 
-    // Sort and eliminate any duplicate contact keys.
+    // Sort and eliminate any duplicate contact keys. Sorting also gives the contacts a
+    // canonical creation order that doesn't depend on the order the proxies were queried.
     sort(begin(m_proxyKeys), end(m_proxyKeys));
     m_proxyKeys.erase(unique(begin(m_proxyKeys), end(m_proxyKeys)), end(m_proxyKeys));
 
@@ -2162,10 +3253,55 @@ bool World::Add(ContactKey key)
     assert(bodyA != bodyB);
     
     // Does a joint override collision? Is at least one body dynamic?
-    if (!ShouldCollide(*bodyB, *bodyA) || !ShouldCollide(*fixtureA, *fixtureB))
+    if (!ShouldCollide(*bodyB, *bodyA) ||
+        !ShouldCollide(GetFilter(minKeyLeafData), GetFilter(maxKeyLeafData)))
     {
         return false;
     }
+    
+    // Are sensors tracked through their overlaps instead?
+    if (IsTrackingSensorOverlaps() && (fixtureA->IsSensor() || fixtureB->IsSensor()))
+    {
+        return false;
+    }
+    
+    const auto sharedA = fixtureA->HasSharedProxy();
+    const auto sharedB = fixtureB->HasSharedProxy();
+    if (!sharedA && !sharedB)
+    {
+        return Add(key, *fixtureA, indexA, *fixtureB, indexB);
+    }
+    
+    // Enumerate just the children overlapping with the other proxy (or other children).
+    auto added = false;
+    const auto addForB = [&](ChildCounter childA, const AABB& aabbA) {
+        if (sharedB)
+        {
+            QueryOverlappingChildren(*fixtureB, aabbA, [&](ChildCounter childB, const AABB&) {
+                added |= Add(key, *fixtureA, childA, *fixtureB, childB);
+            });
+        }
+        else
+        {
+            added |= Add(key, *fixtureA, childA, *fixtureB, indexB);
+        }
+    };
+    if (sharedA)
+    {
+        QueryOverlappingChildren(*fixtureA, m_tree.GetAABB(key.GetMax()), addForB);
+    }
+    else
+    {
+        addForB(indexA, m_tree.GetAABB(key.GetMin()));
+    }
+    return added;
+}
+
+bool World::Add(ContactKey key, Fixture& fixtureA, ChildCounter indexA,
+                Fixture& fixtureB, ChildCounter indexB)
+{
+    const auto bodyA = fixtureA.GetBody();
+    const auto bodyB = fixtureB.GetBody();
    
 #ifndef NO_RACING
     // Code herein may be racey in a multithreaded context...
@@ -2204,9 +3340,16 @@ bool World::Add(ContactKey key)
     const auto searchBody = (size(bodyA->GetContacts()) < size(bodyB->GetContacts()))?
         bodyA: bodyB;
     
+    // Note: proxies of fixtures having child trees can have contacts for more than one pair
+    //   of children so the child indices of contacts having the same key have to match too.
     const auto contacts = searchBody->GetContacts();
     const auto it = find_if(cbegin(contacts), cend(contacts), [&](KeyedContactPtr ci) {
-        return std::get<ContactKey>(ci) == key;
+        if (std::get<ContactKey>(ci) != key)
+        {
+            return false;
+        }
+        const auto c = std::get<Contact*>(ci);
+        return (c->GetChildIndexA() == indexA) && (c->GetChildIndexB() == indexB);
     });
     if (it != cend(contacts))
     {
@@ -2220,7 +3363,7 @@ bool World::Add(ContactKey key)
         return false;
     }
 
-    const auto contact = new Contact{fixtureA, indexA, fixtureB, indexB};
+    const auto contact = new Contact{&fixtureA, indexA, &fixtureB, indexB};
     
     // Insert into the contacts container.
     //
@@ -2230,12 +3373,17 @@ bool World::Add(ContactKey key)
     // adding means container more a LIFO container, while back adding means more a FIFO.
     //
     m_contacts.push_back(KeyedContactPtr{key, contact});
+    if (m_sleepingContactCount > 0)
+    {
+        // Keep the sleeping contacts at the end.
+        std::iter_swap(GetAwakeContactsEnd() - 1, end(m_contacts) - 1);
+    }
 
     BodyAtty::Insert(*bodyA, key, contact);
     BodyAtty::Insert(*bodyB, key, contact);
 
     // Wake up the bodies
-    if (!fixtureA->IsSensor() && !fixtureB->IsSensor())
+    if (!fixtureA.IsSensor() && !fixtureB.IsSensor())
     {
         if (bodyA->IsSpeedable())
         {
@@ -2255,6 +3403,12 @@ void World::RegisterForProxies(Fixture& fixture)
 {
     assert(fixture.GetBody()->GetWorld() == this);
     m_fixturesForProxies.push_back(&fixture);
+    if (!fixture.GetBody()->IsAwake())
+    {
+        // Sleeping contacts of the body may need destroying.
+        FlagContactsForFiltering(*fixture.GetBody());
+        SetWokenBodies();
+    }
 }
 
 void World::UnregisterForProxies(const Fixture& fixture)
@@ -2268,6 +3422,12 @@ void World::RegisterForProxies(Body& body)
 {
     assert(body.GetWorld() == this);
     m_bodiesForProxies.push_back(&body);
+    if (!body.IsAwake())
+    {
+        // Sleeping contacts of the body may cease to overlap.
+        FlagContactsForFiltering(body);
+        SetWokenBodies();
+    }
 }
 
 void World::UnregisterForProxies(const Body& body)
@@ -2327,6 +3487,9 @@ PreStepStats::counter_type World::SynchronizeProxies(const StepConf& conf)
         const auto xfm = b->GetTransformation();
         // Not always true: assert(GetTransform0(b->GetSweep()) == xfm);
         proxiesMoved += Synchronize(*b, xfm, xfm, conf.displaceMultiplier, conf.aabbExtension);
+        // The body's transformation got set so its sensor overlaps may have changed
+        // even if none of its proxies moved.
+        TouchSensorProxies(*b);
     });
     m_bodiesForProxies.clear();
     return proxiesMoved;
@@ -2345,6 +3508,12 @@ void World::SetType(Body& body, playrho::BodyType type)
         throw WrongState("World::SetType: world is locked");
     }
     
+    // Wake the body's sleeping island as a unit before the body possibly becomes unspeedable.
+    if (body.IsSpeedable())
+    {
+        BodyAtty::SetAwakeFlag(body);
+    }
+    
     BodyAtty::SetTypeFlags(body, type);
     body.ResetMassData();
     
@@ -2402,8 +3571,30 @@ Fixture* World::CreateFixture(Body& body, const Shape& shape,
     }
     
     //const auto fixture = BodyAtty::CreateFixture(body, shape, def);
-    const auto fixture = FixtureAtty::Create(body, def, shape);
+    auto fixture = static_cast<Fixture*>(nullptr);
+    if (m_shapeRegistry)
+    {
+        // Fixtures of equal shapes share the registered shape and its cached data.
+        const auto interned = m_shapeRegistry->Intern(shape);
+        try
+        {
+            fixture = FixtureAtty::Create(body, def, interned);
+        }
+        catch (...)
+        {
+            m_shapeRegistry->Release(interned);
+            throw;
+        }
+    }
+    else
+    {
+        fixture = FixtureAtty::Create(body, def, shape);
+    }
     BodyAtty::AddFixture(body, fixture);
+    if (IsTrackingSensorOverlaps() && fixture->IsSensor())
+    {
+        m_sensors.push_back(fixture);
+    }
 
     if (body.IsEnabled())
     {
@@ -2459,6 +3650,9 @@ bool World::Destroy(Fixture& fixture, bool resetMassData)
         }
         return false;
     });
+    EraseSensorOverlaps([&](const Fixture& f) {
+        return &f == &fixture;
+    });
     
     UnregisterForProxies(fixture);
     DestroyProxies(fixture);
@@ -2468,6 +3662,10 @@ bool World::Destroy(Fixture& fixture, bool resetMassData)
         // Fixture probably destroyed already.
         return false;
     }
+    if (m_shapeRegistry)
+    {
+        m_shapeRegistry->Release(fixture.GetShape());
+    }
     FixtureAtty::Delete(&fixture);
     
     BodyAtty::SetMassDataDirty(body);
@@ -2489,16 +3687,37 @@ void World::CreateProxies(Fixture& fixture, Length aabbExtension)
     
     // Reserve proxy space and create proxies in the broad-phase.
     const auto childCount = GetChildCount(shape);
+    const auto heightField = GetHeightFieldShapeConf(shape);
+    if ((fixture.IsSingleProxy() || heightField) && (childCount > 1))
+    {
+        // Create just one proxy covering all of the children. Height field children are
+        // found by index arithmetic so only other shapes need a child tree.
+        if (!heightField)
+        {
+            FixtureAtty::SetChildTree(fixture, CreateChildTree(*body, fixture));
+        }
+        FixtureAtty::SetSharedProxy(fixture, true);
+        const auto aabb = GetTransformedAABB(GetChildrenAABB(fixture), xfm);
+        const auto fattenedAABB = GetFattenedAABB(aabb, aabbExtension);
+        const auto treeId = m_tree.CreateLeaf(fattenedAABB, GetLeafData(body, fixture, 0));
+        RegisterForProcessing(treeId);
+        auto proxies = std::make_unique<FixtureProxy[]>(1);
+        proxies[0] = FixtureProxy{treeId};
+        FixtureAtty::SetProxies(fixture, std::move(proxies), 1);
+        return;
+    }
+    const auto children = m_shapeRegistry?
+        GetChildren(*m_shapeRegistry, shape): Span<const DistanceProxy>{};
     auto proxies = std::make_unique<FixtureProxy[]>(childCount);
     for (auto childIndex = decltype(childCount){0}; childIndex < childCount; ++childIndex)
     {
-        const auto dp = GetChild(shape, childIndex);
-        const auto aabb = playrho::d2::ComputeAABB(dp, xfm);
+        const auto aabb = children.empty()?
+            playrho::d2::ComputeAABB(GetChild(shape, childIndex), xfm):
+            playrho::d2::ComputeAABB(children[childIndex], xfm);
 
         // Note: treeId from CreateLeaf can be higher than the number of fixture proxies.
         const auto fattenedAABB = GetFattenedAABB(aabb, aabbExtension);
-        const auto treeId = m_tree.CreateLeaf(fattenedAABB, DynamicTree::LeafData{
-            body, &fixture, childIndex});
+        const auto treeId = m_tree.CreateLeaf(fattenedAABB, GetLeafData(body, fixture, childIndex));
         RegisterForProcessing(treeId);
         proxies[childIndex] = FixtureProxy{treeId};
     }
@@ -2518,6 +3737,11 @@ void World::DestroyProxies(Fixture& fixture) noexcept
             const auto treeId = proxies[i].treeId;
             UnregisterForProcessing(treeId);
             m_tree.DestroyLeaf(treeId);
+            if (IsTrackingSensorOverlaps())
+            {
+                // So overlaps of the destroyed proxy are dropped instead of being kept.
+                m_sensorTouchedProxies.push_back(treeId);
+            }
         }
     }
     FixtureAtty::ResetProxies(fixture);
@@ -2526,7 +3750,19 @@ void World::DestroyProxies(Fixture& fixture) noexcept
 void World::TouchProxies(Fixture& fixture) noexcept
 {
     assert(fixture.GetBody()->GetWorld() == this);
+    const auto filter = fixture.GetFilterData();
+    const auto proxyCount = fixture.GetProxyCount();
+    for (auto i = decltype(proxyCount){0}; i < proxyCount; ++i)
+    {
+        const auto treeId = fixture.GetProxy(i).treeId;
+        auto leafData = m_tree.GetLeafData(treeId);
+        SetFilter(leafData, filter);
+        m_tree.SetLeafData(treeId, leafData);
+    }
     InternalTouchProxies(fixture);
+    
+    // The fixture's contacts may have been flagged for filtering.
+    SetWokenBodies();
 }
 
 void World::InternalTouchProxies(Fixture& fixture) noexcept
@@ -2538,6 +3774,242 @@ void World::InternalTouchProxies(Fixture& fixture) noexcept
     }
 }
 
+Span<const SensorOverlap> World::GetSensorOverlaps(ContactCounter sensorProxy) const noexcept
+{
+    const auto first = std::lower_bound(cbegin(m_sensorOverlaps), cend(m_sensorOverlaps),
+                                        sensorProxy,
+                                        [](const SensorOverlap& overlap, ContactCounter proxy) {
+        return overlap.sensorProxy < proxy;
+    });
+    const auto last = std::upper_bound(first, cend(m_sensorOverlaps), sensorProxy,
+                                       [](ContactCounter proxy, const SensorOverlap& overlap) {
+        return proxy < overlap.sensorProxy;
+    });
+    return Span<const SensorOverlap>(data(m_sensorOverlaps) + (first - cbegin(m_sensorOverlaps)),
+                                     static_cast<std::size_t>(last - first));
+}
+
+void World::UpdateSensor(Fixture& fixture) noexcept
+{
+    if (fixture.IsSensor())
+    {
+        m_sensors.push_back(&fixture);
+        TouchSensorProxies(fixture);
+        return;
+    }
+    m_sensors.erase(std::remove(begin(m_sensors), end(m_sensors), &fixture), end(m_sensors));
+    
+    // Overlaps with the fixture as the other fixture remain.
+    const auto isSensor = [&](const SensorOverlap& overlap) {
+        return overlap.sensor == &fixture;
+    };
+    if (m_contactEventBuffer)
+    {
+        for (auto&& overlap: m_sensorOverlaps)
+        {
+            if (isSensor(overlap))
+            {
+                m_contactEventBuffer->AddSensorExit(overlap);
+            }
+        }
+    }
+    m_sensorOverlaps.erase(std::remove_if(begin(m_sensorOverlaps), end(m_sensorOverlaps),
+                                          isSensor), end(m_sensorOverlaps));
+}
+
+void World::TouchSensorProxies(const Fixture& fixture)
+{
+    if (!IsTrackingSensorOverlaps())
+    {
+        return;
+    }
+    const auto proxyCount = fixture.GetProxyCount();
+    for (auto i = decltype(proxyCount){0}; i < proxyCount; ++i)
+    {
+        m_sensorTouchedProxies.push_back(fixture.GetProxy(i).treeId);
+    }
+}
+
+void World::TouchSensorProxies(const Body& body)
+{
+    if (!IsTrackingSensorOverlaps())
+    {
+        return;
+    }
+    for (auto&& fixture: body.GetFixtures())
+    {
+        TouchSensorProxies(GetRef(fixture));
+    }
+}
+
+void World::EraseSensorOverlaps(const std::function<bool(const Fixture&)>& isErased)
+{
+    if (!IsTrackingSensorOverlaps())
+    {
+        return;
+    }
+    m_sensors.erase(std::remove_if(begin(m_sensors), end(m_sensors), [&](const Fixture* sensor) {
+        return isErased(*sensor);
+    }), end(m_sensors));
+    
+    const auto isErasedOverlap = [&](const SensorOverlap& overlap) {
+        return isErased(*overlap.sensor) || isErased(*overlap.other);
+    };
+    if (m_contactEventBuffer)
+    {
+        for (auto&& overlap: m_sensorOverlaps)
+        {
+            if (isErasedOverlap(overlap))
+            {
+                m_contactEventBuffer->AddSensorExit(overlap);
+            }
+        }
+    }
+    m_sensorOverlaps.erase(std::remove_if(begin(m_sensorOverlaps), end(m_sensorOverlaps),
+                                          isErasedOverlap), end(m_sensorOverlaps));
+}
+
+void World::UpdateSensorOverlaps(const StepConf& conf)
+{
+    const auto aabbOnly = (m_flags & e_aabbSensorOverlaps) != 0u;
+    const auto distanceConf = Contact::GetUpdateConf(conf).distance;
+    
+    sort(begin(m_sensorTouchedProxies), end(m_sensorTouchedProxies));
+    m_sensorTouchedProxies.erase(unique(begin(m_sensorTouchedProxies),
+                                        end(m_sensorTouchedProxies)),
+                                 end(m_sensorTouchedProxies));
+    
+    // Overlaps of a proxy can only have changed if its body is awake or it got touched.
+    const auto isChanged = [&](const Body& body, ProxyId proxy) {
+        return body.IsAwake() || std::binary_search(cbegin(m_sensorTouchedProxies),
+                                                    cend(m_sensorTouchedProxies), proxy);
+    };
+    
+    // Like for finding new contacts, except that every overlapping proxy of each sensor is
+    // tested for overlap of the children right away instead of making a contact for it.
+    // Pairs of unchanged proxies are skipped as their previous overlaps get kept instead.
+    const auto querySensor = [&](Fixture& sensor, std::vector<SensorOverlap>& overlaps) {
+        const auto sensorXfm = GetTransformation(sensor);
+        const auto proxyCount = sensor.GetProxyCount();
+        for (auto i = decltype(proxyCount){0}; i < proxyCount; ++i)
+        {
+            const auto sensorProxy = sensor.GetProxy(i).treeId;
+            const auto sensorLeaf = m_tree.GetLeafData(sensorProxy);
+            const auto sensorFilter = GetFilter(sensorLeaf);
+            const auto sensorAABB = m_tree.GetAABB(sensorProxy);
+            const auto sensorChanged = isChanged(*sensorLeaf.body, sensorProxy);
+            Query(m_tree, sensorAABB, [&](DynamicTree::Size otherProxy) {
+                const auto otherLeaf = m_tree.GetLeafData(otherProxy);
+                if ((otherLeaf.body == sensorLeaf.body) ||
+                    (!sensorChanged && !isChanged(*otherLeaf.body, otherProxy)) ||
+                    !ShouldCollide(sensorFilter, GetFilter(otherLeaf)) ||
+                    !ShouldCollide(*sensorLeaf.body, *otherLeaf.body))
+                {
+                    return DynamicTreeOpcode::Continue;
+                }
+                auto& other = *otherLeaf.fixture;
+                const auto otherXfm = GetTransformation(other);
+                const auto addIfOverlapping = [&](ChildCounter sensorChild, ChildCounter otherChild) {
+                    const auto childA = GetChild(sensor.GetShape(), sensorChild);
+                    const auto childB = GetChild(other.GetShape(), otherChild);
+                    const auto overlapping = aabbOnly?
+                        TestOverlap(ComputeAABB(childA, sensorXfm), ComputeAABB(childB, otherXfm)):
+                        (TestOverlap(childA, sensorXfm, childB, otherXfm, distanceConf) >= 0_m2);
+                    if (overlapping)
+                    {
+                        overlaps.push_back(SensorOverlap{
+                            sensorProxy, otherProxy, sensorChild, otherChild, &sensor, &other
+                        });
+                    }
+                };
+                const auto addForOther = [&](ChildCounter sensorChild, const AABB& aabb) {
+                    if (other.HasSharedProxy())
+                    {
+                        QueryOverlappingChildren(other, aabb, [&](ChildCounter otherChild,
+                                                                  const AABB&) {
+                            addIfOverlapping(sensorChild, otherChild);
+                        });
+                    }
+                    else
+                    {
+                        addIfOverlapping(sensorChild, otherLeaf.childIndex);
+                    }
+                };
+                if (sensor.HasSharedProxy())
+                {
+                    QueryOverlappingChildren(sensor, m_tree.GetAABB(otherProxy), addForOther);
+                }
+                else
+                {
+                    addForOther(sensorLeaf.childIndex, sensorAABB);
+                }
+                return DynamicTreeOpcode::Continue;
+            });
+        }
+    };
+    
+    m_newSensorOverlaps.clear();
+    if (m_taskScheduler && (size(m_sensors) > SensorQueryGrainSize))
+    {
+        const auto numChunks = (size(m_sensors) + SensorQueryGrainSize - 1) / SensorQueryGrainSize;
+        auto chunkOverlaps = std::vector<std::vector<SensorOverlap>>(numChunks);
+        m_taskScheduler->ParallelFor(size(m_sensors), SensorQueryGrainSize,
+                                     [&](std::size_t first, std::size_t last) {
+            auto& overlaps = chunkOverlaps[first / SensorQueryGrainSize];
+            for (auto i = first; i < last; ++i)
+            {
+                querySensor(*m_sensors[i], overlaps);
+            }
+        });
+        for (auto&& overlaps: chunkOverlaps)
+        {
+            m_newSensorOverlaps.insert(end(m_newSensorOverlaps), cbegin(overlaps), cend(overlaps));
+        }
+    }
+    else
+    {
+        for (auto&& sensor: m_sensors)
+        {
+            querySensor(*sensor, m_newSensorOverlaps);
+        }
+    }
+    std::copy_if(cbegin(m_sensorOverlaps), cend(m_sensorOverlaps),
+                 std::back_inserter(m_newSensorOverlaps), [&](const SensorOverlap& overlap) {
+        return !isChanged(*overlap.sensor->GetBody(), overlap.sensorProxy) &&
+               !isChanged(*overlap.other->GetBody(), overlap.otherProxy);
+    });
+    m_sensorTouchedProxies.clear();
+    sort(begin(m_newSensorOverlaps), end(m_newSensorOverlaps));
+    
+    if (m_contactEventBuffer)
+    {
+        // Both are sorted so the exited and entered overlaps are found walking them alongside.
+        auto oldIt = cbegin(m_sensorOverlaps);
+        auto newIt = cbegin(m_newSensorOverlaps);
+        const auto oldEnd = cend(m_sensorOverlaps);
+        const auto newEnd = cend(m_newSensorOverlaps);
+        while ((oldIt != oldEnd) || (newIt != newEnd))
+        {
+            if ((newIt == newEnd) || ((oldIt != oldEnd) && (*oldIt < *newIt)))
+            {
+                m_contactEventBuffer->AddSensorExit(*oldIt);
+                ++oldIt;
+            }
+            else if ((oldIt == oldEnd) || (*newIt < *oldIt))
+            {
+                m_contactEventBuffer->AddSensorEnter(*newIt);
+                ++newIt;
+            }
+            else
+            {
+                ++oldIt;
+                ++newIt;
+            }
+        }
+    }
+    std::swap(m_sensorOverlaps, m_newSensorOverlaps);
+}
+
 ContactCounter World::Synchronize(Body& body,
                                   Transformation xfm1, Transformation xfm2,
                                   Real multiplier, Length extension)
@@ -2564,6 +4036,27 @@ ContactCounter World::Synchronize(Fixture& fixture,
     auto updatedCount = ContactCounter{0};
     const auto shape = fixture.GetShape();
     const auto proxies = FixtureAtty::GetProxies(fixture);
+    if (fixture.HasSharedProxy())
+    {
+        const auto treeId = proxies[0].treeId;
+        const auto localAABB = GetChildrenAABB(fixture);
+        const auto aabb = GetEnclosingAABB(GetTransformedAABB(localAABB, xfm1),
+                                           GetTransformedAABB(localAABB, xfm2));
+        if (!Contains(m_tree.GetAABB(treeId), aabb))
+        {
+            const auto newAabb = GetDisplacedAABB(GetFattenedAABB(aabb, extension),
+                                                  displacement);
+            m_tree.UpdateLeaf(treeId, newAabb);
+            ++updatedCount;
+        }
+        if (xfm1 != xfm2)
+        {
+            // Children move with the body so any may come to overlap other proxies even
+            // while the single proxy still contains them.
+            RegisterForProcessing(treeId);
+        }
+        return updatedCount;
+    }
     auto childIndex = ChildCounter{0};
     for (auto& proxy: proxies)
     {
@@ -2692,6 +4185,189 @@ Body* FindClosestBody(const World& world, Length2 location) noexcept
     return found;
 }
 
+namespace {
+
+Length GetDistance(const Fixture& fixture, ChildCounter childIndex, Length2 location)
+{
+    const auto child = GetChild(fixture.GetShape(), childIndex);
+    const auto point = DistanceProxy{0_m, 1, &location, nullptr};
+    const auto output = Distance(child, fixture.GetBody()->GetTransformation(),
+                                 point, Transform_identity);
+    const auto distance = GetMagnitude(GetDelta(GetWitnessPoints(output.simplex)));
+    return std::max(distance - Length{child.GetVertexRadius()}, 0_m);
+}
+
+/// @brief Gets the child nearest to the given location of the given leaf's fixture.
+/// @details For a fixture whose children share its proxy, this finds the nearest of its
+///   children. Otherwise this is just the leaf's child.
+std::pair<ChildCounter, Length> GetNearestChild(const DynamicTree::LeafData& leafData,
+                                                Length2 location)
+{
+    const auto& fixture = *leafData.fixture;
+    if (!fixture.HasSharedProxy())
+    {
+        return {leafData.childIndex, GetDistance(fixture, leafData.childIndex, location)};
+    }
+    // Distances are the same in the body-local frame of the children.
+    const auto localLocation = InverseTransform(location, GetTransformation(fixture));
+    if (const auto childTree = fixture.GetChildTree())
+    {
+        const auto found = FindNearest(*childTree, localLocation, 1, [&](DynamicTree::Size leaf) {
+            const auto distance = GetDistance(fixture, childTree->GetLeafData(leaf).childIndex,
+                                              location);
+            return Area{distance * distance};
+        }, std::numeric_limits<Area>::infinity());
+        assert(!empty(found));
+        return {childTree->GetLeafData(found.front().leaf).childIndex,
+            Length{sqrt(found.front().distanceSquared)}};
+    }
+    
+    // Start from the height field cell below or above the location. Any nearer child's
+    // AABB must then be within that cell's distance of the location.
+    const auto& heightField = GetRef(GetHeightFieldShapeConf(fixture.GetShape()));
+    const auto lastChild = heightField.GetChildCount() - 1;
+    const auto cell = Real{(get<0>(localLocation) - get<0>(heightField.GetOrigin())) /
+        Length{heightField.GetCellWidth()}};
+    auto nearest = (cell <= Real{0})? ChildCounter{0}:
+        (cell >= static_cast<Real>(lastChild))? lastChild: static_cast<ChildCounter>(cell);
+    auto distance = GetDistance(fixture, nearest, location);
+    QueryChildren(fixture, GetFattenedAABB(AABB{localLocation}, distance),
+                  [&](ChildCounter child, const AABB&) {
+        const auto d = GetDistance(fixture, child, location);
+        if (d < distance)
+        {
+            nearest = child;
+            distance = d;
+        }
+        return true;
+    });
+    return {nearest, distance};
+}
+
+std::vector<FixtureDistance> FindFixtures(const World& world, Length2 location,
+                                          std::size_t count, Area maxDistanceSquared)
+{
+    const auto& tree = world.GetTree();
+    const auto found = FindNearest(tree, location, count, [&](DynamicTree::Size leaf) {
+        const auto distance = std::get<Length>(GetNearestChild(tree.GetLeafData(leaf),
+                                                               location));
+        return Area{distance * distance};
+    }, maxDistanceSquared);
+
+    auto result = std::vector<FixtureDistance>{};
+    result.reserve(size(found));
+    for (const auto& entry: found)
+    {
+        const auto leafData = tree.GetLeafData(entry.leaf);
+        const auto childIndex = (leafData.fixture->HasSharedProxy())?
+            std::get<ChildCounter>(GetNearestChild(leafData, location)): leafData.childIndex;
+        result.push_back(FixtureDistance{
+            leafData.fixture, childIndex, Length{sqrt(entry.distanceSquared)}
+        });
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+std::vector<FixtureDistance> FindClosestFixtures(const World& world, Length2 location,
+                                                 std::size_t count)
+{
+    return FindFixtures(world, location, count, std::numeric_limits<Area>::infinity());
+}
+
+FixtureDistance FindClosestFixture(const World& world, Length2 location)
+{
+    const auto found = FindClosestFixtures(world, location, 1);
+    return empty(found)? FixtureDistance{}: found.front();
+}
+
+std::vector<FixtureDistance> FindFixturesWithin(const World& world, Length2 location,
+                                                Length radius)
+{
+    return FindFixtures(world, location, std::numeric_limits<std::size_t>::max(),
+                        radius * radius);
+}
+
+FixtureShapeCastHit ShapeCast(const World& world, const ShapeCastInput& input)
+{
+    auto result = FixtureShapeCastHit{};
+    ShapeCast(world.GetTree(), input, [&result](Fixture* fixture, ChildCounter child,
+                                                const ShapeCastHit& hit) {
+        if (!result.fixture || (hit.fraction < result.hit.fraction))
+        {
+            result = FixtureShapeCastHit{fixture, child, hit};
+        }
+        return RayCastOpcode::ClipRay;
+    });
+    return result;
+}
+
+std::vector<FixtureShapeCastHit> ShapeCast(const World& world, Span<const ShapeCastInput> inputs)
+{
+    auto results = std::vector<FixtureShapeCastHit>{};
+    results.reserve(inputs.size());
+    for (auto&& input: inputs)
+    {
+        results.push_back(ShapeCast(world, input));
+    }
+    return results;
+}
+
+bool TestShapeCast(const World& world, const ShapeCastInput& input)
+{
+    return ShapeCast(world.GetTree(), input, [](Fixture*, ChildCounter, const ShapeCastHit&) {
+        return RayCastOpcode::Terminate;
+    });
+}
+
+std::vector<FixtureRayCastHit> RayCast(const World& world, Span<const RayCastInput> inputs)
+{
+    auto rays = std::vector<RayCastInput>(begin(inputs), end(inputs));
+    auto results = std::vector<FixtureRayCastHit>(inputs.size());
+    RayCast(world.GetTree(), rays, [&](Fixture* fixture, ChildCounter child,
+                                       Span<const std::size_t> indices) {
+        const auto proxy = GetChild(fixture->GetShape(), child);
+        const auto xf = fixture->GetBody()->GetTransformation();
+        for (auto&& i: indices)
+        {
+            // Each hit clips its ray so any later hit of the same ray is closer.
+            const auto output = RayCast(proxy, rays[i], xf);
+            if (output.has_value())
+            {
+                results[i] = FixtureRayCastHit{fixture, child, *output};
+                rays[i].maxFraction = output->fraction;
+            }
+        }
+    });
+    return results;
+}
+
+Body* Slice(World& world, Fixture& fixture, Length2 point, UnitVec normal)
+{
+    const auto& shape = fixture.GetShape();
+    if (GetUseTypeInfo(shape) != typeid(PolygonShapeConf))
+    {
+        throw InvalidArgument("Slice: fixture shape not a polygon");
+    }
+    
+    const auto body = fixture.GetBody();
+    const auto xf = body->GetTransformation();
+    const auto pieces = Slice(*static_cast<const PolygonShapeConf*>(GetData(shape)),
+                              InverseTransform(point, xf), normal.Rotate(xf.q.FlipY()));
+    if ((pieces.first.GetVertexCount() < 3) || (pieces.second.GetVertexCount() < 3))
+    {
+        return nullptr;
+    }
+    
+    const auto conf = GetFixtureConf(fixture);
+    body->CreateFixture(Shape{pieces.first}, conf, false);
+    const auto front = body->CreateFixture(Shape{pieces.second}, conf, false);
+    body->Destroy(&fixture, false);
+    Fixture* const moved[] = {front};
+    return world.Split(*body, moved);
+}
+
 } // namespace d2
 
 RegStepStats& Update(RegStepStats& lhs, const IslandStats& rhs) noexcept
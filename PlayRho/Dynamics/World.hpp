@@ -27,6 +27,7 @@
 
 #include <PlayRho/Common/Math.hpp>
 #include <PlayRho/Common/Range.hpp>
+#include <PlayRho/Common/Span.hpp>
 #include <PlayRho/Dynamics/WorldConf.hpp>
 #include <PlayRho/Dynamics/BodyConf.hpp>
 #include <PlayRho/Dynamics/BodyAtty.hpp>
@@ -34,10 +35,13 @@
 #include <PlayRho/Dynamics/WorldCallbacks.hpp>
 #include <PlayRho/Dynamics/StepStats.hpp>
 #include <PlayRho/Collision/DynamicTree.hpp>
+#include <PlayRho/Collision/ShapeCast.hpp>
+#include <PlayRho/Collision/Shapes/ShapeRegistry.hpp>
 #include <PlayRho/Dynamics/Contacts/ContactKey.hpp>
 #include <PlayRho/Dynamics/ContactAtty.hpp>
 #include <PlayRho/Dynamics/JointAtty.hpp>
 #include <PlayRho/Dynamics/IslandStats.hpp>
+#include <PlayRho/Dynamics/SensorOverlap.hpp>
 
 #include <iterator>
 #include <vector>
@@ -59,6 +63,7 @@ struct JointConf;
 struct FixtureConf;
 class Body;
 class Contact;
+class ContactEventBuffer;
 class Fixture;
 class Joint;
 struct Island;
@@ -141,6 +146,8 @@ public:
     /// @post The state of this world is like that of the given world except this world now
     ///   has deep copies of the given world with pointers having the new addresses of the
     ///   new memory required for those copies.
+    /// @note The copy has no body state buffer since a buffer can only be written to by one
+    ///   world and is keyed by the bodies of that world.
     World(const World& other);
 
     /// @brief Assignment operator.
@@ -148,6 +155,8 @@ public:
     /// @post The state of this world is like that of the given world except this world now
     ///   has deep copies of the given world with pointers having the new addresses of the
     ///   new memory required for those copies.
+    /// @note This world is left without a body state buffer since its bodies are all
+    ///   replaced and the given world's buffer can only be written to by that world.
     /// @warning This method should not be called while the world is locked!
     /// @throws WrongState if this method is called while the world is locked.
     World& operator= (const World& other);
@@ -171,6 +180,14 @@ public:
     /// @note The listener is owned by you and must remain in scope.
     void SetContactListener(ContactListener* listener) noexcept;
 
+    /// @brief Sets the contact event buffer.
+    /// @details Sets the buffer to append the begin contact, end contact, and contact
+    ///   impulses events to. This is an alternative to, and may be used along with, the
+    ///   contact listener.
+    /// @note The buffer is owned by you and must remain in scope.
+    /// @sa ContactEventBuffer
+    void SetContactEventBuffer(ContactEventBuffer* buffer) noexcept;
+
     /// @brief Creates a rigid body with the given configuration.
     /// @warning This function should not be used while the world is locked &mdash; as it is
     ///   during callbacks. If it is, it will throw an exception or abort your program.
@@ -186,6 +203,23 @@ public:
     /// @sa PhysicalEntities
     Body* CreateBody(const BodyConf& def = GetDefaultBodyConf());
 
+    /// @brief Creates rigid bodies with the given configurations.
+    /// @details Creates a body for each of the given configurations as though by calls to
+    ///   <code>CreateBody(const BodyConf&)</code> but growing the bodies container at
+    ///   most once.
+    /// @warning This function should not be used while the world is locked.
+    /// @post The created bodies will be present in the range returned from the
+    ///   <code>GetBodies()</code> method, in the same order as their configurations.
+    /// @param defs Configurations of the bodies to create.
+    /// @return Range of the created bodies. This is invalidated by the creation or
+    ///   destruction of bodies.
+    /// @throws WrongState if this method is called while the world is locked.
+    /// @throws LengthError if this operation would create more than <code>MaxBodies</code>.
+    ///   No bodies are created then.
+    /// @sa CreateBody(const BodyConf&), DestroyBodies(Span<Body* const>)
+    /// @sa PhysicalEntities
+    SizedRange<Bodies::iterator> CreateBodies(Span<const BodyConf> defs);
+
     /// @brief Creates a joint to constrain one or more bodies.
     /// @warning This function is locked during callbacks.
     /// @note No references to the configuration are retained. Its value is copied.
@@ -218,6 +252,41 @@ public:
     /// @sa PhysicalEntities
     void Destroy(Body* body);
 
+    /// @brief Destroys the given bodies.
+    /// @details Destroys the given bodies as though by calls to <code>Destroy(Body*)</code>
+    ///   but removing them, their contacts, and their proxy registrations from this world's
+    ///   containers in single passes. This is much faster than destroying many bodies one
+    ///   at a time.
+    /// @warning Behavior is undefined if given a null body or a body not created by this
+    ///   world.
+    /// @post None of the destroyed bodies will be present in the range returned from the
+    ///   <code>GetBodies()</code> method.
+    /// @param bodies Bodies to destroy that had been created by this world.
+    /// @throws WrongState if this method is called while the world is locked.
+    /// @throws InvalidArgument if a body is given more than once. No bodies are destroyed
+    ///   then.
+    /// @sa Destroy(Body*), CreateBodies
+    /// @sa PhysicalEntities
+    void DestroyBodies(Span<Body* const> bodies);
+
+    /// @brief Splits the given fixtures off of the given body onto a new body.
+    /// @details Moves the given fixtures to a new body created with the given body's
+    ///   configuration. This is done in place: the fixtures keep their broad-phase proxies
+    ///   and their contacts with other bodies, and the new body gets the velocity of the
+    ///   given body at the moved fixtures. Contacts between the moved fixtures and those
+    ///   remaining on the given body are found at the beginning of the next step.
+    /// @note Joints stay attached to the given body.
+    /// @note The mass data of both bodies is reset.
+    /// @param body Body to split the fixtures off of.
+    /// @param fixtures Fixtures of the given body to move to the new body.
+    /// @return Pointer to the newly created body.
+    /// @throws WrongState if this method is called while the world is locked.
+    /// @throws InvalidArgument if any of the given fixtures is not one of the given
+    ///   body's fixtures or is given more than once.
+    /// @throws LengthError if this operation would create more than <code>MaxBodies</code>.
+    /// @sa CreateBody(const BodyConf&), Slice(World&, Fixture&, Length2, UnitVec)
+    Body* Split(Body& body, Span<Fixture* const> fixtures);
+
     /// @brief Destroys a joint.
     /// @details Destroys a given joint that had previously been created by a call to this
     ///   world's <code>CreateJoint(const JointConf&)</code> method.
@@ -261,6 +330,7 @@ public:
     ///   of their fixtures when they experience collisions.
     /// @post The bodies for proxies queue will be empty.
     /// @post The fixtures for proxies queue will be empty.
+    /// @post The body state buffer, if any, has a new frame of the bodies' states.
     ///
     /// @param conf Configuration for the simulation step.
     ///
@@ -324,6 +394,19 @@ public:
     /// @return World contacts sized-range.
     SizedRange<Contacts::const_iterator> GetContacts() const noexcept;
     
+    /// @brief Gets the sensor overlaps.
+    /// @details Gets the overlaps found for the sensor fixtures at the end of the last
+    ///   step, less those of fixtures destroyed since. These are ordered by the sensors'
+    ///   proxies so the overlaps of each sensor proxy are contiguous.
+    /// @note This is always empty unless this world tracks sensor overlaps.
+    /// @sa WorldConf::sensorOverlaps
+    Span<const SensorOverlap> GetSensorOverlaps() const noexcept;
+    
+    /// @brief Gets the sensor overlaps of the identified sensor proxy.
+    /// @param sensorProxy Tree identifier of a proxy of a sensor fixture.
+    /// @sa GetSensorOverlaps()
+    Span<const SensorOverlap> GetSensorOverlaps(ContactCounter sensorProxy) const noexcept;
+    
     /// @brief Whether or not "step" is complete.
     /// @details The "step" is completed when there are no more TOI events for the current time step.
     /// @return <code>true</code> unless sub-stepping is enabled and the step method returned
@@ -361,6 +444,43 @@ public:
     
     /// @brief Gets the maximum vertex radius that shapes in this world can be.
     Length GetMaxVertexRadius() const noexcept;
+    
+    /// @brief Gets the task scheduler that this world's steps submit parallel work to.
+    /// @return Scheduler this world was constructed with or <code>nullptr</code>.
+    /// @sa WorldConf::taskScheduler
+    TaskScheduler* GetTaskScheduler() const noexcept;
+    
+    /// @brief Gets the step profiler that this world's steps record to.
+    /// @return Profiler this world was constructed with or <code>nullptr</code>.
+    /// @sa WorldConf::stepProfiler
+    StepProfiler* GetStepProfiler() const noexcept;
+    
+    /// @brief Gets the body state buffer that this world's steps write to.
+    /// @return Buffer this world was constructed with or <code>nullptr</code>. Copies of
+    ///   worlds have none.
+    /// @sa WorldConf::bodyStateBuffer
+    BodyStateBuffer* GetBodyStateBuffer() const noexcept;
+    
+    /// @brief Gets the contact event buffer that this world appends contact events to.
+    /// @return Buffer last set or <code>nullptr</code>.
+    /// @sa SetContactEventBuffer
+    ContactEventBuffer* GetContactEventBuffer() const noexcept;
+    
+    /// @brief Gets the registry of the shapes interned by this world.
+    /// @return Registry of the fixtures' shapes if this world was constructed with shape
+    ///   interning, else <code>nullptr</code>.
+    /// @sa WorldConf::shapeInterning
+    const ShapeRegistry* GetShapeRegistry() const noexcept;
+    
+    /// @brief Gets whether this world's step results are independent of the number of
+    ///   worker threads of its task scheduler.
+    /// @sa WorldConf::deterministic
+    bool IsDeterministic() const noexcept;
+    
+    /// @brief Gets whether this world tracks sensor overlaps instead of making contacts
+    ///   for sensors.
+    /// @sa WorldConf::sensorOverlaps
+    bool IsTrackingSensorOverlaps() const noexcept;
 
     /// @brief Gets the inverse delta time.
     /// @details Gets the inverse delta time that was set on construction or assignment, and
@@ -420,6 +540,7 @@ private:
     /// @warning Behavior is undefined if called with a fixture for a body which doesn't
     ///   belong to this world.
     /// @note This sets things up so that pairs may be created for potentially new contacts.
+    /// @note This also updates the collision filter cached by the proxies to the fixture's.
     void TouchProxies(Fixture& fixture) noexcept;
     
     /// @brief Sets new fixtures flag.
@@ -446,11 +567,25 @@ private:
         /// Locked.
         e_locked        = 0x0002,
 
+        /// Woken bodies. @details Set when sleeping bodies were woken or sleeping contacts
+        ///   were flagged for filtering since sleeping contacts were last woken.
+        /// @sa WakeContacts.
+        e_wokenBodies   = 0x0004,
+        
+        /// Deterministic. @sa WorldConf::deterministic.
+        e_deterministic = 0x0008,
+        
+        /// Sensor overlaps. @sa WorldConf::sensorOverlaps.
+        e_sensorOverlaps = 0x0010,
+
         /// Sub-stepping.
         e_substepping   = 0x0020,
         
         /// Step complete. @details Used for sub-stepping. @sa e_substepping.
         e_stepComplete  = 0x0040,
+        
+        /// AABB sensor overlaps. @sa WorldConf::aabbSensorOverlaps.
+        e_aabbSensorOverlaps = 0x0080,
     };
 
     /// @brief Copies bodies.
@@ -458,6 +593,9 @@ private:
                     std::map<const Fixture*, Fixture*>& fixtureMap,
                     SizedRange<World::Bodies::const_iterator> range);
     
+    /// @brief Copies the order of the given awake bodies of another world.
+    void CopyAwakeBodies(const std::map<const Body*, Body*>& bodyMap, const Bodies& bodies);
+    
     /// @brief Copies joints.
     void CopyJoints(const std::map<const Body*, Body*>& bodyMap,
                     SizedRange<World::Joints::const_iterator> range);
@@ -467,8 +605,43 @@ private:
                       const std::map<const Fixture*, Fixture*>& fixtureMap,
                       SizedRange<World::Contacts::const_iterator> range);
     
+    /// @brief Copies the sensors and their overlaps.
+    void CopySensors(const std::map<const Fixture*, Fixture*>& fixtureMap, const World& other);
+    
     /// @brief Clears this world without checking the world's state.
     void InternalClear() noexcept;
+    
+    /// @brief Updates the tracking of the given fixture as a sensor.
+    /// @details Adds the given fixture to the tracked sensors if it's a sensor, else removes
+    ///   it and its overlaps as a sensor.
+    /// @note This is only called for worlds tracking sensor overlaps.
+    void UpdateSensor(Fixture& fixture) noexcept;
+    
+    /// @brief Updates the sensor overlaps.
+    /// @details Re-tests the sensor and other fixture child pairs for which either
+    ///   fixture's body is awake or either proxy got touched since the last update and
+    ///   keeps the previous overlaps of the other pairs. Records the overlaps entered and
+    ///   exited since the last update to the contact event buffer.
+    void UpdateSensorOverlaps(const StepConf& conf);
+    
+    /// @brief Touches the proxies of the given fixture for the next sensor overlaps update.
+    /// @details Has the sensor overlaps of the fixture's proxies get re-tested by the next
+    ///   update even if its body isn't awake.
+    /// @note Does nothing unless this world tracks sensor overlaps.
+    void TouchSensorProxies(const Fixture& fixture);
+    
+    /// @brief Touches the proxies of the given body's fixtures for the next sensor
+    ///   overlaps update.
+    /// @note Does nothing unless this world tracks sensor overlaps.
+    void TouchSensorProxies(const Body& body);
+    
+    /// @brief Erases the sensor overlaps of the fixtures the given callback returns
+    ///   <code>true</code> for.
+    /// @details Erases the overlaps those fixtures are either the sensor or the other
+    ///   fixture of and stops tracking them as sensors. The erased overlaps are recorded
+    ///   as exited to the contact event buffer.
+    /// @note Does nothing unless this world tracks sensor overlaps.
+    void EraseSensorOverlaps(const std::function<bool(const Fixture&)>& isErased);
 
     /// @brief Internal destroy.
     /// @warning Behavior is undefined if passed a null pointer for the joint.
@@ -478,7 +651,9 @@ private:
     /// @details Finds islands, integrates and solves constraints, solves position constraints.
     /// @note This may miss collisions involving fast moving bodies and allow them to tunnel
     ///   through each other.
-    RegStepStats SolveReg(const StepConf& conf);
+    /// @param conf Step configuration.
+    /// @param times Step phase times to add the island building and solving times to.
+    RegStepStats SolveReg(const StepConf& conf, StepPhaseTimes& times);
 
     /// @brief Solves the given island (regularly).
     ///
@@ -490,32 +665,48 @@ private:
     ///      velocity for it.
     ///   4. Synchronizes every island-body's transform (by updating it to transform one of the
     ///      body's sweep).
-    ///   5. Reports to the listener (if non-null).
+    ///   5. Reports to the given listener (if non-null).
+    ///   6. Puts the island to sleep as a unit if it's been still long enough, linking its
+    ///      bodies together so that waking one of them wakes all of them.
+    ///   7. Unsets the islanded states of the island's contacts and joints.
+    ///
+    /// @note The constraints are solved over sub-steps of the step instead of with the
+    ///   regular velocity and position iterations when the configuration has sub-steps.
     ///
     /// @param conf Time step configuration information.
     /// @param island Island of bodies, contacts, and joints to solve for. Must contain at least
     ///   one body, contact, or joint.
+    /// @param listener Listener to report the island's contacts to, or <code>nullptr</code>.
+    /// @param events Buffer to record the island's contact events to, or <code>nullptr</code>.
+    /// @param times Step phase times to add the velocity and position solving times to, or
+    ///   <code>nullptr</code>.
     ///
     /// @warning Behavior is undefined if the given island doesn't have at least one body,
     ///   contact, or joint.
     ///
     /// @return Island solver results.
     ///
-    IslandStats SolveRegIslandViaGS(const StepConf& conf, Island island);
+    IslandStats SolveRegIslandViaGS(const StepConf& conf, const Island& island,
+                                    ContactListener* listener, ContactEventBuffer* events,
+                                    StepPhaseTimes* times);
     
+    /// @brief Body stack.
+    /// @note Using a std::stack<Body*, std::vector<Body*>> would be nice except it doesn't
+    ///   support the reserve method.
+    using BodyStack = std::vector<Body*>;
+
     /// @brief Adds to the island based off of a given "seed" body.
+    /// @param island Island to add to.
+    /// @param stack Empty stack for the search to use. It's empty again on return so it
+    ///   can be reused along with its capacity for building other islands.
+    /// @param seed Body to start the search from.
     /// @post Contacts are listed in the island in the order that bodies provide those contacts.
     /// @post Joints are listed the island in the order that bodies provide those joints.
-    void AddToIsland(Island& island, Body& seed,
+    void AddToIsland(Island& island, BodyStack& stack, Body& seed,
                      Bodies::size_type& remNumBodies,
                      Contacts::size_type& remNumContacts,
                      Joints::size_type& remNumJoints);
 
-    /// @brief Body stack.
-    /// @note Using a std::stack<Body*, std::vector<Body*>> would be nice except it doesn't
-    ///   support the reserve method.
-    using BodyStack = std::vector<Body*>;
-
     /// @brief Adds to the island.
     void AddToIsland(Island& island, BodyStack& stack,
                      Bodies::size_type& remNumBodies,
@@ -578,6 +769,12 @@ private:
     /// @param pos New position to set the given body to.
     /// @param vel New velocity to set the given body to.
     static void UpdateBody(Body& body, const Position& pos, const Velocity& vel);
+    
+    /// @brief Updates the given contact.
+    /// @details Updates the given contact, notifying the given listener and recording
+    ///   to the given event buffer any change in the contact's touching state.
+    static void UpdateContact(Contact& contact, const Contact::UpdateConf& conf,
+                              ContactListener* listener, ContactEventBuffer* events);
 
     /// @brief Reset bodies for solve TOI.
     void ResetBodiesForSolveTOI() noexcept;
@@ -707,10 +904,38 @@ private:
     /// have active bodies (either or both) get their Update methods called with the current
     /// contact listener as its argument.
     /// Essentially this really just purges contacts that are no longer relevant.
-    DestroyContactsStats DestroyContacts(Contacts& contacts);
+    /// @note Only the awake contacts are processed.
+    DestroyContactsStats DestroyContacts();
     
     /// @brief Update contacts.
-    UpdateContactsStats UpdateContacts(Contacts& contacts, const StepConf& conf);
+    /// @note Only the awake contacts are updated. Sleeping contacts are counted as ignored.
+    UpdateContactsStats UpdateContacts(const StepConf& conf);
+    
+    /// @brief Gets the end of the awake contacts.
+    /// @details Contacts are partitioned so that the contacts of sleeping islands follow
+    ///   all of the other contacts. This gets the iterator to the first sleeping contact.
+    Contacts::iterator GetAwakeContactsEnd() noexcept;
+    
+    /// @brief Gets the end of the awake contacts.
+    Contacts::const_iterator GetAwakeContactsEnd() const noexcept;
+    
+    /// @brief Moves contacts whose bodies were all put to sleep to the sleeping contacts.
+    void SleepContacts() noexcept;
+    
+    /// @brief Moves sleeping contacts with a woken body back to the awake contacts.
+    /// @details This only does anything if sleeping bodies were woken since it was last called.
+    void WakeContacts() noexcept;
+    
+    /// @brief Lets this world know that sleeping bodies were woken.
+    void SetWokenBodies() noexcept;
+    
+    /// @brief Adds the given awake body to the list of awake bodies unless already listed.
+    /// @note This doesn't allocate memory as the list's capacity is kept to at least the
+    ///   number of bodies.
+    void AddAwakeBody(Body& body) noexcept;
+    
+    /// @brief Reserves room in the list of awake bodies for the given number of bodies.
+    void ReserveAwakeBodies(Bodies::size_type count);
     
     /// @brief Destroys the given contact and removes it from its container.
     /// @details This updates the contacts container, returns the memory to the allocator,
@@ -727,14 +952,24 @@ private:
     ///   3. The bodies of the proxies should collide (according to <code>ShouldCollide</code>).
     ///   4. The contact filter says the fixtures of the proxies should collide.
     ///   5. There exists a contact-create function for the pair of shapes of the proxies.
+    /// @note For a proxy shared by a fixture's children, a contact is added for every child
+    ///   whose AABB overlaps with the other proxy's AABB that doesn't already have one.
     /// @post The size of the <code>m_contacts</code> collection is one greater-than it was
     ///   before this method is called if it returns <code>true</code>.
     /// @param key ID's of dynamic tree entries identifying the fixture proxies involved.
     /// @return <code>true</code> if a new contact was indeed added (and created),
     ///   else <code>false</code>.
     /// @sa bool ShouldCollide(const Body& lhs, const Body& rhs) noexcept
+    /// @sa Fixture::GetChildTree
     bool Add(ContactKey key);
     
+    /// @brief Adds a contact for the given children of the fixtures of the proxies
+    ///   identified by the key if no contact already exists for them.
+    /// @return <code>true</code> if a new contact was indeed added (and created),
+    ///   else <code>false</code>.
+    bool Add(ContactKey key, Fixture& fixtureA, ChildCounter indexA,
+             Fixture& fixtureB, ChildCounter indexB);
+    
     /// @brief Registers the given dynamic tree ID for processing.
     void RegisterForProcessing(ProxyId pid) noexcept;
 
@@ -745,7 +980,10 @@ private:
     void InternalDestroy(Contact* contact, Body* from = nullptr);
 
     /// @brief Creates proxies for every child of the given fixture's shape.
-    /// @note This sets the proxy count to the child count of the shape.
+    /// @note This sets the proxy count to the child count of the shape, or to one along
+    ///   with building the fixture's child tree when the fixture is a single proxy one
+    ///   whose shape has more than one child. Fixtures of height field shapes always get
+    ///   one proxy but no child tree.
     void CreateProxies(Fixture& fixture, Length aabbExtension);
 
     /// @brief Destroys the given fixture's proxies.
@@ -817,6 +1055,17 @@ private:
     
     Bodies m_bodies; ///< Body collection.
 
+    /// @brief Awake bodies.
+    /// @details These are the bodies that the regular phase of stepping seeds islands from,
+    ///   in the order they got woken. Bodies that got put to sleep are dropped from this
+    ///   by the regular phase of the next step.
+    Bodies m_awakeBodies;
+
+    /// @brief Bodies advanced by the time of impact phase.
+    /// @details These are the bodies whose sweeps' alpha-0 values may be non-zero. They're
+    ///   reset by the time of impact phase of the next step.
+    Bodies m_toiBodies;
+
     Joints m_joints; ///< Joint collection.
 
     /// @brief Container of contacts.
@@ -824,10 +1073,17 @@ private:
     ///   during a given time step.
     Contacts m_contacts;
     
+    /// @brief Count of sleeping contacts.
+    /// @details These are the contacts at the end of <code>m_contacts</code> which are skipped
+    ///   by stepping until a body of theirs gets woken.
+    Contacts::size_type m_sleepingContactCount = 0;
+    
     DestructionListener* m_destructionListener = nullptr; ///< Destruction listener. 8-bytes.
     
     ContactListener* m_contactListener = nullptr; ///< Contact listener. 8-bytes.
     
+    ContactEventBuffer* m_contactEventBuffer = nullptr; ///< Contact event buffer. 8-bytes.
+    
     FlagsType m_flags = e_stepComplete; ///< Flags.
 
     /// Inverse delta-t from previous step.
@@ -848,6 +1104,36 @@ private:
     /// numerical issues. It can also be set below this upper bound to constrain the differences
     /// between shape vertex radiuses to possibly more limited visual ranges.
     Positive<Length> m_maxVertexRadius;
+    
+    /// @brief Task scheduler.
+    /// @details Scheduler to submit the work of the parallelizable phases of steps to.
+    ///   Not owned by this world.
+    TaskScheduler* m_taskScheduler = nullptr;
+    
+    /// @brief Step profiler. Not owned by this world.
+    StepProfiler* m_stepProfiler = nullptr;
+    
+    /// @brief Body state buffer. Not owned by this world.
+    BodyStateBuffer* m_bodyStateBuffer = nullptr;
+    
+    /// @brief Shape registry.
+    /// @details Registry of the fixtures' shapes. Only present with shape interning.
+    std::unique_ptr<ShapeRegistry> m_shapeRegistry;
+    
+    /// @brief Sensors. @details Sensor fixtures of worlds tracking sensor overlaps.
+    std::vector<Fixture*> m_sensors;
+    
+    /// @brief Sensor overlaps. @details Sorted overlaps of the sensors.
+    std::vector<SensorOverlap> m_sensorOverlaps;
+    
+    /// @brief New sensor overlaps.
+    /// @details Overlaps found by the last update. Kept to reuse its memory.
+    std::vector<SensorOverlap> m_newSensorOverlaps;
+    
+    /// @brief Sensor touched proxies.
+    /// @details Proxies moved, created, or otherwise touched since the last update of the
+    ///   sensor overlaps. Only kept by worlds tracking sensor overlaps.
+    std::vector<ProxyId> m_sensorTouchedProxies;
 };
 
 /// @example HelloWorld.cpp
@@ -937,6 +1223,32 @@ inline bool World::HasNewFixtures() const noexcept
     return (m_flags & e_newFixture) != 0u;
 }
 
+inline World::Contacts::iterator World::GetAwakeContactsEnd() noexcept
+{
+    return end(m_contacts) - static_cast<Contacts::difference_type>(m_sleepingContactCount);
+}
+
+inline World::Contacts::const_iterator World::GetAwakeContactsEnd() const noexcept
+{
+    return cend(m_contacts) - static_cast<Contacts::difference_type>(m_sleepingContactCount);
+}
+
+inline void World::SetWokenBodies() noexcept
+{
+    m_flags |= e_wokenBodies;
+}
+
+inline void World::AddAwakeBody(Body& body) noexcept
+{
+    assert(body.IsAwake());
+    if (!BodyAtty::IsAwakeListed(body))
+    {
+        assert(size(m_awakeBodies) < m_awakeBodies.capacity());
+        BodyAtty::SetAwakeListed(body);
+        m_awakeBodies.push_back(&body);
+    }
+}
+
 inline void World::SetNewFixtures() noexcept
 {
     m_flags |= e_newFixture;
@@ -957,6 +1269,46 @@ inline Length World::GetMaxVertexRadius() const noexcept
     return m_maxVertexRadius;
 }
 
+inline TaskScheduler* World::GetTaskScheduler() const noexcept
+{
+    return m_taskScheduler;
+}
+
+inline StepProfiler* World::GetStepProfiler() const noexcept
+{
+    return m_stepProfiler;
+}
+
+inline BodyStateBuffer* World::GetBodyStateBuffer() const noexcept
+{
+    return m_bodyStateBuffer;
+}
+
+inline ContactEventBuffer* World::GetContactEventBuffer() const noexcept
+{
+    return m_contactEventBuffer;
+}
+
+inline const ShapeRegistry* World::GetShapeRegistry() const noexcept
+{
+    return m_shapeRegistry.get();
+}
+
+inline bool World::IsDeterministic() const noexcept
+{
+    return (m_flags & e_deterministic) != 0u;
+}
+
+inline bool World::IsTrackingSensorOverlaps() const noexcept
+{
+    return (m_flags & e_sensorOverlaps) != 0u;
+}
+
+inline Span<const SensorOverlap> World::GetSensorOverlaps() const noexcept
+{
+    return Span<const SensorOverlap>(data(m_sensorOverlaps), size(m_sensorOverlaps));
+}
+
 inline Frequency World::GetInvDeltaTime() const noexcept
 {
     return m_inv_dt0;
@@ -977,6 +1329,11 @@ inline void World::SetContactListener(ContactListener* listener) noexcept
     m_contactListener = listener;
 }
 
+inline void World::SetContactEventBuffer(ContactEventBuffer* buffer) noexcept
+{
+    m_contactEventBuffer = buffer;
+}
+
 inline bool World::IsIslanded(const Body* body) const noexcept
 {
     return BodyAtty::IsIslanded(*body);
@@ -1026,6 +1383,10 @@ inline void World::RegisterForProcessing(ProxyId pid) noexcept
 {
     assert(pid != DynamicTree::GetInvalidSize());
     m_proxies.push_back(pid);
+    if (IsTrackingSensorOverlaps())
+    {
+        m_sensorTouchedProxies.push_back(pid);
+    }
 }
 
 // Free functions.
@@ -1148,9 +1509,108 @@ inline void ClearForces(World& world) noexcept
 }
 
 /// @brief Finds body in given world that's closest to the given location.
+/// @note This compares the locations of all of the world's bodies. Use
+///   <code>FindClosestFixture</code> or <code>FindClosestFixtures</code> instead for
+///   queries based on the bodies' geometry that scale to many bodies.
 /// @relatedalso World
 Body* FindClosestBody(const World& world, Length2 location) noexcept;
 
+/// @brief Fixture child and its distance from a queried location.
+struct FixtureDistance
+{
+    Fixture* fixture = nullptr; ///< Fixture. Null if nothing was found.
+    ChildCounter childIndex = 0; ///< Index of the child of the fixture's shape.
+    Length distance = 0_m; ///< Distance to the child. Zero if the location is within it.
+};
+
+/// @brief Finds up to the given count of fixture children nearest to the given location.
+/// @details This is a branch-and-bound query of the world's dynamic tree using the
+///   distance to the tree's AABBs as the bound and the exact distance to the children's
+///   shapes for the results.
+/// @note Only fixtures that have proxies in the dynamic tree are found. Proxies for new
+///   fixtures get created by the world's next step.
+/// @note A fixture having a shared proxy is found once, for its nearest child.
+/// @return Results sorted by increasing distance.
+/// @relatedalso World
+std::vector<FixtureDistance> FindClosestFixtures(const World& world, Length2 location,
+                                                 std::size_t count);
+
+/// @brief Finds the fixture child nearest to the given location.
+/// @return Fixture child nearest to the given location or a result with a null fixture
+///   if the world's dynamic tree has no proxies.
+/// @sa FindClosestFixtures
+/// @relatedalso World
+FixtureDistance FindClosestFixture(const World& world, Length2 location);
+
+/// @brief Finds the fixture children within the given radius of the given location.
+/// @note Only fixtures that have proxies in the dynamic tree are found.
+/// @note A fixture having a shared proxy is found once, for its nearest child.
+/// @return Results sorted by increasing distance.
+/// @relatedalso World
+std::vector<FixtureDistance> FindFixturesWithin(const World& world, Length2 location,
+                                                Length radius);
+
+/// @brief Fixture child hit by a shape cast.
+struct FixtureShapeCastHit
+{
+    Fixture* fixture = nullptr; ///< Fixture. Null if nothing was hit.
+    ChildCounter childIndex = 0; ///< Index of the child of the fixture's shape.
+    ShapeCastHit hit; ///< Hit data.
+};
+
+/// @brief Finds the first fixture child hit by sweeping the given input shape.
+/// @details Shape casts the world's dynamic tree clipping the cast to each hit found
+///   so that every candidate after the first hit is checked against a shrinking sweep.
+/// @note Only fixtures that have proxies in the dynamic tree are found.
+/// @return Data for the closest hit or a result with a null fixture if nothing was hit.
+/// @sa ShapeCast(const DynamicTree&, ShapeCastInput, const FixtureShapeCastCB&, ToiConf)
+/// @relatedalso World
+FixtureShapeCastHit ShapeCast(const World& world, const ShapeCastInput& input);
+
+/// @brief Finds the first fixture child hit by each of the given shape casts.
+/// @return Results in the same order as the given inputs.
+/// @relatedalso World
+std::vector<FixtureShapeCastHit> ShapeCast(const World& world, Span<const ShapeCastInput> inputs);
+
+/// @brief Determines whether sweeping the given input shape hits any fixture child.
+/// @details This stops the traversal of the world's dynamic tree at the first hit found
+///   which makes it cheaper than finding the first hit when the hit itself isn't needed.
+/// @relatedalso World
+bool TestShapeCast(const World& world, const ShapeCastInput& input);
+
+/// @brief Fixture child hit by a ray.
+struct FixtureRayCastHit
+{
+    Fixture* fixture = nullptr; ///< Fixture. Null if nothing was hit.
+    ChildCounter childIndex = 0; ///< Index of the child of the fixture's shape.
+    RayCastHit hit; ///< Hit data.
+};
+
+/// @brief Finds the first fixture child hit by each of the given rays.
+/// @details Casts all of the rays as a packet through the world's dynamic tree and
+///   intersects the rays reaching each leaf with its shape child in one batch.
+/// @note Only fixtures that have proxies in the dynamic tree are found.
+/// @note Like other ray casts, this ignores shapes that contain a ray's starting point.
+/// @return Results in the same order as the given inputs.
+/// @sa RayCast(const DynamicTree&, Span<RayCastInput>, const DynamicTreeRayPacketCB&)
+/// @relatedalso World
+std::vector<FixtureRayCastHit> RayCast(const World& world, Span<const RayCastInput> inputs);
+
+/// @brief Slices the given polygon fixture along the given line into two bodies.
+/// @details Replaces the given fixture with the pieces of its polygon on either side of
+///   the line and splits the piece on the side the normal points to off onto a new body.
+/// @param world World the fixture is in.
+/// @param fixture Polygon fixture to slice. This is destroyed if the line cuts it.
+/// @param point Point on the slicing line in world coordinates.
+/// @param normal Normal of the slicing line in world coordinates.
+/// @return Pointer to the new body or <code>nullptr</code> if the line doesn't cut through
+///   the fixture's polygon.
+/// @throws InvalidArgument if the fixture's shape is not a polygon.
+/// @throws WrongState if this function is called while the world is locked.
+/// @sa World::Split, Slice(const PolygonShapeConf&, Length2, UnitVec)
+/// @relatedalso World
+Body* Slice(World& world, Fixture& fixture, Length2 point, UnitVec normal);
+
 } // namespace d2
 
 /// @brief Updates the given regular step statistics.
@@ -53,6 +53,24 @@ private:
         world.TouchProxies(fixture);
     }
 
+    /// @brief Lets the given world know that the sensor state of the given fixture changed.
+    static void UpdateSensor(World& world, Fixture& fixture) noexcept
+    {
+        world.UpdateSensor(fixture);
+    }
+
+    /// @brief Lets the given world know that sleeping bodies were woken.
+    static void SetWokenBodies(World& world) noexcept
+    {
+        world.SetWokenBodies();
+    }
+
+    /// @brief Adds the given woken body to the given world's list of awake bodies.
+    static void AddAwakeBody(World& world, Body& body) noexcept
+    {
+        world.AddAwakeBody(body);
+    }
+
     /// @brief Sets the type of the given body.
     /// @note This may alter the body's mass and velocity.
     /// @throws WrongState if this method is called while the world is locked.
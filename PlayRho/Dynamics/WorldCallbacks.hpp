@@ -76,6 +76,9 @@ public:
     virtual ~ContactListener() = default;
 
     /// @brief Called when two fixtures begin to touch.
+    /// @note With speculative contacts, this may get called while the fixtures are
+    ///   still apart.
+    /// @sa StepConf::doSpeculative.
     virtual void BeginContact(Contact& contact) = 0;
 
     /// @brief End contact callback.
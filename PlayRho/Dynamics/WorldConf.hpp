@@ -28,8 +28,14 @@
 #include <PlayRho/Common/BoundedValue.hpp>
 
 namespace playrho {
+
+class TaskScheduler;
+class StepProfiler;
+
 namespace d2 {
 
+class BodyStateBuffer;
+
 /// @brief World configuration data.
 struct WorldConf
 {
@@ -42,6 +48,39 @@ struct WorldConf
     /// @brief Uses the given value as the initial dynamic tree size.
     PLAYRHO_CONSTEXPR inline WorldConf& UseInitialTreeSize(ContactCounter value) noexcept;
     
+    /// @brief Uses the given body capacity.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseBodyCapacity(BodyCounter value) noexcept;
+    
+    /// @brief Uses the given contact capacity.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseContactCapacity(ContactCounter value) noexcept;
+    
+    /// @brief Uses the given joint capacity.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseJointCapacity(JointCounter value) noexcept;
+    
+    /// @brief Uses the given proxy capacity.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseProxyCapacity(ContactCounter value) noexcept;
+    
+    /// @brief Uses the given task scheduler.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseTaskScheduler(TaskScheduler* value) noexcept;
+    
+    /// @brief Uses the given step profiler.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseStepProfiler(StepProfiler* value) noexcept;
+    
+    /// @brief Uses the given body state buffer.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseBodyStateBuffer(BodyStateBuffer* value) noexcept;
+    
+    /// @brief Uses the given shape interning value.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseShapeInterning(bool value) noexcept;
+    
+    /// @brief Uses the given deterministic value.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseDeterministic(bool value) noexcept;
+    
+    /// @brief Uses the given sensor overlaps value.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseSensorOverlaps(bool value) noexcept;
+    
+    /// @brief Uses the given AABB sensor overlaps value.
+    PLAYRHO_CONSTEXPR inline WorldConf& UseAabbSensorOverlaps(bool value) noexcept;
+    
     /// @brief Minimum vertex radius.
     /// @details This is the minimum vertex radius that this world establishes which bodies
     ///    shall allow fixtures to be created with. Trying to create a fixture with a shape
@@ -63,6 +102,94 @@ struct WorldConf
     
     /// @brief Initial tree size.
     ContactCounter initialTreeSize = 4096;
+    
+    /// @brief Body capacity.
+    /// @details Number of bodies the world reserves room for on construction. Creating
+    ///   up to this many bodies doesn't grow the world's body containers.
+    /// @note This is only a hint. The world still grows as needed.
+    /// @sa World::CreateBodies
+    BodyCounter bodyCapacity = 0;
+    
+    /// @brief Contact capacity.
+    /// @details Number of contacts the world reserves room for on construction.
+    /// @note This is only a hint. The world still grows as needed.
+    ContactCounter contactCapacity = 0;
+    
+    /// @brief Joint capacity.
+    /// @details Number of joints the world reserves room for on construction.
+    /// @note This is only a hint. The world still grows as needed.
+    JointCounter jointCapacity = 0;
+    
+    /// @brief Proxy capacity.
+    /// @details Number of broad-phase proxies the world reserves room for on construction.
+    ///   This sizes the dynamic tree for this many leaves if that's more than the initial
+    ///   tree size, and the queues of fixtures and proxies waiting to be processed.
+    /// @note This is only a hint. The world still grows as needed.
+    /// @sa initialTreeSize
+    ContactCounter proxyCapacity = 0;
+    
+    /// @brief Task scheduler.
+    /// @details Scheduler that the world's step submits the work of its parallelizable
+    ///   phases to. These are the updating of contacts and the solving of the regular
+    ///   islands. With none, all of the work is done on the calling thread.
+    /// @note The scheduler is not owned by the world and must outlive it.
+    /// @warning With a scheduler, contact listener methods may get called concurrently
+    ///   from different threads unless the world is deterministic.
+    /// @sa deterministic
+    /// @sa WorkStealingScheduler
+    TaskScheduler* taskScheduler = nullptr;
+    
+    /// @brief Step profiler.
+    /// @details Profiler that the world's steps record the timeline of their phases to.
+    /// @note The profiler is not owned by the world and must outlive it.
+    /// @note Only used when the library is built with step profiling.
+    /// @sa IsStepProfilingEnabled
+    StepProfiler* stepProfiler = nullptr;
+    
+    /// @brief Body state buffer.
+    /// @details Buffer that the world's steps write the states of the bodies to when
+    ///   they finish, for other threads to read from without blocking the steps.
+    /// @note The buffer is not owned by the world and must outlive it.
+    /// @sa BodyStateBuffer
+    BodyStateBuffer* bodyStateBuffer = nullptr;
+    
+    /// @brief Shape interning.
+    /// @details Whether the world interns the shapes of the fixtures created in it. With
+    ///   this, fixtures created from equal shapes share one shape configuration instance
+    ///   and the mass data and child proxies of that instance are calculated only once.
+    /// @sa ShapeRegistry, World::GetShapeRegistry
+    bool shapeInterning = false;
+    
+    /// @brief Deterministic.
+    /// @details Whether the results of the world's steps are independent of the task
+    ///   scheduler's worker count. The parallel phases already partition their work into
+    ///   chunks whose bounds don't depend on the worker count and write only to the
+    ///   chunk's own elements. With this, the contact listener calls of those phases are
+    ///   also recorded per chunk and made afterwards from the stepping thread in the same
+    ///   order as they'd be made without a scheduler.
+    /// @note This makes lockstep simulations possible on machines with differing numbers
+    ///   of cores at the cost of recording the listener calls. Without a contact listener
+    ///   or a task scheduler, it has no effect.
+    bool deterministic = false;
+    
+    /// @brief Sensor overlaps.
+    /// @details Whether the world tracks what sensor fixtures overlap with in compact
+    ///   overlap sets instead of with contacts. The overlaps of all the sensors get found
+    ///   anew at the end of every step and compared with the last ones for the sensor
+    ///   enter and exit events. Sensors then take no part in island building, solving,
+    ///   nor in the time of impact phase.
+    /// @note The contact listener isn't called for sensors then. Use a contact event
+    ///   buffer for the sensor enter and exit events instead.
+    /// @sa World::GetSensorOverlaps
+    /// @sa ContactEventBuffer
+    bool sensorOverlaps = false;
+    
+    /// @brief AABB sensor overlaps.
+    /// @details Whether tracked sensor overlaps are only tested for the overlap of the
+    ///   children's AABBs instead of the overlap of the children's shapes.
+    /// @note Only used along with sensor overlaps.
+    /// @sa sensorOverlaps
+    bool aabbSensorOverlaps = false;
 };
 
 PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseMinVertexRadius(Positive<Length> value) noexcept
@@ -83,6 +210,72 @@ PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseInitialTreeSize(ContactCounter
     return *this;
 }
 
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseBodyCapacity(BodyCounter value) noexcept
+{
+    bodyCapacity = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseContactCapacity(ContactCounter value) noexcept
+{
+    contactCapacity = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseJointCapacity(JointCounter value) noexcept
+{
+    jointCapacity = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseProxyCapacity(ContactCounter value) noexcept
+{
+    proxyCapacity = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseTaskScheduler(TaskScheduler* value) noexcept
+{
+    taskScheduler = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseStepProfiler(StepProfiler* value) noexcept
+{
+    stepProfiler = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseBodyStateBuffer(BodyStateBuffer* value) noexcept
+{
+    bodyStateBuffer = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseShapeInterning(bool value) noexcept
+{
+    shapeInterning = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseDeterministic(bool value) noexcept
+{
+    deterministic = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseSensorOverlaps(bool value) noexcept
+{
+    sensorOverlaps = value;
+    return *this;
+}
+
+PLAYRHO_CONSTEXPR inline WorldConf& WorldConf::UseAabbSensorOverlaps(bool value) noexcept
+{
+    aabbSensorOverlaps = value;
+    return *this;
+}
+
 /// Gets the default definitions value.
 /// @note This method exists as a work-around for providing the World constructor a default
 ///   value without otherwise getting a compiler error such as:
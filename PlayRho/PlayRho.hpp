@@ -98,6 +98,8 @@ For a more elaborate example, see
 #include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/MultiShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ShapeRegistry.hpp>
 
 #include <PlayRho/Collision/Collision.hpp>
 #include <PlayRho/Collision/Manifold.hpp>
@@ -0,0 +1,112 @@
+/*
+* Original work Copyright (c) 2006-2013 Erin Catto http://www.box2d.org
+* Modified work Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "Camera.hpp"
+
+using namespace playrho;
+using namespace playrho::d2;
+
+namespace testbed {
+
+Camera g_camera;
+
+Length2 ConvertScreenToWorld(const Coord2D ps, const Camera& camera)
+{
+    const auto w = float(camera.m_width);
+    const auto h = float(camera.m_height);
+    const auto u = ps.x / w;
+    const auto v = (h - ps.y) / h;
+    
+    const auto ratio = w / h;
+    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
+    
+    const auto lower = camera.m_center - extents;
+    const auto upper = camera.m_center + extents;
+    
+    const auto x = Real{((1 - u) * lower.x + u * upper.x)};
+    const auto y = Real{((1 - v) * lower.y + v * upper.y)};
+    return Length2{x * Meter, y * Meter};
+}
+
+AABB ConvertScreenToWorld(const Camera& camera)
+{
+    const auto w = float(camera.m_width);
+    const auto h = float(camera.m_height);
+    
+    const auto ratio = w / h;
+    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
+    
+    const auto lower = camera.m_center - extents;
+    const auto upper = camera.m_center + extents;
+    
+    return AABB{
+        Length2{Real{lower.x} * Meter, Real{lower.y} * Meter},
+        Length2{Real{upper.x} * Meter, Real{upper.y} * Meter}
+    };
+}
+
+Coord2D ConvertWorldToScreen(const Length2 pw, const Camera& camera)
+{
+    const auto w = float(camera.m_width);
+    const auto h = float(camera.m_height);
+    const auto ratio = w / h;
+    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
+    
+    const auto lower = camera.m_center - extents;
+    const auto upper = camera.m_center + extents;
+    
+    const auto u = (float(Real{GetX(pw) / Meter}) - lower.x) / (upper.x - lower.x);
+    const auto v = (float(Real{GetY(pw) / Meter}) - lower.y) / (upper.y - lower.y);
+    
+    return Coord2D{u * w, (float(1) - v) * h};
+}
+
+// Convert from world coordinates to normalized device coordinates.
+// http://www.songho.ca/opengl/gl_projectionmatrix.html
+ProjectionMatrix GetProjectionMatrix(float zBias, const Camera& camera)
+{
+    const auto w = float(camera.m_width);
+    const auto h = float(camera.m_height);
+    const auto ratio = w / h;
+    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
+    
+    const auto lower = camera.m_center - extents;
+    const auto upper = camera.m_center + extents;
+    
+    return ProjectionMatrix{{
+        2.0f / (upper.x - lower.x), // 0
+        0.0f, // 1
+        0.0f, // 2
+        0.0f, // 3
+        0.0f, // 4
+        2.0f / (upper.y - lower.y), // 5
+        0.0f, // 6
+        0.0f, // 7
+        0.0f, // 8
+        0.0f, // 9
+        1.0f, // 10
+        0.0f, // 11
+        -(upper.x + lower.x) / (upper.x - lower.x), // 12
+        -(upper.y + lower.y) / (upper.y - lower.y), // 13
+        zBias, // 14
+        1.0f
+    }};
+}
+
+} // namespace testbed
@@ -37,8 +37,6 @@ using namespace playrho::d2;
 
 namespace testbed {
 
-Camera g_camera;
-
 namespace {
 
 static void sCheckGLError()
@@ -125,90 +123,6 @@ static GLuint sCreateShaderProgram(const char* vs, const char* fs)
 
 } // namespace
 
-
-Length2 ConvertScreenToWorld(const Coord2D ps, const Camera& camera)
-{
-    const auto w = float(camera.m_width);
-    const auto h = float(camera.m_height);
-    const auto u = ps.x / w;
-    const auto v = (h - ps.y) / h;
-    
-    const auto ratio = w / h;
-    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
-    
-    const auto lower = camera.m_center - extents;
-    const auto upper = camera.m_center + extents;
-    
-    const auto x = Real{((1 - u) * lower.x + u * upper.x)};
-    const auto y = Real{((1 - v) * lower.y + v * upper.y)};
-    return Length2{x * Meter, y * Meter};
-}
-
-AABB ConvertScreenToWorld(const Camera& camera)
-{
-    const auto w = float(camera.m_width);
-    const auto h = float(camera.m_height);
-    
-    const auto ratio = w / h;
-    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
-    
-    const auto lower = camera.m_center - extents;
-    const auto upper = camera.m_center + extents;
-    
-    return AABB{
-        Length2{Real{lower.x} * Meter, Real{lower.y} * Meter},
-        Length2{Real{upper.x} * Meter, Real{upper.y} * Meter}
-    };
-}
-
-Coord2D ConvertWorldToScreen(const Length2 pw, const Camera& camera)
-{
-    const auto w = float(camera.m_width);
-    const auto h = float(camera.m_height);
-    const auto ratio = w / h;
-    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
-    
-    const auto lower = camera.m_center - extents;
-    const auto upper = camera.m_center + extents;
-    
-    const auto u = (float(Real{GetX(pw) / Meter}) - lower.x) / (upper.x - lower.x);
-    const auto v = (float(Real{GetY(pw) / Meter}) - lower.y) / (upper.y - lower.y);
-    
-    return Coord2D{u * w, (float(1) - v) * h};
-}
-
-// Convert from world coordinates to normalized device coordinates.
-// http://www.songho.ca/opengl/gl_projectionmatrix.html
-ProjectionMatrix GetProjectionMatrix(float zBias, const Camera& camera)
-{
-    const auto w = float(camera.m_width);
-    const auto h = float(camera.m_height);
-    const auto ratio = w / h;
-    const auto extents = Coord2D{ratio * 25.0f, 25.0f} * camera.m_zoom;
-    
-    const auto lower = camera.m_center - extents;
-    const auto upper = camera.m_center + extents;
-    
-    return ProjectionMatrix{{
-        2.0f / (upper.x - lower.x), // 0
-        0.0f, // 1
-        0.0f, // 2
-        0.0f, // 3
-        0.0f, // 4
-        2.0f / (upper.y - lower.y), // 5
-        0.0f, // 6
-        0.0f, // 7
-        0.0f, // 8
-        0.0f, // 9
-        1.0f, // 10
-        0.0f, // 11
-        -(upper.x + lower.x) / (upper.x - lower.x), // 12
-        -(upper.y + lower.y) / (upper.y - lower.y), // 13
-        zBias, // 14
-        1.0f
-    }};
-}
-
 struct GLRenderPoints
 {
     GLRenderPoints()
@@ -22,6 +22,7 @@
 
 #include <PlayRho/PlayRho.hpp>
 #include "Drawer.hpp"
+#include "Camera.hpp"
 
 namespace testbed {
 
@@ -29,63 +30,6 @@ struct GLRenderPoints;
 struct GLRenderLines;
 struct GLRenderTriangles;
 
-struct ProjectionMatrix
-{
-    float m[16];
-};
-
-struct Coord2D
-{
-    float x;
-    float y;
-};
-
-/// @brief Multiplication operator.
-inline Coord2D operator* (Coord2D coord, float scalar)
-{
-    return Coord2D{coord.x * scalar, coord.y * scalar};
-}
-
-/// @brief Multiplication operator.
-inline Coord2D operator* (float scalar, Coord2D coord)
-{
-    return Coord2D{coord.x * scalar, coord.y * scalar};
-}
-
-/// @brief Division operator.
-inline Coord2D operator/ (Coord2D coord, float scalar)
-{
-    return Coord2D{coord.x / scalar, coord.y / scalar};
-}
-
-/// @brief Addition operator.
-inline Coord2D operator+ (Coord2D a, Coord2D b)
-{
-    return Coord2D{a.x + b.x, a.y + b.y};
-}
-
-/// @brief Subtraction operator.
-inline Coord2D operator- (Coord2D a, Coord2D b)
-{
-    return Coord2D{a.x - b.x, a.y - b.y};
-}
-
-struct Camera
-{
-    Coord2D m_center = Coord2D{0.0f, 20.0f};
-    float m_extent = 25.0f;
-    float m_zoom = 1.0f;
-    int m_width = 1280;
-    int m_height = 800;
-};
-
-extern Camera g_camera;
-    
-playrho::Length2 ConvertScreenToWorld(const Coord2D screenPoint, const Camera& camera = g_camera);
-playrho::d2::AABB ConvertScreenToWorld(const Camera& camera = g_camera);
-Coord2D ConvertWorldToScreen(const playrho::Length2 worldPoint, const Camera& camera = g_camera);
-ProjectionMatrix GetProjectionMatrix(float zBias, const Camera& camera = g_camera);
-
 class DebugDraw : public Drawer
 {
 public:
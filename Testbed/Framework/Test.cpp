@@ -164,6 +164,15 @@ void Draw(Drawer& drawer, const ChainShapeConf& shape, Color color, bool skins,
     }
 }
 
+void Draw(Drawer& drawer, const HeightFieldShapeConf& shape, Color color, bool skins, Transformation xf)
+{
+    const auto count = GetChildCount(shape);
+    for (auto i = decltype(count){0}; i < count; ++i)
+    {
+        Draw(drawer, GetChild(shape, i), color, skins, xf);
+    }
+}
+
 void Draw(Drawer& drawer, const PolygonShapeConf& shape, Color color, bool skins, Transformation xf)
 {
     Draw(drawer, GetChild(shape, 0), color, skins, xf);
@@ -1403,6 +1412,14 @@ bool Visit(const d2::ChainShapeConf& shape, void* userData)
     return true;
 }
 
+template <>
+bool Visit(const d2::HeightFieldShapeConf& shape, void* userData)
+{
+    const auto data = static_cast<testbed::VisitorData*>(userData);
+    Draw(*(data->drawer), shape, data->color, data->skins, data->xf);
+    return true;
+}
+
 template <>
 bool Visit(const d2::MultiShapeConf& shape, void* userData)
 {
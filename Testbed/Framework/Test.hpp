@@ -208,6 +208,12 @@ public:
     FixtureSet GetSelectedFixtures() const noexcept { return m_selectedFixtures; }
     BodySet GetSelectedBodies() const noexcept { return m_selectedBodies; }
 
+    /// @brief Gets the statistics of the last step that had a non-zero delta time.
+    const StepStats& GetStepStats() const noexcept { return m_stepStats; }
+
+    /// @brief Gets the compute time of the world step of the last step.
+    std::chrono::duration<double> GetStepDuration() const noexcept { return m_curStepDuration; }
+
     World m_world;
 
     static const LinearAcceleration2 Gravity;
@@ -456,6 +462,7 @@ void Draw(Drawer& drawer, const EdgeShapeConf& shape, Color color, bool skins, T
 void Draw(Drawer& drawer, const PolygonShapeConf& shape, Color color, bool skins, Transformation xf);
 void Draw(Drawer& drawer, const ChainShapeConf& shape, Color color, bool skins, Transformation xf);
 void Draw(Drawer& drawer, const MultiShapeConf& shape, Color color, bool skins, Transformation xf);
+void Draw(Drawer& drawer, const HeightFieldShapeConf& shape, Color color, bool skins, Transformation xf);
 
 } // namespace testbed
 
@@ -476,6 +483,9 @@ bool Visit(const d2::ChainShapeConf& shape, void* userData);
 template <>
 bool Visit(const d2::MultiShapeConf& shape, void* userData);
 
+template <>
+bool Visit(const d2::HeightFieldShapeConf& shape, void* userData);
+
 } // namespace playrho
 
 #endif
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+// Headless runner of the Testbed's test scenes.
+//
+// Sets up every test scene (or just the ones whose names contain the filter text),
+// steps each for the given number of frames without rendering anything, and writes the
+// world step times, per-phase times, and summed step statistics out as JSON.
+//
+// Usage: TestbedHeadless [--steps=N] [--filter=TEXT] [--output=FILE] [--list]
+
+#include "../Framework/Test.hpp"
+#include "../Framework/TestEntry.hpp"
+#include "../Framework/Drawer.hpp"
+#include "../Framework/DebugDraw.hpp"
+#include "../Framework/UiState.hpp"
+
+#include <PlayRho/Common/Version.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace testbed;
+
+namespace {
+
+/// @brief Drawer that draws nothing.
+class NullDrawer: public Drawer
+{
+public:
+    void DrawPolygon(const Length2*, size_type, const Color&) override {}
+    void DrawSolidPolygon(const Length2*, size_type, const Color&) override {}
+    void DrawCircle(const Length2&, Length, const Color&) override {}
+    void DrawSolidCircle(const Length2&, Length, const Color&) override {}
+    void DrawSegment(const Length2&, const Length2&, const Color&) override {}
+    void DrawSegment(const Length2&, const Color&, const Length2&, const Color&) override {}
+    void DrawPoint(const Length2&, float, const Color&) override {}
+    void DrawString(const Length2&, TextAlign, const char*, ...) override {}
+    void Flush() override {}
+    void SetTranslation(Length2 value) override { m_translation = value; }
+    Length2 GetTranslation() const override { return m_translation; }
+
+private:
+    Length2 m_translation = Length2{};
+};
+
+/// @brief Results of running a scene.
+struct SceneResults
+{
+    std::string name;
+    unsigned steps = 0;
+    std::chrono::duration<double> sumStepTime{0};
+    std::chrono::duration<double> maxStepTime{0};
+    StepStats sums;
+    BodyCounter bodies = 0;
+    JointCounter joints = 0;
+    ContactCounter contacts = 0;
+    ContactCounter touching = 0;
+    BodyCounter awake = 0;
+};
+
+void Add(StepStats& sums, const StepStats& stats)
+{
+    sums.pre.proxiesMoved += stats.pre.proxiesMoved;
+    sums.pre.destroyed += stats.pre.destroyed;
+    sums.pre.added += stats.pre.added;
+    sums.pre.ignored += stats.pre.ignored;
+    sums.pre.updated += stats.pre.updated;
+    sums.pre.skipped += stats.pre.skipped;
+
+    sums.reg.minSeparation = std::min(sums.reg.minSeparation, stats.reg.minSeparation);
+    sums.reg.maxIncImpulse = std::max(sums.reg.maxIncImpulse, stats.reg.maxIncImpulse);
+    sums.reg.islandsFound += stats.reg.islandsFound;
+    sums.reg.islandsSolved += stats.reg.islandsSolved;
+    sums.reg.contactsAdded += stats.reg.contactsAdded;
+    sums.reg.bodiesSlept += stats.reg.bodiesSlept;
+    sums.reg.proxiesMoved += stats.reg.proxiesMoved;
+    sums.reg.sumPosIters += stats.reg.sumPosIters;
+    sums.reg.sumVelIters += stats.reg.sumVelIters;
+
+    sums.toi.minSeparation = std::min(sums.toi.minSeparation, stats.toi.minSeparation);
+    sums.toi.maxIncImpulse = std::max(sums.toi.maxIncImpulse, stats.toi.maxIncImpulse);
+    sums.toi.islandsFound += stats.toi.islandsFound;
+    sums.toi.islandsSolved += stats.toi.islandsSolved;
+    sums.toi.contactsFound += stats.toi.contactsFound;
+    sums.toi.contactsAtMaxSubSteps += stats.toi.contactsAtMaxSubSteps;
+    sums.toi.contactsUpdatedToi += stats.toi.contactsUpdatedToi;
+    sums.toi.contactsUpdatedTouching += stats.toi.contactsUpdatedTouching;
+    sums.toi.contactsSkippedTouching += stats.toi.contactsSkippedTouching;
+    sums.toi.contactsAdded += stats.toi.contactsAdded;
+    sums.toi.proxiesMoved += stats.toi.proxiesMoved;
+    sums.toi.sumPosIters += stats.toi.sumPosIters;
+    sums.toi.sumVelIters += stats.toi.sumVelIters;
+    sums.toi.maxSimulContacts = std::max(sums.toi.maxSimulContacts, stats.toi.maxSimulContacts);
+    sums.toi.maxDistIters = std::max(sums.toi.maxDistIters, stats.toi.maxDistIters);
+    sums.toi.maxToiIters = std::max(sums.toi.maxToiIters, stats.toi.maxToiIters);
+    sums.toi.maxRootIters = std::max(sums.toi.maxRootIters, stats.toi.maxRootIters);
+
+#if defined(PLAYRHO_ENABLE_PROFILING)
+    for (auto i = std::size_t{0}; i < StepPhaseCount; ++i)
+    {
+        sums.times[i].wall += stats.times[i].wall;
+        sums.times[i].cpu += stats.times[i].cpu;
+    }
+#endif
+}
+
+/// @brief Gets the settings the Testbed would step the given test with by default.
+Settings GetSettings(const Test& test)
+{
+    auto settings = Settings{};
+    const auto needed = test.GetNeededSettings();
+    const auto& testSettings = test.GetSettings();
+    if (needed & (0x1u << Test::NeedLinearSlopField))
+    {
+        settings.linearSlop = testSettings.linearSlop;
+    }
+    if (needed & (0x1u << Test::NeedMaxTranslation))
+    {
+        settings.maxTranslation = testSettings.maxTranslation;
+    }
+    if (needed & (0x1u << Test::NeedDeltaTime))
+    {
+        settings.dt = testSettings.dt;
+    }
+    return settings;
+}
+
+SceneResults Run(const TestEntry& entry, unsigned steps)
+{
+    auto drawer = NullDrawer{};
+    auto ui = UiState{};
+    ui.showStats = false;
+    ui.showContactsHistory = false;
+
+    auto results = SceneResults{};
+    results.name = entry.name;
+
+    const auto test = entry.createFcn();
+    const auto settings = GetSettings(*test);
+    for (auto i = 0u; i < steps; ++i)
+    {
+        test->Step(settings, drawer, ui);
+        const auto stepTime = test->GetStepDuration();
+        results.sumStepTime += stepTime;
+        results.maxStepTime = std::max(results.maxStepTime, stepTime);
+        Add(results.sums, test->GetStepStats());
+        ++results.steps;
+    }
+
+    const auto& world = test->m_world;
+    results.bodies = GetBodyCount(world);
+    results.joints = GetJointCount(world);
+    results.contacts = GetContactCount(world);
+    results.touching = GetTouchingCount(world);
+    results.awake = GetAwakeCount(world);
+    return results;
+}
+
+std::string Escape(const std::string& value)
+{
+    auto escaped = std::string{};
+    for (auto c: value)
+    {
+        if ((c == '"') || (c == '\\'))
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+#if defined(PLAYRHO_ENABLE_PROFILING)
+double ToSeconds(std::chrono::nanoseconds value)
+{
+    return std::chrono::duration<double>{value}.count();
+}
+#endif
+
+double ToMeters(Length value)
+{
+    return static_cast<double>(Real{value / Meter});
+}
+
+double ToNewtonSeconds(Momentum value)
+{
+    return static_cast<double>(Real{value / NewtonSecond});
+}
+
+void Write(std::ostream& os, const SceneResults& results)
+{
+    const auto& sums = results.sums;
+    os << "    {\n";
+    os << "      \"name\": \"" << Escape(results.name) << "\",\n";
+    os << "      \"steps\": " << results.steps << ",\n";
+    os << "      \"bodies\": " << results.bodies << ",\n";
+    os << "      \"joints\": " << results.joints << ",\n";
+    os << "      \"contacts\": " << results.contacts << ",\n";
+    os << "      \"touching\": " << results.touching << ",\n";
+    os << "      \"awake\": " << results.awake << ",\n";
+    os << "      \"stepTime\": {";
+    os << "\"sum\": " << results.sumStepTime.count();
+    os << ", \"mean\": " << (results.steps? results.sumStepTime.count() / results.steps: 0.0);
+    os << ", \"max\": " << results.maxStepTime.count();
+    os << "},\n";
+#if defined(PLAYRHO_ENABLE_PROFILING)
+    os << "      \"phases\": {\n";
+    for (auto i = std::size_t{0}; i < StepPhaseCount; ++i)
+    {
+        os << "        \"" << ToString(static_cast<StepPhase>(i)) << "\": {";
+        os << "\"wall\": " << ToSeconds(sums.times[i].wall);
+        os << ", \"cpu\": " << ToSeconds(sums.times[i].cpu);
+        os << ((i + 1 < StepPhaseCount)? "},\n": "}\n");
+    }
+    os << "      },\n";
+#endif
+    os << "      \"pre\": {";
+    os << "\"proxiesMoved\": " << sums.pre.proxiesMoved;
+    os << ", \"destroyed\": " << sums.pre.destroyed;
+    os << ", \"added\": " << sums.pre.added;
+    os << ", \"ignored\": " << sums.pre.ignored;
+    os << ", \"updated\": " << sums.pre.updated;
+    os << ", \"skipped\": " << sums.pre.skipped;
+    os << "},\n";
+    os << "      \"reg\": {";
+    if (sums.reg.minSeparation < std::numeric_limits<Length>::infinity())
+    {
+        os << "\"minSeparation\": " << ToMeters(sums.reg.minSeparation) << ", ";
+    }
+    os << "\"maxIncImpulse\": " << ToNewtonSeconds(sums.reg.maxIncImpulse);
+    os << ", \"islandsFound\": " << sums.reg.islandsFound;
+    os << ", \"islandsSolved\": " << sums.reg.islandsSolved;
+    os << ", \"contactsAdded\": " << sums.reg.contactsAdded;
+    os << ", \"bodiesSlept\": " << sums.reg.bodiesSlept;
+    os << ", \"proxiesMoved\": " << sums.reg.proxiesMoved;
+    os << ", \"sumPosIters\": " << sums.reg.sumPosIters;
+    os << ", \"sumVelIters\": " << sums.reg.sumVelIters;
+    os << "},\n";
+    os << "      \"toi\": {";
+    if (sums.toi.minSeparation < std::numeric_limits<Length>::infinity())
+    {
+        os << "\"minSeparation\": " << ToMeters(sums.toi.minSeparation) << ", ";
+    }
+    os << "\"maxIncImpulse\": " << ToNewtonSeconds(sums.toi.maxIncImpulse);
+    os << ", \"islandsFound\": " << sums.toi.islandsFound;
+    os << ", \"islandsSolved\": " << sums.toi.islandsSolved;
+    os << ", \"contactsFound\": " << sums.toi.contactsFound;
+    os << ", \"contactsAtMaxSubSteps\": " << sums.toi.contactsAtMaxSubSteps;
+    os << ", \"contactsUpdatedToi\": " << sums.toi.contactsUpdatedToi;
+    os << ", \"contactsUpdatedTouching\": " << sums.toi.contactsUpdatedTouching;
+    os << ", \"contactsSkippedTouching\": " << sums.toi.contactsSkippedTouching;
+    os << ", \"contactsAdded\": " << sums.toi.contactsAdded;
+    os << ", \"proxiesMoved\": " << sums.toi.proxiesMoved;
+    os << ", \"sumPosIters\": " << sums.toi.sumPosIters;
+    os << ", \"sumVelIters\": " << sums.toi.sumVelIters;
+    os << ", \"maxSimulContacts\": " << sums.toi.maxSimulContacts;
+    os << ", \"maxDistIters\": " << unsigned{sums.toi.maxDistIters};
+    os << ", \"maxToiIters\": " << unsigned{sums.toi.maxToiIters};
+    os << ", \"maxRootIters\": " << unsigned{sums.toi.maxRootIters};
+    os << "}\n";
+    os << "    }";
+}
+
+const char* GetOption(const char* arg, const char* name)
+{
+    const auto length = std::strlen(name);
+    return (std::strncmp(arg, name, length) == 0)? arg + length: nullptr;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    auto steps = 600u;
+    auto filter = std::string{};
+    auto output = std::string{};
+    auto list = false;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        if (const auto value = GetOption(argv[i], "--steps="))
+        {
+            steps = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+        }
+        else if (const auto value = GetOption(argv[i], "--filter="))
+        {
+            filter = value;
+        }
+        else if (const auto value = GetOption(argv[i], "--output="))
+        {
+            output = value;
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            list = true;
+        }
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--steps=N] [--filter=TEXT] [--output=FILE] [--list]\n",
+                         argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto entries = GetTestEntries();
+    if (list)
+    {
+        for (auto&& entry: entries)
+        {
+            std::printf("%s\n", entry.name);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    auto file = std::ofstream{};
+    if (!empty(output))
+    {
+        file.open(output);
+        if (!file)
+        {
+            std::fprintf(stderr, "Unable to open %s for writing\n", output.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    auto& os = empty(output)? std::cout: file;
+
+    const auto version = GetVersion();
+    os << "{\n";
+    os << "  \"version\": \"" << version.major << '.' << version.minor << '.' << version.revision << "\",\n";
+    os << "  \"build\": \"" << Escape(GetBuildDetails()) << "\",\n";
+    os << "  \"profiling\": " << (IsStepProfilingEnabled()? "true": "false") << ",\n";
+    os << "  \"steps\": " << steps << ",\n";
+    os << "  \"scenes\": [\n";
+    auto first = true;
+    for (auto&& entry: entries)
+    {
+        if (std::string(entry.name).find(filter) == std::string::npos)
+        {
+            continue;
+        }
+        std::fprintf(stderr, "Running %s...\n", entry.name);
+        const auto results = Run(entry, steps);
+        if (!first)
+        {
+            os << ",\n";
+        }
+        Write(os, results);
+        first = false;
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+    return EXIT_SUCCESS;
+}
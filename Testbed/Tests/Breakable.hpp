@@ -99,17 +99,8 @@ public:
         const auto body1 = m_piece1->GetBody();
         const auto center = body1->GetWorldCenter();
 
-        body1->Destroy(m_piece2);
-        m_piece2 = nullptr;
-
-        BodyConf bd;
-        bd.type = BodyType::Dynamic;
-        bd.linearAcceleration = m_gravity;
-        bd.location = body1->GetLocation();
-        bd.angle = body1->GetAngle();
-
-        const auto body2 = m_world.CreateBody(bd);
-        m_piece2 = body2->CreateFixture(m_shape2);
+        Fixture* const pieces[] = {m_piece2};
+        const auto body2 = m_world.Split(*body1, pieces);
 
         // Compute consistent velocities for new bodies based on
         // cached velocity.
@@ -527,3 +527,13 @@ TEST(AABB, ComputeIntersectingAABBForContact)
     
     EXPECT_EQ(contactAabb, intersectingAabb);
 }
+
+TEST(AABB, GetDistanceSquared)
+{
+    const auto aabb = AABB{LengthInterval{-1_m, +1_m}, LengthInterval{-2_m, +2_m}};
+    EXPECT_EQ(GetDistanceSquared(aabb, Length2{0_m, 0_m}), 0_m2);
+    EXPECT_EQ(GetDistanceSquared(aabb, Length2{1_m, 2_m}), 0_m2);
+    EXPECT_EQ(GetDistanceSquared(aabb, Length2{3_m, 0_m}), 4_m2);
+    EXPECT_EQ(GetDistanceSquared(aabb, Length2{0_m, -5_m}), 9_m2);
+    EXPECT_EQ(GetDistanceSquared(aabb, Length2{4_m, 6_m}), 25_m2);
+}
@@ -146,24 +146,24 @@ TEST(Body, ByteSize)
     {
         case  4:
 #if defined(_WIN64)
-            EXPECT_EQ(sizeof(Body), std::size_t(192));
+            EXPECT_EQ(sizeof(Body), std::size_t(200));
 #elif defined(_WIN32)
 #if !defined(NDEBUG)
             // Win32 debug
-            EXPECT_EQ(sizeof(Body), std::size_t(192));
+            EXPECT_EQ(sizeof(Body), std::size_t(200));
 #else
             // Win32 release
-            EXPECT_EQ(sizeof(Body), std::size_t(144));
+            EXPECT_EQ(sizeof(Body), std::size_t(148));
 #endif
 #else
-            EXPECT_EQ(sizeof(Body), std::size_t(192));
+            EXPECT_EQ(sizeof(Body), std::size_t(200));
 #endif
             break;
         case  8:
-            EXPECT_EQ(sizeof(Body), std::size_t(288));
+            EXPECT_EQ(sizeof(Body), std::size_t(296));
             break;
         case 16:
-            EXPECT_EQ(sizeof(Body), std::size_t(496));
+            EXPECT_EQ(sizeof(Body), std::size_t(504));
             break;
         default: FAIL(); break;
     }
@@ -300,6 +300,38 @@ TEST(Body, CreateFixture)
     EXPECT_THROW(body->CreateFixture(Shape{DiskShapeConf{maxRadius + maxRadius / 10}}), InvalidArgument);
 }
 
+TEST(Body, CreateFixtures)
+{
+    const auto shapes = std::vector<Shape>{
+        Shape{DiskShapeConf{}.UseRadius(1_m).UseDensity(1_kgpm2).UseLocation(Length2{-1_m, 0_m})},
+        Shape{DiskShapeConf{}.UseRadius(1_m).UseDensity(1_kgpm2).UseLocation(Length2{+1_m, 0_m})},
+        Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(2_kgpm2).UseLocation(Length2{0_m, 1_m})}
+    };
+    
+    auto world = World{};
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    body->CreateFixtures(Span<const Shape>(shapes.data(), shapes.size()));
+    EXPECT_EQ(GetFixtureCount(*body), size(shapes));
+    EXPECT_FALSE(body->IsMassDataDirty());
+    EXPECT_EQ(size(world.GetFixturesForProxies()), size(shapes));
+    
+    const auto other = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    for (auto&& shape: shapes)
+    {
+        other->CreateFixture(shape);
+    }
+    EXPECT_EQ(GetMass(*body), GetMass(*other));
+    EXPECT_EQ(body->GetLocalCenter(), other->GetLocalCenter());
+    EXPECT_EQ(GetRotInertia(*body), GetRotInertia(*other));
+    
+    const auto unreset = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    unreset->CreateFixtures(Span<const Shape>(shapes.data(), shapes.size()), FixtureConf{}, false);
+    EXPECT_TRUE(unreset->IsMassDataDirty());
+    
+    const auto bad = Shape{DiskShapeConf{world.GetMinVertexRadius() / 2}};
+    EXPECT_THROW(body->CreateFixtures(Span<const Shape>(&bad, 1)), InvalidArgument);
+}
+
 TEST(Body, Destroy)
 {
     auto world = World{};
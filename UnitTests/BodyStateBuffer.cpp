@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include <PlayRho/Dynamics/BodyStateBuffer.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+TEST(BodyStateBuffer, DefaultAcquiresEmptyFrame)
+{
+    auto buffer = BodyStateBuffer{};
+    const auto& frame = buffer.Acquire();
+    EXPECT_EQ(frame.sequence, std::uint64_t(0));
+    EXPECT_TRUE(empty(frame.states));
+}
+
+TEST(BodyStateBuffer, WorldWritesEveryStep)
+{
+    auto buffer = BodyStateBuffer{};
+    auto world = World{WorldConf{}.UseBodyStateBuffer(&buffer)};
+    EXPECT_EQ(world.GetBodyStateBuffer(), &buffer);
+    EXPECT_EQ(World{}.GetBodyStateBuffer(), nullptr);
+    
+    const auto ground = world.CreateBody();
+    const auto ball = world.CreateBody(BodyConf{}
+                                       .UseType(BodyType::Dynamic)
+                                       .UseLocation(Length2{0_m, 10_m})
+                                       .UseLinearAcceleration(EarthlyGravity));
+    ball->CreateFixture(Shape{DiskShapeConf{}.UseRadius(1_m)});
+    
+    auto stepConf = StepConf{};
+    stepConf.SetTime(1_s / 60);
+    world.Step(stepConf);
+    {
+        const auto& frame = buffer.Acquire();
+        EXPECT_EQ(frame.sequence, std::uint64_t(1));
+        EXPECT_EQ(frame.deltaTime, stepConf.GetTime());
+        ASSERT_EQ(size(frame.states), std::size_t(2));
+        EXPECT_EQ(frame.states[0].body, ground);
+        EXPECT_EQ(frame.states[1].body, ball);
+        EXPECT_EQ(frame.states[1].transformation, ball->GetTransformation());
+        EXPECT_EQ(frame.states[1].velocity, ball->GetVelocity());
+        // A body's first state has nothing to interpolate from.
+        EXPECT_EQ(frame.states[1].previous, frame.states[1].position);
+    }
+    
+    const auto before = ball->GetSweep().pos1;
+    world.Step(stepConf);
+    world.Step(stepConf);
+    const auto last = ball->GetSweep().pos1;
+    world.Step(stepConf);
+    {
+        // Frames not acquired are skipped over.
+        const auto& frame = buffer.Acquire();
+        EXPECT_EQ(frame.sequence, std::uint64_t(4));
+        ASSERT_EQ(size(frame.states), std::size_t(2));
+        const auto& state = frame.states[1];
+        EXPECT_EQ(state.previous, last);
+        EXPECT_NE(state.previous, before);
+        EXPECT_EQ(state.position, ball->GetSweep().pos1);
+        EXPECT_EQ(GetTransformation(state, 1).p, ball->GetTransformation().p);
+        EXPECT_LT(get<1>(GetTransformation(state, 0).p), get<1>(before.linear));
+        EXPECT_GT(get<1>(GetTransformation(state, 0).p), get<1>(GetTransformation(state, 1).p));
+    }
+    EXPECT_EQ(buffer.Acquire().sequence, std::uint64_t(4));
+    
+    // States of later bodies still find their previous positions after a body's destroyed.
+    const auto other = world.CreateBody(BodyConf{}
+                                        .UseType(BodyType::Dynamic)
+                                        .UseLocation(Length2{5_m, 10_m})
+                                        .UseLinearAcceleration(EarthlyGravity));
+    world.Step(stepConf);
+    world.Destroy(ground);
+    const auto otherLast = other->GetSweep().pos1;
+    world.Step(stepConf);
+    {
+        const auto& frame = buffer.Acquire();
+        ASSERT_EQ(size(frame.states), std::size_t(2));
+        EXPECT_EQ(frame.states[0].body, ball);
+        EXPECT_EQ(frame.states[1].body, other);
+        EXPECT_EQ(frame.states[1].previous, otherLast);
+    }
+}
+
+TEST(BodyStateBuffer, NotCopiedWithWorld)
+{
+    auto buffer = BodyStateBuffer{};
+    auto world = World{WorldConf{}.UseBodyStateBuffer(&buffer)};
+    world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic).UseLinearAcceleration(EarthlyGravity));
+    world.Step(StepConf{});
+    ASSERT_EQ(buffer.Acquire().sequence, std::uint64_t(1));
+    
+    auto copy = World{world};
+    EXPECT_EQ(copy.GetBodyStateBuffer(), nullptr);
+    copy.Step(StepConf{});
+    EXPECT_EQ(buffer.Acquire().sequence, std::uint64_t(1));
+    
+    auto otherBuffer = BodyStateBuffer{};
+    auto other = World{WorldConf{}.UseBodyStateBuffer(&otherBuffer)};
+    other = world;
+    EXPECT_EQ(other.GetBodyStateBuffer(), nullptr);
+    other.Step(StepConf{});
+    EXPECT_EQ(buffer.Acquire().sequence, std::uint64_t(1));
+    EXPECT_EQ(otherBuffer.Acquire().sequence, std::uint64_t(0));
+    
+    world.Step(StepConf{});
+    EXPECT_EQ(buffer.Acquire().sequence, std::uint64_t(2));
+}
+
+TEST(BodyStateBuffer, AcquiringWhileStepping)
+{
+    auto buffer = BodyStateBuffer{};
+    auto world = World{WorldConf{}.UseBodyStateBuffer(&buffer)};
+    for (auto i = 0; i < 50; ++i)
+    {
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseLocation(Length2{Real(i) * 1_m, 0_m})
+                         .UseLinearAcceleration(EarthlyGravity));
+    }
+    
+    auto done = std::atomic<bool>{false};
+    auto problems = 0;
+    auto reader = std::thread{[&]() {
+        auto sequence = std::uint64_t{0};
+        while (!done)
+        {
+            const auto& frame = buffer.Acquire();
+            if (frame.sequence < sequence)
+            {
+                ++problems;
+            }
+            if ((frame.sequence > 0) && (size(frame.states) != 50u))
+            {
+                ++problems;
+            }
+            // States of a frame are all from the same step.
+            for (auto&& state: frame.states)
+            {
+                if (get<1>(state.position.linear) != get<1>(frame.states[0].position.linear))
+                {
+                    ++problems;
+                }
+            }
+            sequence = frame.sequence;
+        }
+    }};
+    const auto stepConf = StepConf{};
+    for (auto i = 0; i < 500; ++i)
+    {
+        world.Step(stepConf);
+    }
+    done = true;
+    reader.join();
+    EXPECT_EQ(problems, 0);
+    EXPECT_EQ(buffer.Acquire().sequence, std::uint64_t(500));
+}
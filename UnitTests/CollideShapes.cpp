@@ -1669,3 +1669,32 @@ TEST(CollideShapes, R0EdgePerpendicularCrossingFromR0Edge)
     EXPECT_NEAR(static_cast<double>(StripUnit(GetY(manifold.GetLocalPoint()))), 0.0, 0.0001);
     EXPECT_EQ(manifold.GetPointCount(), decltype(manifold.GetPointCount()){1});
 }
+
+TEST(CollideShapes, SpeculativeDistance)
+{
+    const auto disk = DiskShapeConf{}.UseRadius(1_m);
+    const auto diskXfA = Transformation{Length2{0_m, 0_m}, UnitVec::GetRight()};
+    const auto diskXfB = Transformation{Length2{4_m, 0_m}, UnitVec::GetRight()};
+    auto conf = GetDefaultManifoldConf();
+    EXPECT_EQ(conf.speculativeDistance, 0_m);
+    EXPECT_EQ(CollideShapes(GetChild(disk, 0), diskXfA, GetChild(disk, 0), diskXfB, conf)
+              .GetPointCount(), Manifold::size_type(0));
+    conf.speculativeDistance = 2.5_m;
+    const auto circles = CollideShapes(GetChild(disk, 0), diskXfA, GetChild(disk, 0), diskXfB, conf);
+    EXPECT_EQ(circles.GetType(), Manifold::e_circles);
+    EXPECT_EQ(circles.GetPointCount(), Manifold::size_type(1));
+    const auto worldManifold = GetWorldManifold(circles, diskXfA, 1_m, diskXfB, 1_m);
+    ASSERT_EQ(worldManifold.GetPointCount(), WorldManifold::size_type(1));
+    EXPECT_NEAR(static_cast<double>(Real{worldManifold.GetSeparation(0) / Meter}), 2.0, 0.0001);
+
+    const auto box = PolygonShapeConf{}.SetAsBox(1_m, 1_m);
+    const auto boxXfA = Transformation{Length2{0_m, 0_m}, UnitVec::GetRight()};
+    const auto boxXfB = Transformation{Length2{3_m, 0_m}, UnitVec::GetRight()};
+    conf.speculativeDistance = 0_m;
+    EXPECT_EQ(CollideShapes(GetChild(box, 0), boxXfA, GetChild(box, 0), boxXfB, conf)
+              .GetPointCount(), Manifold::size_type(0));
+    conf.speculativeDistance = 1.5_m;
+    const auto faces = CollideShapes(GetChild(box, 0), boxXfA, GetChild(box, 0), boxXfB, conf);
+    EXPECT_EQ(faces.GetType(), Manifold::e_faceA);
+    EXPECT_EQ(faces.GetPointCount(), Manifold::size_type(2));
+}
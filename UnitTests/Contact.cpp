@@ -25,6 +25,7 @@
 #include <PlayRho/Dynamics/World.hpp>
 #include <PlayRho/Dynamics/BodyConf.hpp>
 #include <PlayRho/Dynamics/FixtureConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
 
 using namespace playrho;
@@ -125,3 +126,52 @@ TEST(Contact, ResetRestitution)
     ResetRestitution(c);
     EXPECT_EQ(c.GetRestitution(), GetRestitution(shape));
 }
+
+TEST(Contact, CoherentManifoldReuse)
+{
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(1_m)};
+    auto world = World{};
+    const auto bA = world.CreateBody(BodyConf{}.UseType(BodyType::Static));
+    const auto bB = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    bA->CreateFixture(shape);
+    bB->CreateFixture(shape);
+
+    auto stepConf = StepConf{};
+    stepConf.linearCoherenceTolerance = stepConf.linearSlop / Real(4);
+    stepConf.angularCoherenceTolerance = 1_deg;
+    const auto tolerance = Length{stepConf.linearCoherenceTolerance};
+
+    bB->SetTransform(Length2{2_m - tolerance / Real(4), 0_m}, 0_deg);
+    world.Step(stepConf);
+    ASSERT_EQ(GetContactCount(world), ContactCounter(1));
+    const auto& contact = GetRef(std::get<Contact*>(*begin(world.GetContacts())));
+    ASSERT_TRUE(contact.IsTouching());
+    const auto manifold = contact.GetManifold();
+
+    // Moved apart but by less than the tolerance: manifold gets reused.
+    bB->SetTransform(Length2{2_m + tolerance / Real(2), 0_m}, 0_deg);
+    world.Step(stepConf);
+    EXPECT_TRUE(contact.IsTouching());
+    EXPECT_EQ(contact.GetManifold().GetPointCount(), manifold.GetPointCount());
+
+    // Coherence disabled: the separated disks aren't touching.
+    auto copy = World{world};
+    auto defaultConf = StepConf{};
+    const auto copyB = *std::next(begin(copy.GetBodies()));
+    copyB->SetTransform(Length2{2_m + tolerance * Real(5) / Real(8), 0_m}, 0_deg);
+    copy.Step(defaultConf);
+    EXPECT_FALSE(GetRef(std::get<Contact*>(*begin(copy.GetContacts()))).IsTouching());
+
+    // Moved apart by more than the tolerance: manifold gets recalculated.
+    bB->SetTransform(Length2{2_m + tolerance * Real(2), 0_m}, 0_deg);
+    world.Step(stepConf);
+    EXPECT_FALSE(contact.IsTouching());
+
+    // Rotated by more than the angular tolerance: manifold gets recalculated.
+    bB->SetTransform(Length2{2_m - tolerance / Real(4), 0_m}, 0_deg);
+    world.Step(stepConf);
+    ASSERT_TRUE(contact.IsTouching());
+    bB->SetTransform(Length2{2_m + tolerance / Real(2), 0_m}, 2_deg);
+    world.Step(stepConf);
+    EXPECT_FALSE(contact.IsTouching());
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include "WorldTestUtils.hpp"
+#include <PlayRho/Dynamics/ContactEventBuffer.hpp>
+#include <PlayRho/Common/TaskScheduler.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Dynamics/WorldCallbacks.hpp>
+#include <PlayRho/Dynamics/Contacts/Contact.hpp>
+#include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+namespace {
+
+using FixturePair = std::pair<const Fixture*, const Fixture*>;
+
+class RecordingListener: public ContactListener
+{
+public:
+    void BeginContact(Contact& contact) override
+    {
+        begins.emplace_back(contact.GetFixtureA(), contact.GetFixtureB());
+    }
+    
+    void EndContact(Contact& contact) override
+    {
+        ends.emplace_back(contact.GetFixtureA(), contact.GetFixtureB());
+    }
+    
+    void PreSolve(Contact&, const Manifold&) override {}
+    
+    void PostSolve(Contact& contact, const ContactImpulsesList& impulses,
+                   iteration_type) override
+    {
+        postSolves.emplace_back(contact.GetFixtureA(), contact.GetFixtureB());
+        maxImpulses.push_back(GetMaxNormalImpulse(impulses));
+    }
+    
+    std::vector<FixturePair> begins;
+    std::vector<FixturePair> ends;
+    std::vector<FixturePair> postSolves;
+    std::vector<Momentum> maxImpulses;
+};
+
+std::vector<FixturePair> GetPairs(Span<const ContactEvent> events)
+{
+    auto pairs = std::vector<FixturePair>{};
+    for (auto&& event: events)
+    {
+        pairs.emplace_back(event.fixtureA, event.fixtureB);
+    }
+    return pairs;
+}
+
+std::vector<std::pair<BodyCounter, BodyCounter>> GetBodyIndices(Span<const ContactEvent> events)
+{
+    auto indices = std::vector<std::pair<BodyCounter, BodyCounter>>{};
+    for (auto&& event: events)
+    {
+        indices.emplace_back(GetWorldIndex(event.fixtureA->GetBody()),
+                             GetWorldIndex(event.fixtureB->GetBody()));
+    }
+    return indices;
+}
+
+} // anonymous namespace
+
+TEST(ContactEventBuffer, DefaultConstruction)
+{
+    const auto buffer = ContactEventBuffer{};
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_TRUE(empty(buffer.GetBeginEvents()));
+    EXPECT_TRUE(empty(buffer.GetEndEvents()));
+    EXPECT_TRUE(empty(buffer.GetImpulsesEvents()));
+    EXPECT_EQ(World{}.GetContactEventBuffer(), nullptr);
+}
+
+TEST(ContactEventBuffer, MatchesListenerCalls)
+{
+    auto listener = RecordingListener{};
+    auto buffer = ContactEventBuffer{};
+    auto world = World{};
+    world.SetContactListener(&listener);
+    world.SetContactEventBuffer(&buffer);
+    EXPECT_EQ(world.GetContactEventBuffer(), &buffer);
+    AddStacks(world, 4, 3);
+    
+    const auto stepConf = StepConf{};
+    auto begins = std::size_t{0};
+    for (auto i = 0; i < 120; ++i)
+    {
+        world.Step(stepConf);
+        EXPECT_EQ(GetPairs(buffer.GetBeginEvents()), listener.begins);
+        EXPECT_EQ(GetPairs(buffer.GetEndEvents()), listener.ends);
+        ASSERT_EQ(size(buffer.GetImpulsesEvents()), size(listener.postSolves));
+        auto j = std::size_t{0};
+        for (auto&& event: buffer.GetImpulsesEvents())
+        {
+            EXPECT_EQ(FixturePair(event.contact.fixtureA, event.contact.fixtureB),
+                      listener.postSolves[j]);
+            EXPECT_EQ(GetMaxNormalImpulse(event.impulses), listener.maxImpulses[j]);
+            ++j;
+        }
+        begins += size(buffer.GetBeginEvents());
+        buffer.Clear();
+        listener = RecordingListener{};
+        EXPECT_TRUE(buffer.IsEmpty());
+    }
+    EXPECT_GE(begins, std::size_t(12));
+    
+    // Destroying a body ends its touching contacts.
+    const auto body = *std::prev(end(world.GetBodies()));
+    const auto touching = std::count_if(begin(body->GetContacts()), end(body->GetContacts()),
+                                        [](const KeyedContactPtr& kc) {
+        return std::get<Contact*>(kc)->IsTouching();
+    });
+    ASSERT_GT(touching, 0);
+    world.Destroy(body);
+    EXPECT_EQ(size(buffer.GetEndEvents()), static_cast<std::size_t>(touching));
+    EXPECT_EQ(GetPairs(buffer.GetEndEvents()), listener.ends);
+}
+
+TEST(ContactEventBuffer, OrderSameAcrossWorkerCounts)
+{
+    auto scheduler1 = WorkStealingScheduler{1};
+    auto scheduler3 = WorkStealingScheduler{3};
+    auto serialBuffer = ContactEventBuffer{};
+    auto parallelBuffer = ContactEventBuffer{};
+    auto serial = World{WorldConf{}.UseTaskScheduler(&scheduler1).UseDeterministic(true)};
+    auto parallel = World{WorldConf{}.UseTaskScheduler(&scheduler3).UseDeterministic(true)};
+    serial.SetContactEventBuffer(&serialBuffer);
+    parallel.SetContactEventBuffer(&parallelBuffer);
+    AddStacks(serial, 20, 4);
+    AddStacks(parallel, 20, 4);
+    
+    const auto stepConf = StepConf{};
+    for (auto i = 0; i < 60; ++i)
+    {
+        serial.Step(stepConf);
+        parallel.Step(stepConf);
+        EXPECT_EQ(GetBodyIndices(parallelBuffer.GetBeginEvents()),
+                  GetBodyIndices(serialBuffer.GetBeginEvents()));
+        EXPECT_EQ(GetBodyIndices(parallelBuffer.GetEndEvents()),
+                  GetBodyIndices(serialBuffer.GetEndEvents()));
+        ASSERT_EQ(size(parallelBuffer.GetImpulsesEvents()), size(serialBuffer.GetImpulsesEvents()));
+        serialBuffer.Clear();
+        parallelBuffer.Clear();
+    }
+}
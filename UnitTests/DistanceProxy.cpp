@@ -19,7 +19,9 @@
 #include "UnitTests.hpp"
 #include <PlayRho/Collision/DistanceProxy.hpp>
 #include <PlayRho/Collision/ShapeSeparation.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
 #include <initializer_list>
+#include <memory>
 #include <vector>
 
 using namespace playrho;
@@ -30,18 +32,18 @@ TEST(DistanceProxy, ByteSize)
     if (sizeof(Real) == 4)
     {
 #if defined(_WIN32) && !defined(_WIN64)
-        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(16));
+        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(48));
 #else
-        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(24));
+        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(56));
 #endif
     }
     else if (sizeof(Real) == 8)
     {
-        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(32));
+        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(96));
     }
     else if (sizeof(Real) == 16)
     {
-        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(48));
+        EXPECT_EQ(sizeof(DistanceProxy), std::size_t(176));
     }
     else
     {
@@ -110,6 +112,35 @@ TEST(DistanceProxy, TwoVecSupportIndex)
     EXPECT_EQ(1, GetSupportIndex(foo, GetVec2(Length2{GetY(vertex1), GetX(vertex1)})));
 }
 
+TEST(DistanceProxy, SegmentInitialization)
+{
+    const auto radius = 1_m;
+    const auto vertex0 = Length2{2_m, 3_m};
+    const auto vertex1 = Length2{-10_m, -1_m};
+    const Length2 vertices[] = {vertex0, vertex1};
+    const auto normal0 = GetUnitVector(GetFwdPerpendicular(vertex1 - vertex0));
+    const UnitVec normals[] = {normal0, -normal0};
+    
+    auto foo = std::make_unique<DistanceProxy>(radius, vertex0, vertex1);
+    EXPECT_EQ(*foo, (DistanceProxy{radius, 2, vertices, normals}));
+    
+    // Copies must refer to their own vertices and normals, not to those of the original.
+    const auto copy = *foo;
+    auto assigned = DistanceProxy{};
+    assigned = *foo;
+    foo.reset();
+    for (const auto& proxy: {copy, assigned})
+    {
+        EXPECT_EQ(radius, GetVertexRadius(proxy));
+        ASSERT_EQ(2, proxy.GetVertexCount());
+        EXPECT_EQ(vertex0, proxy.GetVertex(0));
+        EXPECT_EQ(vertex1, proxy.GetVertex(1));
+        EXPECT_EQ(normal0, proxy.GetNormal(0));
+        EXPECT_EQ(-normal0, proxy.GetNormal(1));
+        EXPECT_EQ(proxy, (DistanceProxy{radius, 2, vertices, normals}));
+    }
+}
+
 TEST(DistanceProxy, ThreeVertices)
 {
     const auto radius = 33_m;
@@ -203,6 +234,63 @@ TEST(DistanceProxy, GetMaxSeparationStopping)
     EXPECT_NE(resultRegular.distance, resultStopped.distance);
 }
 
+TEST(DistanceProxy, GetMaxSeparationNxMSameAs4x4)
+{
+    const auto box = PolygonShapeConf{2_m, 2_m};
+    const auto dp = GetChild(box, 0);
+    for (auto i = 0; i < 36; ++i)
+    {
+        const auto xfm1 = Transformation{Length2{-1_m, 0_m}, UnitVec::Get(Real(i * 10) * Degree)};
+        const auto xfm2 = Transformation{Length2{+0.5_m, Real(i % 5) * 0.25_m},
+            UnitVec::Get(Real(i * 7) * Degree)};
+        const auto expected = GetMaxSeparation4x4(dp, xfm1, dp, xfm2);
+        const auto result = GetMaxSeparationNxM(dp, xfm1, dp, xfm2);
+        EXPECT_EQ(result.distance, expected.distance);
+        EXPECT_EQ(result.firstShape, expected.firstShape);
+        EXPECT_EQ(result.secondShape, expected.secondShape);
+    }
+}
+
+TEST(DistanceProxy, GetMaxSeparationNxMForMixedCounts)
+{
+    const auto makeRegular = [](VertexCounter count) {
+        auto vertices = VertexSet{};
+        for (auto i = VertexCounter{0}; i < count; ++i)
+        {
+            const auto angle = Real(i) * 360_deg / Real(count);
+            vertices.add(Length2{cos(angle) * 1_m, sin(angle) * 1_m});
+        }
+        return PolygonShapeConf{}.Set(vertices);
+    };
+    const auto shapes = std::vector<PolygonShapeConf>{
+        makeRegular(3), makeRegular(5), makeRegular(6), makeRegular(8), makeRegular(13)
+    };
+    for (const auto& shape1: shapes)
+    {
+        for (const auto& shape2: shapes)
+        {
+            const auto dp1 = GetChild(shape1, 0);
+            const auto dp2 = GetChild(shape2, 0);
+            for (auto i = 0; i < 12; ++i)
+            {
+                const auto xfm1 = Transformation{Length2{}, UnitVec::Get(Real(i * 31) * Degree)};
+                const auto xfm2 = Transformation{Length2{Real(i - 6) * 0.4_m, 0.5_m},
+                    UnitVec::Get(Real(i * 17) * Degree)};
+                const auto expected = GetMaxSeparation(dp1, xfm1, dp2, xfm2);
+                const auto result = GetMaxSeparationNxM(dp1, xfm1, dp2, xfm2);
+                EXPECT_NEAR(static_cast<double>(Real(result.distance / Meter)),
+                            static_cast<double>(Real(expected.distance / Meter)), 0.0001);
+                EXPECT_EQ(result.firstShape, expected.firstShape);
+                EXPECT_EQ(std::get<0>(result.secondShape), std::get<0>(expected.secondShape));
+                
+                const auto stopped = GetMaxSeparationNxM(dp1, xfm1, dp2, xfm2, 0_m);
+                const auto expectedStopped = GetMaxSeparation(dp1, xfm1, dp2, xfm2, 0_m);
+                EXPECT_EQ(stopped.firstShape, expectedStopped.firstShape);
+            }
+        }
+    }
+}
+
 TEST(DistanceProxy, GetMaxSeparationFromWorld)
 {
     const auto pos1 = Length2{3_m, 1_m};
@@ -44,12 +44,12 @@ TEST(DynamicTree, TreeNodeByteSize)
     {
         case  4:
 #if defined(_WIN32) && !defined(_WIN64)
-            EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(36));
+            EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(44));
 #else
-            EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(48));
+            EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(56));
 #endif
             break;
-        case  8: EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(64)); break;
+        case  8: EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(72)); break;
         case 16: EXPECT_EQ(sizeof(DynamicTree::TreeNode), std::size_t(112)); break;
     }
 }
@@ -196,6 +196,30 @@ TEST(DynamicTreeLeafData, Traits)
     EXPECT_TRUE(std::is_trivially_destructible<DynamicTree::LeafData>::value);
 }
 
+TEST(DynamicTreeLeafData, FilterFields)
+{
+    const auto data = DynamicTree::LeafData{nullptr, nullptr, 0u};
+    EXPECT_EQ(data.categoryBits, 0u);
+    EXPECT_EQ(data.maskBits, 0u);
+    EXPECT_EQ(data.groupIndex, 0);
+    
+    const auto filtered = DynamicTree::LeafData{nullptr, nullptr, 0u, 0x0004, 0x00F0, -3};
+    EXPECT_EQ(filtered.categoryBits, 0x0004u);
+    EXPECT_EQ(filtered.maskBits, 0x00F0u);
+    EXPECT_EQ(filtered.groupIndex, -3);
+}
+
+TEST(DynamicTreeLeafData, Equality)
+{
+    const auto data = DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0004, 0x00F0, -3};
+    EXPECT_TRUE(data == (DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0004, 0x00F0, -3}));
+    EXPECT_FALSE(data != (DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0004, 0x00F0, -3}));
+    EXPECT_NE(data, (DynamicTree::LeafData{nullptr, nullptr, 2u, 0x0004, 0x00F0, -3}));
+    EXPECT_NE(data, (DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0002, 0x00F0, -3}));
+    EXPECT_NE(data, (DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0004, 0x00F1, -3}));
+    EXPECT_NE(data, (DynamicTree::LeafData{nullptr, nullptr, 1u, 0x0004, 0x00F0, 0}));
+}
+
 TEST(DynamicTreeVariantData, Traits)
 {
     EXPECT_TRUE(std::is_default_constructible<DynamicTree::VariantData>::value);
@@ -1018,3 +1042,49 @@ TEST(DynamicTree, QueryFF)
     });
     EXPECT_EQ(ncalls, 2);
 }
+
+TEST(DynamicTree, FindNearest)
+{
+    auto foo = DynamicTree{};
+    auto location = Length2{};
+    const auto aabbDistance = [&](DynamicTree::Size leaf) {
+        return GetDistanceSquared(foo.GetAABB(leaf), location);
+    };
+    EXPECT_TRUE(empty(FindNearest(foo, Length2{}, 3, aabbDistance)));
+
+    auto leaves = std::vector<DynamicTree::Size>{};
+    for (auto i = 0; i < 10; ++i)
+    {
+        const auto x = Real(i * 2) * 1_m;
+        leaves.push_back(foo.CreateLeaf(AABB{LengthInterval{x, x + 1_m}, LengthInterval{0_m, 1_m}},
+                                        DynamicTree::LeafData{nullptr, nullptr, 0}));
+    }
+
+    EXPECT_TRUE(empty(FindNearest(foo, Length2{}, 0, aabbDistance)));
+
+    location = Length2{9_m, 0.5_m};
+    const auto nearest = FindNearest(foo, location, 3, aabbDistance);
+    ASSERT_EQ(size(nearest), std::size_t(3));
+    EXPECT_EQ(nearest[0].leaf, leaves[4]);
+    EXPECT_EQ(nearest[0].distanceSquared, 0_m2);
+    EXPECT_EQ(nearest[1].leaf, leaves[5]);
+    EXPECT_EQ(nearest[1].distanceSquared, 1_m2);
+    EXPECT_EQ(nearest[2].leaf, leaves[3]);
+    EXPECT_EQ(nearest[2].distanceSquared, 4_m2);
+
+    location = Length2{-1_m, 0.5_m};
+    const auto within = FindNearest(foo, location, 100, aabbDistance, 16_m2);
+    ASSERT_EQ(size(within), std::size_t(2));
+    EXPECT_EQ(within[0].leaf, leaves[0]);
+    EXPECT_EQ(within[0].distanceSquared, 1_m2);
+    EXPECT_EQ(within[1].leaf, leaves[1]);
+    EXPECT_EQ(within[1].distanceSquared, 9_m2);
+
+    location = Length2{};
+    const auto all = FindNearest(foo, location, 100, aabbDistance);
+    EXPECT_EQ(size(all), size(leaves));
+    EXPECT_TRUE(std::is_sorted(begin(all), end(all), [](const DynamicTreeLeafDistance& a,
+                                                         const DynamicTreeLeafDistance& b) {
+        return a.distanceSquared < b.distanceSquared;
+    }));
+}
@@ -400,7 +400,7 @@ TEST(Fixed32, log)
     EXPECT_NEAR(static_cast<double>(log(Fixed32(2.1))), 0.74193734472937733, 0.0096);
 
     ASSERT_NEAR(static_cast<double>(log(2.75)), 1.0116009116784799, 0.01);
-    EXPECT_NEAR(static_cast<double>(log(Fixed32(2.75))), 0.994140625, 0.0001);
+    EXPECT_NEAR(static_cast<double>(log(Fixed32(2.75))), 1.01171875, 0.0001);
 
     ASSERT_NEAR(static_cast<double>(log(4.5)), 1.5040773967762742, 0.01);
     EXPECT_NEAR(static_cast<double>(log(Fixed32(4.5))), 1.5040773967762742, 0.028);
@@ -429,36 +429,36 @@ TEST(Fixed32, exp)
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(2.5))), exp(2.5), 0.04);
 
     ASSERT_NEAR(static_cast<double>(exp(3.15)), 23.336064580942711, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(3.15))), 23.23828125, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(3.15))), 23.30078125, 0.01);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(3.15))), exp(3.15), 0.1);
 
     ASSERT_NEAR(static_cast<double>(exp(4.8)), 121.51041751873485, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(4.8))), 121.19140625, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(4.8))), 121.3671875, 0.01);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(4.8))), exp(4.8), 0.4);
     
     ASSERT_NEAR(static_cast<double>(exp(7.1)), 1211.9670744925763, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(7.1))), 1210.525390625, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(7.1))), 1211.4921875, 0.01);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(7.1))), exp(7.1), 1.6);
 
     ASSERT_NEAR(static_cast<double>(exp(8.9)), 7331.9735391559952, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(8.9))), 7318.447265625, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(8.9))), 7320.52734375, 0.01);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(8.9))), exp(8.9), 13.55);
 
     ASSERT_NEAR(static_cast<double>(exp(10.1)), 24343.009424408381, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(10.1))), 24322.119140625, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(10.1))), 24334.109375, 0.01);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(10.1))), exp(10.1), 22.0);
 
     ASSERT_NEAR(static_cast<double>(exp(12.5)), 268337.28652087448, 0.2);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(12.5))), 267662.830078125, 0.01);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(12.5))), 268337.287109375, 0.01);
     
     ASSERT_NEAR(static_cast<double>(exp(-1.0)), 0.36787944117144233, 0.0001);
     EXPECT_NEAR(static_cast<double>(exp(Fixed32(-1))), 0.36787944117144233, 0.001);
     
     ASSERT_NEAR(static_cast<double>(exp(-2.0)), 0.1353352832366127, 0.0001);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(-2))), 0.13671875, 0.001);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(-2))), 0.134765625, 0.001);
 
     ASSERT_NEAR(static_cast<double>(exp(-4.0)), 0.018315638888734179, 0.0001);
-    EXPECT_NEAR(static_cast<double>(exp(Fixed32(-4))), 0.021484375, 0.001);
+    EXPECT_NEAR(static_cast<double>(exp(Fixed32(-4))), 0.017578125, 0.001);
 }
 
 TEST(Fixed32, intpow)
@@ -547,7 +547,7 @@ TEST(Fixed32, sqrt)
     EXPECT_TRUE(isnan(sqrt(Fixed32::GetNaN())));
     EXPECT_EQ(sqrt(Fixed32{0}), Fixed32{0});
     EXPECT_EQ(sqrt(Fixed32::GetInfinity()), Fixed32::GetInfinity());
-    EXPECT_EQ(sqrt(Fixed32::GetMin()), Fixed32(0.046875));
+    EXPECT_EQ(sqrt(Fixed32::GetMin()), Fixed32(0.044921875));
     EXPECT_EQ(Square(sqrt(Fixed32::GetMin())), Fixed32::GetMin());
     EXPECT_EQ(sqrt(Fixed32{1}), Fixed32{1});
     EXPECT_NEAR(static_cast<double>(sqrt(Fixed32{0.25})), 0.5, 0.0);
@@ -732,6 +732,77 @@ TEST(Fixed32, atan2_angles)
     }
 }
 
+TEST(Fixed32, TranscendentalsWithinOneUlp)
+{
+    const auto ulp = static_cast<double>(Fixed32::GetMin());
+    for (auto v = -12.0; v < +12.0; v += 0.01)
+    {
+        const auto f = Fixed32(v);
+        const auto d = static_cast<double>(f);
+        EXPECT_NEAR(static_cast<double>(sin(f)), std::sin(d), ulp);
+        EXPECT_NEAR(static_cast<double>(cos(f)), std::cos(d), ulp);
+        EXPECT_NEAR(static_cast<double>(atan(f)), std::atan(d), ulp);
+        if (d > 0)
+        {
+            EXPECT_NEAR(static_cast<double>(log(f)), std::log(d), ulp);
+            EXPECT_NEAR(static_cast<double>(sqrt(f)), std::sqrt(d), ulp);
+        }
+        EXPECT_NEAR(static_cast<double>(exp(f)), std::exp(d), std::max(ulp, std::exp(d) * ulp));
+    }
+    EXPECT_TRUE(isnan(sin(Fixed32::GetInfinity())));
+    EXPECT_TRUE(isnan(cos(Fixed32::GetNaN())));
+    EXPECT_EQ(exp(Fixed32(+100)), Fixed32::GetInfinity());
+    EXPECT_EQ(exp(Fixed32(-100)), Fixed32(0));
+}
+
+#ifdef PLAYRHO_INT128
+TEST(Fixed64, TranscendentalsWithinOneUlp)
+{
+    const auto ulp = static_cast<double>(Fixed64::GetMin());
+    for (auto v = -20.0; v < +20.0; v += 0.01)
+    {
+        const auto f = Fixed64(v);
+        const auto d = static_cast<double>(f);
+        EXPECT_NEAR(static_cast<double>(sin(f)), std::sin(d), ulp);
+        EXPECT_NEAR(static_cast<double>(cos(f)), std::cos(d), ulp);
+        EXPECT_NEAR(static_cast<double>(atan(f)), std::atan(d), ulp);
+        if (d > 0)
+        {
+            EXPECT_NEAR(static_cast<double>(log(f)), std::log(d), ulp);
+            EXPECT_NEAR(static_cast<double>(sqrt(f)), std::sqrt(d), ulp);
+        }
+        EXPECT_NEAR(static_cast<double>(exp(f)), std::exp(d), std::max(ulp, std::exp(d) * ulp));
+    }
+}
+
+TEST(Fixed64, atan2_angles)
+{
+    constexpr const auto pi = double{3.14159265358979323846264338327950288};
+    const auto ulp = static_cast<double>(Fixed64::GetMin());
+    for (auto angleInDegs = -179; angleInDegs <= +180; ++angleInDegs)
+    {
+        const auto angle = angleInDegs * pi / 180;
+        const auto y = Fixed64(1000 * std::sin(angle));
+        const auto x = Fixed64(1000 * std::cos(angle));
+        EXPECT_NEAR(static_cast<double>(atan2(y, x)),
+                    std::atan2(static_cast<double>(y), static_cast<double>(x)), ulp);
+    }
+    EXPECT_TRUE(isnan(atan2(Fixed64(0), Fixed64(0))));
+}
+
+TEST(Fixed64, TranscendentalsAreBitExact)
+{
+    // These results are computed with integer arithmetic only so they must be the
+    // same on every platform.
+    EXPECT_EQ(sin(Fixed64(1)).GetBits(), Fixed64::value_type{14117540});
+    EXPECT_EQ(cos(Fixed64(1)).GetBits(), Fixed64::value_type{9064769});
+    EXPECT_EQ(atan2(Fixed64(3), Fixed64(-4)).GetBits(), Fixed64::value_type{41911021});
+    EXPECT_EQ(exp(Fixed64(2.5)).GetBits(), Fixed64::value_type{204388333});
+    EXPECT_EQ(log(Fixed64(10)).GetBits(), Fixed64::value_type{38630967});
+    EXPECT_EQ(sqrt(Fixed64(2)).GetBits(), Fixed64::value_type{23726566});
+}
+#endif
+
 TEST(Fixed32, Max)
 {
     const auto max_internal_val = std::numeric_limits<int32_t>::max() - 1;
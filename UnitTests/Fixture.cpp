@@ -21,6 +21,7 @@
 #include <PlayRho/Dynamics/Body.hpp>
 #include <PlayRho/Dynamics/World.hpp>
 #include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Dynamics/Contacts/ContactKey.hpp>
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
 
@@ -33,13 +34,13 @@ TEST(Fixture, ByteSize)
     {
         case  4:
 #if defined(_WIN32) && !defined(_WIN64)
-            EXPECT_EQ(sizeof(Fixture), std::size_t(36));
+            EXPECT_EQ(sizeof(Fixture), std::size_t(40));
 #else
-            EXPECT_EQ(sizeof(Fixture), std::size_t(56));
+            EXPECT_EQ(sizeof(Fixture), std::size_t(64));
 #endif
             break;
-        case  8: EXPECT_EQ(sizeof(Fixture), std::size_t(56)); break;
-        case 16: EXPECT_EQ(sizeof(Fixture), std::size_t(56)); break;
+        case  8: EXPECT_EQ(sizeof(Fixture), std::size_t(64)); break;
+        case 16: EXPECT_EQ(sizeof(Fixture), std::size_t(64)); break;
         default: FAIL(); break;
     }
 }
@@ -73,6 +74,37 @@ TEST(Fixture, CreateMatchesConf)
     EXPECT_EQ(fixture->GetProxyCount(), ChildCounter{0});
 }
 
+TEST(Fixture, SingleProxy)
+{
+    const auto shape = Shape{
+        ChainShapeConf{}.Add(Length2{-2_m, -3_m}).Add(Length2{-2_m, 0_m}).Add(Length2{0_m, 0_m})
+        .Add(Length2{0_m, +2_m}).Add(Length2{2_m, 2_m})
+    };
+    
+    auto world = World{};
+    const auto body = world.CreateBody();
+    const auto fixture = body->CreateFixture(shape, FixtureConf{}.UseSingleProxy(true));
+    EXPECT_TRUE(fixture->IsSingleProxy());
+    EXPECT_TRUE(GetFixtureConf(*fixture).singleProxy);
+    EXPECT_EQ(fixture->GetChildTree(), nullptr);
+    
+    world.Step(StepConf{});
+    EXPECT_EQ(fixture->GetProxyCount(), ChildCounter{1});
+    ASSERT_NE(fixture->GetChildTree(), nullptr);
+    EXPECT_EQ(fixture->GetChildTree()->GetLeafCount(), DynamicTree::Size(4));
+    EXPECT_EQ(GetContactKey(*fixture, 3, *fixture, 2), GetContactKey(*fixture, 0, *fixture, 0));
+    
+    // Single child shapes just get their usual proxy.
+    const auto disk = body->CreateFixture(Shape{DiskShapeConf{}},
+                                          FixtureConf{}.UseSingleProxy(true));
+    world.Step(StepConf{});
+    EXPECT_EQ(disk->GetProxyCount(), ChildCounter{1});
+    EXPECT_EQ(disk->GetChildTree(), nullptr);
+    
+    body->Destroy(fixture);
+    EXPECT_EQ(world.GetTree().GetLeafCount(), DynamicTree::Size(1));
+}
+
 TEST(Fixture, SetSensor)
 {
     const auto shapeA = Shape{DiskShapeConf{}};
@@ -101,6 +133,20 @@ TEST(Fixture, TestPointFreeFunction)
     EXPECT_FALSE(TestPoint(*fixture, Length2{}));
 }
 
+TEST(Fixture, LeafDataFilterFreeFunctions)
+{
+    auto data = DynamicTree::LeafData{nullptr, nullptr, 0u};
+    EXPECT_EQ(GetFilter(data), (Filter{0u, 0u, 0}));
+    
+    auto filter = Filter{};
+    filter.categoryBits = 0x0004;
+    filter.maskBits = 0x00F0;
+    filter.groupIndex = -3;
+    SetFilter(data, filter);
+    EXPECT_EQ(GetFilter(data), filter);
+    EXPECT_EQ(data, (DynamicTree::LeafData{nullptr, nullptr, 0u, 0x0004, 0x00F0, -3}));
+}
+
 TEST(Fixture, SetAwakeFreeFunction)
 {
     const auto shapeA = Shape{DiskShapeConf{}};
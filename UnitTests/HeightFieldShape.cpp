@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include "UnitTests.hpp"
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/Shape.hpp>
+#include <typeinfo>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+TEST(HeightFieldShapeConf, DefaultConstruction)
+{
+    const auto foo = HeightFieldShapeConf{};
+    EXPECT_EQ(GetChildCount(foo), ChildCounter{0});
+    EXPECT_EQ(foo.GetHeightCount(), ChildCounter{0});
+    EXPECT_EQ(GetMassData(foo), MassData{});
+    EXPECT_EQ(GetVertexRadius(foo), HeightFieldShapeConf::GetDefaultVertexRadius());
+    EXPECT_EQ(foo.GetCellWidth(), HeightFieldShapeConf::GetDefaultCellWidth());
+    EXPECT_THROW(GetChild(foo, 0), InvalidArgument);
+    EXPECT_EQ(GetChildRange(foo, AABB{Length2{}, Length2{1_m, 1_m}}),
+              std::make_pair(ChildCounter{0}, ChildCounter{0}));
+}
+
+TEST(HeightFieldShapeConf, ChildrenLikeChain)
+{
+    const auto heights = std::vector<Length>{1_m, 2_m, 0_m, -1_m};
+    const auto conf = HeightFieldShapeConf{}.Set(2_m, heights);
+    ASSERT_EQ(GetChildCount(conf), ChildCounter{3});
+    EXPECT_EQ(conf.GetMinHeight(), -1_m);
+    EXPECT_EQ(conf.GetMaxHeight(), 2_m);
+    EXPECT_EQ(conf.GetHeight(1), 2_m);
+    EXPECT_EQ(conf.GetVertex(3), (Length2{6_m, -1_m}));
+    
+    const auto chain = ChainShapeConf{}.Set(std::vector<Length2>{
+        Length2{0_m, 1_m}, Length2{2_m, 2_m}, Length2{4_m, 0_m}, Length2{6_m, -1_m}
+    });
+    for (auto i = ChildCounter{0}; i < GetChildCount(conf); ++i)
+    {
+        EXPECT_EQ(GetChild(conf, i), GetChild(chain, i));
+    }
+    EXPECT_THROW(GetChild(conf, 3), InvalidArgument);
+    
+    const auto shape = Shape{conf};
+    EXPECT_EQ(GetUseTypeInfo(shape), typeid(HeightFieldShapeConf));
+    ASSERT_NE(GetHeightFieldShapeConf(shape), nullptr);
+    EXPECT_EQ(*GetHeightFieldShapeConf(shape), conf);
+    EXPECT_EQ(GetHeightFieldShapeConf(Shape{chain}), nullptr);
+}
+
+TEST(HeightFieldShapeConf, GetChildRange)
+{
+    const auto conf = HeightFieldShapeConf{}
+        .UseVertexRadius(0_m)
+        .Set(1_m, std::vector<Length>{0_m, 0_m, 1_m, 1_m, 0_m, 0_m});
+    ASSERT_EQ(GetChildCount(conf), ChildCounter{5});
+    
+    // The range covers every child whose AABB overlaps and isn't much bigger than that.
+    for (auto x = -2; x < 8; ++x)
+    {
+        const auto aabb = AABB{Length2{(x + 0.25f) * 1_m, 0_m}, Length2{(x + 0.75f) * 1_m, 1_m}};
+        const auto range = GetChildRange(conf, aabb);
+        EXPECT_LE(range.first, range.second);
+        EXPECT_LE(range.second - range.first, ChildCounter{2});
+        for (auto i = ChildCounter{0}; i < GetChildCount(conf); ++i)
+        {
+            if (TestOverlap(GetChildAABB(conf, i), aabb))
+            {
+                EXPECT_GE(i, range.first);
+                EXPECT_LT(i, range.second);
+            }
+        }
+    }
+    
+    // Above and below all of the heights.
+    EXPECT_EQ(GetChildRange(conf, AABB{Length2{0_m, 2_m}, Length2{5_m, 3_m}}).second,
+              GetChildRange(conf, AABB{Length2{0_m, 2_m}, Length2{5_m, 3_m}}).first);
+    EXPECT_EQ(GetChildRange(conf, AABB{Length2{0_m, -3_m}, Length2{5_m, -2_m}}).second,
+              GetChildRange(conf, AABB{Length2{0_m, -3_m}, Length2{5_m, -2_m}}).first);
+    
+    // Everything.
+    EXPECT_EQ(GetChildRange(conf, AABB{Length2{-9_m, -9_m}, Length2{9_m, 9_m}}),
+              std::make_pair(ChildCounter{0}, ChildCounter{5}));
+    EXPECT_EQ(GetAABB(conf), (AABB{Length2{0_m, 0_m}, Length2{5_m, 1_m}}));
+}
+
+TEST(HeightFieldShapeConf, Origin)
+{
+    const auto heights = std::vector<Length>{1_m, 2_m, 0_m};
+    const auto origin = Length2{-3_m, 4_m};
+    const auto conf = HeightFieldShapeConf{}.UseVertexRadius(0_m).UseOrigin(origin).Set(2_m, heights);
+    EXPECT_EQ(conf.GetOrigin(), origin);
+    EXPECT_EQ(conf.GetHeight(1), 2_m);
+    EXPECT_EQ(conf.GetVertex(1), (Length2{-1_m, 6_m}));
+    EXPECT_EQ(GetAABB(conf), (AABB{Length2{-3_m, 4_m}, Length2{1_m, 6_m}}));
+    EXPECT_NE(conf, HeightFieldShapeConf{}.UseVertexRadius(0_m).Set(2_m, heights));
+    
+    const auto chain = ChainShapeConf{}.UseVertexRadius(0_m).Set(std::vector<Length2>{
+        Length2{-3_m, 5_m}, Length2{-1_m, 6_m}, Length2{1_m, 4_m}
+    });
+    for (auto i = ChildCounter{0}; i < GetChildCount(conf); ++i)
+    {
+        EXPECT_EQ(GetChild(conf, i), GetChild(chain, i));
+        EXPECT_EQ(GetChildAABB(conf, i), ComputeAABB(GetChild(chain, i), Transform_identity));
+    }
+    EXPECT_EQ(GetMassData(conf), GetMassData(chain));
+    
+    // Ranges are those of the same heights without an origin for AABBs moved by the origin.
+    const auto unmoved = HeightFieldShapeConf{}.UseVertexRadius(0_m).Set(2_m, heights);
+    for (auto x = -2; x < 6; ++x)
+    {
+        const auto aabb = AABB{Length2{(x + 0.25f) * 1_m, 0_m}, Length2{(x + 0.75f) * 1_m, 1_m}};
+        EXPECT_EQ(GetChildRange(conf, GetMovedAABB(aabb, origin)), GetChildRange(unmoved, aabb));
+    }
+    const auto below = GetChildRange(conf, AABB{Length2{-3_m, 0_m}, Length2{1_m, 3_m}});
+    EXPECT_EQ(below.first, below.second);
+}
+
+TEST(HeightFieldShapeConf, Transform)
+{
+    auto conf = HeightFieldShapeConf{}.Set(1_m, std::vector<Length>{0_m, 1_m, 2_m});
+    conf.Transform(Mat22{Vec2{Real(2), Real(0)}, Vec2{Real(0), Real(3)}});
+    EXPECT_EQ(conf.GetCellWidth(), 2_m);
+    EXPECT_EQ(conf.GetHeight(2), 6_m);
+    EXPECT_EQ(conf.GetVertex(2), (Length2{4_m, 6_m}));
+    
+    auto moved = HeightFieldShapeConf{}.UseOrigin(Length2{1_m, 1_m}).Add(1_m).Add(2_m);
+    moved.Transform(Mat22{Vec2{Real(2), Real(0)}, Vec2{Real(0), Real(-1)}});
+    EXPECT_EQ(moved.GetOrigin(), (Length2{2_m, -1_m}));
+    EXPECT_EQ(moved.GetVertex(1), (Length2{4_m, -3_m}));
+    EXPECT_EQ(moved.GetMinHeight(), -2_m);
+    EXPECT_EQ(moved.GetMaxHeight(), -1_m);
+    
+    auto rotated = conf;
+    EXPECT_THROW(rotated.Transform(Mat22{Vec2{Real(0), Real(1)}, Vec2{Real(-1), Real(0)}}), InvalidArgument);
+    EXPECT_EQ(rotated, conf);
+}
+
+TEST(HeightFieldShapeConf, Equality)
+{
+    const auto heights = std::vector<Length>{0_m, 1_m};
+    EXPECT_EQ(HeightFieldShapeConf{}.Set(1_m, heights), HeightFieldShapeConf{}.Set(1_m, heights));
+    EXPECT_NE(HeightFieldShapeConf{}.Set(1_m, heights), HeightFieldShapeConf{}.Set(2_m, heights));
+    EXPECT_NE(HeightFieldShapeConf{}.Set(1_m, heights), HeightFieldShapeConf{}.Add(0_m).Add(2_m));
+    EXPECT_EQ(HeightFieldShapeConf{}.Set(1_m, heights), HeightFieldShapeConf{}.Add(0_m).Add(1_m));
+}
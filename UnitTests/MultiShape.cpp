@@ -366,3 +366,134 @@ TEST(MultiShapeConf, Inequality)
     EXPECT_TRUE(MultiShapeConf().UseRestitution(Real(10)) != MultiShapeConf());
     EXPECT_FALSE(MultiShapeConf().UseRestitution(Real(10)) != MultiShapeConf().UseRestitution(Real(10)));
 }
+
+namespace {
+
+/// Gets the total area of the given configuration's children.
+double GetTotalArea(const MultiShapeConf& conf)
+{
+    auto area = 0_m2;
+    for (auto&& child: conf.children)
+    {
+        const auto dp = child.GetDistanceProxy();
+        area += GetAreaOfPolygon(Span<const Length2>(begin(dp.GetVertices()), dp.GetVertexCount()));
+    }
+    return static_cast<double>(Real{area / SquareMeter});
+}
+
+/// Whether all of the given configuration's children are convex.
+bool IsEveryChildConvex(const MultiShapeConf& conf)
+{
+    for (auto&& child: conf.children)
+    {
+        const auto dp = child.GetDistanceProxy();
+        const auto count = dp.GetVertexCount();
+        for (auto i = decltype(count){0}; i < count; ++i)
+        {
+            const auto a = dp.GetVertex(i);
+            const auto b = dp.GetVertex(GetModuloNext(i, count));
+            const auto c = dp.GetVertex(GetModuloNext(GetModuloNext(i, count), count));
+            if (!(Cross(b - a, c - b) > 0_m2))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+TEST(MultiShapeConf, AddConvexDecompositionOfConvexPolygon)
+{
+    // Clockwise ordered square with a collinear vertex and a repeated vertex.
+    const auto square = std::vector<Length2>{
+        Length2{-1_m, -1_m}, Length2{-1_m, +1_m}, Length2{+1_m, +1_m}, Length2{+1_m, +1_m},
+        Length2{+1_m, 0_m}, Length2{+1_m, -1_m}
+    };
+    const auto conf = MultiShapeConf{}.AddConvexDecomposition(square, 0_m);
+    ASSERT_EQ(size(conf.children), std::size_t(1));
+    EXPECT_EQ(conf.children[0].GetDistanceProxy().GetVertexCount(), VertexCounter(4));
+    EXPECT_TRUE(IsEveryChildConvex(conf));
+    EXPECT_NEAR(GetTotalArea(conf), 4.0, 0.0001);
+}
+
+TEST(MultiShapeConf, AddConvexDecompositionOfConcavePolygon)
+{
+    const auto lShape = std::vector<Length2>{
+        Length2{0_m, 0_m}, Length2{2_m, 0_m}, Length2{2_m, 1_m},
+        Length2{1_m, 1_m}, Length2{1_m, 2_m}, Length2{0_m, 2_m}
+    };
+    const auto conf = MultiShapeConf{}.UseDensity(1_kgpm2).AddConvexDecomposition(lShape, 0_m);
+    EXPECT_EQ(size(conf.children), std::size_t(2));
+    EXPECT_TRUE(IsEveryChildConvex(conf));
+    EXPECT_NEAR(GetTotalArea(conf), 3.0, 0.0001);
+    EXPECT_NEAR(static_cast<double>(Real{GetMassData(conf).mass / Kilogram}), 3.0, 0.0001);
+
+    // Star with 8 points.
+    auto star = std::vector<Length2>{};
+    for (auto i = 0; i < 16; ++i)
+    {
+        const auto radius = ((i % 2) == 0)? 2_m: 1_m;
+        const auto angle = Real(i) * Pi / Real(8);
+        star.push_back(Length2{radius * cos(angle), radius * sin(angle)});
+    }
+    const auto starArea = static_cast<double>(Real{GetAreaOfPolygon(star) / SquareMeter});
+    const auto starConf = MultiShapeConf{}.AddConvexDecomposition(star, 0_m);
+    EXPECT_GE(size(starConf.children), std::size_t(5));
+    EXPECT_LE(size(starConf.children), std::size_t(14));
+    EXPECT_TRUE(IsEveryChildConvex(starConf));
+    EXPECT_NEAR(GetTotalArea(starConf), starArea, 0.001);
+
+    // Limiting the vertices to three gets a triangulation.
+    const auto triangles = MultiShapeConf{}.AddConvexDecomposition(star, 0_m, 3);
+    EXPECT_EQ(size(triangles.children), size(star) - 2);
+    EXPECT_NEAR(GetTotalArea(triangles), starArea, 0.001);
+}
+
+TEST(MultiShapeConf, AddConvexDecompositionThrows)
+{
+    const auto line = std::vector<Length2>{Length2{0_m, 0_m}, Length2{1_m, 0_m}, Length2{2_m, 0_m}};
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(line), InvalidArgument);
+    const auto two = std::vector<Length2>{Length2{0_m, 0_m}, Length2{1_m, 0_m}};
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(two), InvalidArgument);
+    const auto bowTie = std::vector<Length2>{
+        Length2{0_m, 0_m}, Length2{1_m, 1_m}, Length2{1_m, 0_m}, Length2{0_m, 1_m}
+    };
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(bowTie), InvalidArgument);
+    const auto figureEight = std::vector<Length2>{
+        Length2{0_m, 0_m}, Length2{4_m, 2_m}, Length2{4_m, 0_m}, Length2{0_m, 1_m}
+    };
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(figureEight), InvalidArgument);
+    auto pentagram = std::vector<Length2>{};
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto angle = Real(i * 2) * Pi * 2 / 5;
+        pentagram.push_back(Length2{std::cos(angle) * 1_m, std::sin(angle) * 1_m});
+    }
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(pentagram), InvalidArgument);
+    const auto touching = std::vector<Length2>{
+        Length2{0_m, 0_m}, Length2{2_m, 0_m}, Length2{1_m, 1_m}, Length2{2_m, 2_m},
+        Length2{0_m, 2_m}, Length2{1_m, 1_m}
+    };
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(touching), InvalidArgument);
+    const auto triangle = std::vector<Length2>{Length2{0_m, 0_m}, Length2{1_m, 0_m}, Length2{0_m, 1_m}};
+    EXPECT_THROW(MultiShapeConf{}.AddConvexDecomposition(triangle, 0_m, 2), InvalidArgument);
+    EXPECT_NO_THROW(MultiShapeConf{}.AddConvexDecomposition(triangle, 0_m, 3));
+}
+
+TEST(MultiShapeConf, GetConvexDecompositions)
+{
+    const auto polygons = std::vector<std::vector<Length2>>{
+        {Length2{0_m, 0_m}, Length2{2_m, 0_m}, Length2{2_m, 1_m},
+         Length2{1_m, 1_m}, Length2{1_m, 2_m}, Length2{0_m, 2_m}},
+        {Length2{0_m, 0_m}, Length2{1_m, 0_m}, Length2{0_m, 1_m}}
+    };
+    const auto prototype = MultiShapeConf{}.UseFriction(Real(0.25)).UseDensity(2_kgpm2);
+    const auto confs = GetConvexDecompositions(prototype, polygons, 0_m);
+    ASSERT_EQ(size(confs), std::size_t(2));
+    EXPECT_EQ(confs[0], MultiShapeConf(prototype).AddConvexDecomposition(polygons[0], 0_m));
+    EXPECT_EQ(confs[1], MultiShapeConf(prototype).AddConvexDecomposition(polygons[1], 0_m));
+    EXPECT_EQ(confs[1].friction, Real(0.25));
+    EXPECT_EQ(size(confs[1].children), std::size_t(1));
+}
@@ -521,3 +521,27 @@ TEST(PolygonShapeConf, ValidateFF)
     vertices.push_back(Length2{+2_m, 1_m});
     EXPECT_FALSE(Validate(vertices));
 }
+
+TEST(PolygonShapeConf, Slice)
+{
+    const auto box = PolygonShapeConf{}.UseDensity(2_kgpm2).SetAsBox(2_m, 1_m);
+    
+    const auto pieces = Slice(box, Length2{1_m, 0_m}, UnitVec::GetRight());
+    ASSERT_EQ(pieces.first.GetVertexCount(), VertexCounter(4));
+    ASSERT_EQ(pieces.second.GetVertexCount(), VertexCounter(4));
+    EXPECT_EQ(pieces.first.density, box.density);
+    EXPECT_EQ(pieces.second.density, box.density);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(pieces.first.GetCentroid()) / 1_m}), -0.5, 0.0001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(pieces.second.GetCentroid()) / 1_m}), 1.5, 0.0001);
+    const auto areaFirst = GetMassData(pieces.first).mass / box.density;
+    const auto areaSecond = GetMassData(pieces.second).mass / box.density;
+    EXPECT_NEAR(static_cast<double>(Real{(areaFirst + areaSecond) / 1_m2}), 8.0, 0.01);
+    
+    const auto diagonal = Slice(box, Length2{}, GetUnitVector(Vec2{Real(1), Real(-2)}));
+    EXPECT_EQ(diagonal.first.GetVertexCount(), VertexCounter(3));
+    EXPECT_EQ(diagonal.second.GetVertexCount(), VertexCounter(3));
+    
+    const auto miss = Slice(box, Length2{3_m, 0_m}, UnitVec::GetRight());
+    EXPECT_EQ(miss.first.GetVertexCount(), VertexCounter(4));
+    EXPECT_EQ(miss.second.GetVertexCount(), VertexCounter(0));
+}
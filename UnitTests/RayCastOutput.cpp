@@ -24,10 +24,13 @@
 #include <PlayRho/Collision/RayCastInput.hpp>
 #include <PlayRho/Collision/AABB.hpp>
 #include <PlayRho/Collision/DistanceProxy.hpp>
+#include <PlayRho/Collision/DynamicTree.hpp>
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/Shape.hpp>
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 using namespace playrho;
 using namespace playrho::d2;
@@ -237,3 +240,34 @@ TEST(RayCastHit, InitConstruction)
     EXPECT_EQ(foo.fraction, fraction);
 }
 
+
+TEST(RayCastOutput, RayCastPacketVisitsLeafsOnce)
+{
+    auto tree = DynamicTree{};
+    const auto leafA = tree.CreateLeaf(AABB{Length2{2_m, -1_m}, Length2{3_m, 1_m}},
+                                       DynamicTree::LeafData{nullptr, nullptr, 0});
+    const auto leafB = tree.CreateLeaf(AABB{Length2{-3_m, -1_m}, Length2{-2_m, 1_m}},
+                                       DynamicTree::LeafData{nullptr, nullptr, 1});
+    tree.CreateLeaf(AABB{Length2{-1_m, 5_m}, Length2{1_m, 6_m}},
+                    DynamicTree::LeafData{nullptr, nullptr, 2});
+    ASSERT_NE(leafA, leafB);
+
+    RayCastInput inputs[] = {
+        RayCastInput{Length2{}, Length2{+10_m, 0_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{}, Length2{+10_m, 0.5_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{}, Length2{-10_m, 0_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{}, Length2{0_m, -10_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{}, Length2{+10_m, 0_m}, UnitInterval<Real>{Real(0.1)}},
+    };
+    auto calls = std::vector<std::pair<ChildCounter, std::vector<std::size_t>>>{};
+    RayCast(tree, Span<RayCastInput>(inputs), [&](Fixture*, ChildCounter child,
+                                                  Span<const std::size_t> rays) {
+        calls.emplace_back(child, std::vector<std::size_t>(begin(rays), end(rays)));
+    });
+    ASSERT_EQ(size(calls), std::size_t(2));
+    std::sort(begin(calls), end(calls));
+    EXPECT_EQ(calls[0].first, ChildCounter(0));
+    EXPECT_EQ(calls[0].second, (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(calls[1].first, ChildCounter(1));
+    EXPECT_EQ(calls[1].second, (std::vector<std::size_t>{2}));
+}
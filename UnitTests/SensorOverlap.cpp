@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include <PlayRho/Dynamics/SensorOverlap.hpp>
+#include <PlayRho/Dynamics/ContactEventBuffer.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+TEST(SensorOverlap, ByteSize)
+{
+#if defined(_WIN32) && !defined(_WIN64)
+    EXPECT_EQ(sizeof(SensorOverlap), std::size_t(24));
+#else
+    EXPECT_EQ(sizeof(SensorOverlap), std::size_t(32));
+#endif
+}
+
+TEST(SensorOverlap, Ordering)
+{
+    const auto a = SensorOverlap{1u, 2u, 0u, 0u, nullptr, nullptr};
+    const auto b = SensorOverlap{1u, 3u, 0u, 0u, nullptr, nullptr};
+    const auto c = SensorOverlap{2u, 0u, 0u, 0u, nullptr, nullptr};
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b < c);
+    EXPECT_FALSE(b < a);
+    EXPECT_FALSE(a < a);
+    EXPECT_TRUE(a == a);
+    EXPECT_TRUE(a != b);
+}
+
+TEST(SensorOverlap, WorldTracksOverlapsInsteadOfContacts)
+{
+    auto buffer = ContactEventBuffer{};
+    auto world = World{WorldConf{}.UseSensorOverlaps(true)};
+    world.SetContactEventBuffer(&buffer);
+    EXPECT_TRUE(world.IsTrackingSensorOverlaps());
+    EXPECT_FALSE(World{}.IsTrackingSensorOverlaps());
+
+    const auto trigger = world.CreateBody()->CreateFixture(
+        Shape{PolygonShapeConf{}.SetAsBox(2_m, 2_m)}, FixtureConf{}.UseIsSensor(true));
+    const auto disk = Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)};
+    const auto inside = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                         .UseLocation(Length2{1_m, -1_m}))->CreateFixture(disk);
+    const auto outside = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                          .UseLocation(Length2{10_m, 1_m})
+                                          .UseLinearVelocity(LinearVelocity2{-10_mps, 0_mps}))
+        ->CreateFixture(disk);
+
+    auto stepConf = StepConf{};
+    stepConf.SetTime(0.1_s);
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    ASSERT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_EQ(world.GetSensorOverlaps()[0].sensor, trigger);
+    EXPECT_EQ(world.GetSensorOverlaps()[0].other, inside);
+    const auto sensorProxy = trigger->GetProxy(0).treeId;
+    EXPECT_EQ(size(world.GetSensorOverlaps(sensorProxy)), std::size_t(1));
+    EXPECT_EQ(size(world.GetSensorOverlaps(sensorProxy + 1)), std::size_t(0));
+    ASSERT_EQ(size(buffer.GetSensorEnterEvents()), std::size_t(1));
+    EXPECT_EQ(buffer.GetSensorEnterEvents()[0].fixtureA, trigger);
+    EXPECT_EQ(buffer.GetSensorEnterEvents()[0].fixtureB, inside);
+    EXPECT_TRUE(empty(buffer.GetBeginEvents()));
+    buffer.Clear();
+
+    // The moving disk passes through the trigger entering and then exiting it.
+    auto entered = false;
+    auto exited = false;
+    for (auto i = 0; i < 20; ++i)
+    {
+        world.Step(stepConf);
+        for (auto&& event: buffer.GetSensorEnterEvents())
+        {
+            EXPECT_EQ(event.fixtureB, outside);
+            entered = true;
+        }
+        for (auto&& event: buffer.GetSensorExitEvents())
+        {
+            EXPECT_EQ(event.fixtureB, outside);
+            EXPECT_TRUE(entered);
+            exited = true;
+        }
+        buffer.Clear();
+    }
+    EXPECT_TRUE(entered);
+    EXPECT_TRUE(exited);
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+
+    // Copies get the overlaps too.
+    const auto copy = World{world};
+    ASSERT_EQ(size(copy.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_NE(copy.GetSensorOverlaps()[0].sensor, trigger);
+    EXPECT_TRUE(copy.GetSensorOverlaps()[0].sensor->IsSensor());
+
+    // Destroying the other fixture exits its overlap.
+    inside->GetBody()->Destroy(inside);
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+    ASSERT_EQ(size(buffer.GetSensorExitEvents()), std::size_t(1));
+    EXPECT_EQ(buffer.GetSensorExitEvents()[0].fixtureB, inside);
+}
+
+TEST(SensorOverlap, SetSensorSwitchesBetweenOverlapsAndContacts)
+{
+    auto buffer = ContactEventBuffer{};
+    auto world = World{WorldConf{}.UseSensorOverlaps(true)};
+    world.SetContactEventBuffer(&buffer);
+    const auto fixture = world.CreateBody()->CreateFixture(
+        Shape{PolygonShapeConf{}.SetAsBox(2_m, 2_m)}, FixtureConf{}.UseIsSensor(true));
+    world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic))->CreateFixture(
+        Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)});
+
+    auto stepConf = StepConf{};
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    buffer.Clear();
+
+    fixture->SetSensor(false);
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+    EXPECT_EQ(size(buffer.GetSensorExitEvents()), std::size_t(1));
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(1));
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+
+    fixture->SetSensor(true);
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+}
+
+TEST(SensorOverlap, AabbOnly)
+{
+    const auto sensorShape = Shape{PolygonShapeConf{}.SetAsBox(1_m, 1_m)};
+    const auto diskShape = Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)};
+    const auto diskLocation = Length2{1.45_m, 1.45_m};
+    for (auto aabbOnly: {false, true})
+    {
+        auto world = World{WorldConf{}.UseSensorOverlaps(true).UseAabbSensorOverlaps(aabbOnly)};
+        world.CreateBody()->CreateFixture(sensorShape, FixtureConf{}.UseIsSensor(true));
+        world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic).UseLocation(diskLocation))
+            ->CreateFixture(diskShape);
+        world.Step(StepConf{});
+        // The AABBs overlap but the disk is just beyond the box's corner.
+        EXPECT_EQ(size(world.GetSensorOverlaps()), aabbOnly? std::size_t(1): std::size_t(0));
+    }
+}
+
+TEST(SensorOverlap, SleepingOverlapsKeptUntilTouched)
+{
+    auto buffer = ContactEventBuffer{};
+    auto world = World{WorldConf{}.UseSensorOverlaps(true)};
+    world.SetContactEventBuffer(&buffer);
+    world.CreateBody()->CreateFixture(Shape{PolygonShapeConf{}.SetAsBox(2_m, 2_m)},
+                                      FixtureConf{}.UseIsSensor(true));
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic).UseAwake(false)
+                                       .UseLocation(Length2{1_m, 1_m}));
+    body->CreateFixture(Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)});
+    ASSERT_FALSE(body->IsAwake());
+
+    auto stepConf = StepConf{};
+    world.Step(stepConf);
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_EQ(size(buffer.GetSensorEnterEvents()), std::size_t(1));
+    buffer.Clear();
+
+    // Neither body is awake and neither proxy moved so the overlap is kept as is.
+    world.Step(stepConf);
+    ASSERT_FALSE(body->IsAwake());
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_TRUE(empty(buffer.GetSensorEnterEvents()));
+    EXPECT_TRUE(empty(buffer.GetSensorExitEvents()));
+
+    // Moving the body touches its proxies so their overlaps get tested again.
+    body->SetTransform(Length2{10_m, 10_m}, 0_deg);
+    world.Step(stepConf);
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+    EXPECT_EQ(size(buffer.GetSensorExitEvents()), std::size_t(1));
+    buffer.Clear();
+
+    body->SetTransform(Length2{-1_m, 1_m}, 0_deg);
+    world.Step(stepConf);
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_EQ(size(buffer.GetSensorEnterEvents()), std::size_t(1));
+    buffer.Clear();
+
+    // Disabling the body destroys its proxies and so drops their overlaps.
+    body->SetEnabled(false);
+    world.Step(stepConf);
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+    EXPECT_EQ(size(buffer.GetSensorExitEvents()), std::size_t(1));
+}
+
+TEST(SensorOverlap, BodyPutToSleepGetsTestedAgain)
+{
+    auto buffer = ContactEventBuffer{};
+    auto world = World{WorldConf{}.UseSensorOverlaps(true)};
+    world.SetContactEventBuffer(&buffer);
+    world.CreateBody()->CreateFixture(Shape{DiskShapeConf{}.UseRadius(1_m)},
+                                      FixtureConf{}.UseIsSensor(true));
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                       .UseLocation(Length2{1.525_m, 0_m})
+                                       .UseLinearVelocity(LinearVelocity2{-1_mps, 0_mps}));
+    body->CreateFixture(Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)});
+
+    auto stepConf = StepConf{};
+    stepConf.SetTime(1_s / 60);
+    world.Step(stepConf);
+    ASSERT_TRUE(body->IsAwake());
+    EXPECT_TRUE(empty(world.GetSensorOverlaps()));
+    EXPECT_TRUE(empty(buffer.GetSensorEnterEvents()));
+
+    // The body moves into the sensor without leaving its proxy's enlarged AABB and gets
+    // put to sleep in the same step.
+    stepConf.minStillTimeToSleep = 0_s;
+    stepConf.linearSleepTolerance = 10_mps;
+    world.Step(stepConf);
+    ASSERT_FALSE(body->IsAwake());
+    EXPECT_EQ(size(world.GetSensorOverlaps()), std::size_t(1));
+    EXPECT_EQ(size(buffer.GetSensorEnterEvents()), std::size_t(1));
+}
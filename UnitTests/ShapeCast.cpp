@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include <PlayRho/Collision/ShapeCast.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+namespace {
+
+const auto origin = Length2{};
+
+ShapeCastInput GetDiskCast(Length2 translation)
+{
+    auto input = ShapeCastInput{};
+    input.proxy = DistanceProxy{0.5_m, 1, &origin, nullptr};
+    input.translation = translation;
+    return input;
+}
+
+} // anonymous namespace
+
+TEST(ShapeCast, DiskAgainstBox)
+{
+    const auto box = PolygonShapeConf{}.SetAsBox(1_m, 1_m);
+    const auto xf = Transformation{Length2{5_m, 0_m}, UnitVec::GetRight()};
+    const auto output = ShapeCast(GetChild(box, 0), xf, GetDiskCast(Length2{10_m, 0_m}));
+    ASSERT_TRUE(output.has_value());
+    
+    // The disk touches the box when its center is at 4m minus the disk and box radii.
+    const auto expected = (Real(3.5) - Real{box.vertexRadius / Meter}) / 10;
+    EXPECT_NEAR(static_cast<double>(Real{output->fraction}), static_cast<double>(expected), 0.001);
+    EXPECT_NEAR(static_cast<double>(GetX(output->normal)), -1.0, 0.001);
+    EXPECT_NEAR(static_cast<double>(GetY(output->normal)), 0.0, 0.001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(output->point) / Meter}),
+                static_cast<double>(Real(4) - Real{box.vertexRadius / Meter}), 0.01);
+    EXPECT_NEAR(static_cast<double>(Real{GetY(output->point) / Meter}), 0.0, 0.001);
+}
+
+TEST(ShapeCast, MaxFractionLimitsCast)
+{
+    const auto box = PolygonShapeConf{}.SetAsBox(1_m, 1_m);
+    const auto xf = Transformation{Length2{5_m, 0_m}, UnitVec::GetRight()};
+    auto input = GetDiskCast(Length2{10_m, 0_m});
+    input.maxFraction = UnitInterval<Real>{Real(0.3)};
+    EXPECT_FALSE(ShapeCast(GetChild(box, 0), xf, input).has_value());
+    input.maxFraction = UnitInterval<Real>{Real(0.4)};
+    EXPECT_TRUE(ShapeCast(GetChild(box, 0), xf, input).has_value());
+}
+
+TEST(ShapeCast, MissesAndIgnoresStartingOverlap)
+{
+    const auto box = PolygonShapeConf{}.SetAsBox(1_m, 1_m);
+    const auto xf = Transformation{Length2{5_m, 0_m}, UnitVec::GetRight()};
+    EXPECT_FALSE(ShapeCast(GetChild(box, 0), xf, GetDiskCast(Length2{0_m, 10_m})).has_value());
+    EXPECT_FALSE(ShapeCast(GetChild(box, 0), Transform_identity,
+                           GetDiskCast(Length2{10_m, 0_m})).has_value());
+}
+
+TEST(ShapeCast, World)
+{
+    auto world = World{};
+    const auto shape = Shape{PolygonShapeConf{}.SetAsBox(1_m, 1_m)};
+    const auto near = world.CreateBody(BodyConf{}.UseLocation(Length2{5_m, 0_m}));
+    near->CreateFixture(shape);
+    const auto far = world.CreateBody(BodyConf{}.UseLocation(Length2{10_m, 0_m}));
+    far->CreateFixture(shape);
+    world.Step(StepConf{}.SetTime(0_s));
+    
+    const auto hit = ShapeCast(world, GetDiskCast(Length2{20_m, 0_m}));
+    ASSERT_NE(hit.fixture, nullptr);
+    EXPECT_EQ(hit.fixture->GetBody(), near);
+    EXPECT_EQ(hit.childIndex, ChildCounter(0));
+    EXPECT_NEAR(static_cast<double>(Real{hit.hit.fraction}), 0.175, 0.001);
+    
+    EXPECT_TRUE(TestShapeCast(world, GetDiskCast(Length2{20_m, 0_m})));
+    EXPECT_FALSE(TestShapeCast(world, GetDiskCast(Length2{0_m, 20_m})));
+    
+    auto count = 0;
+    EXPECT_FALSE(ShapeCast(world.GetTree(), GetDiskCast(Length2{20_m, 0_m}),
+                           [&count](Fixture*, ChildCounter, const ShapeCastHit&) {
+        ++count;
+        return RayCastOpcode::IgnoreFixture;
+    }));
+    EXPECT_EQ(count, 2);
+    
+    const ShapeCastInput inputs[] = {
+        GetDiskCast(Length2{0_m, 20_m}),
+        GetDiskCast(Length2{20_m, 0_m}),
+    };
+    const auto hits = ShapeCast(world, Span<const ShapeCastInput>(inputs, 2));
+    ASSERT_EQ(size(hits), std::size_t(2));
+    EXPECT_EQ(hits[0].fixture, nullptr);
+    EXPECT_EQ(hits[1].fixture, hit.fixture);
+    EXPECT_EQ(hits[1].hit.fraction, hit.hit.fraction);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include "UnitTests.hpp"
+#include <PlayRho/Collision/Shapes/ShapeRegistry.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/Fixture.hpp>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+TEST(ShapeRegistry, DefaultConstruction)
+{
+    const auto registry = ShapeRegistry{};
+    EXPECT_EQ(registry.GetSize(), std::size_t(0));
+    EXPECT_EQ(registry.Find(Shape{DiskShapeConf{}}), nullptr);
+}
+
+TEST(ShapeRegistry, HashOfEqualShapesEqual)
+{
+    const auto a = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(1_m, 2_m)};
+    const auto b = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(1_m, 2_m)};
+    ASSERT_NE(GetData(a), GetData(b));
+    ASSERT_EQ(a, b);
+    EXPECT_EQ(GetHash(a), GetHash(b));
+    EXPECT_NE(GetHash(a), GetHash(Shape{DiskShapeConf{}}));
+}
+
+TEST(ShapeRegistry, InternSharesEqualShapes)
+{
+    auto registry = ShapeRegistry{};
+    const auto conf = PolygonShapeConf{}.UseDensity(2_kgpm2).SetAsBox(1_m, 0.5_m);
+    const auto a = Shape{conf};
+    const auto b = Shape{conf};
+    const auto other = Shape{DiskShapeConf{}.UseRadius(1_m)};
+
+    const auto internedA = registry.Intern(a);
+    EXPECT_EQ(GetData(internedA), GetData(a));
+    const auto internedB = registry.Intern(b);
+    EXPECT_EQ(GetData(internedB), GetData(a));
+    const auto internedOther = registry.Intern(other);
+    EXPECT_EQ(GetData(internedOther), GetData(other));
+    EXPECT_EQ(registry.GetSize(), std::size_t(2));
+
+    const auto entry = registry.Find(a);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->useCount, std::size_t(2));
+    EXPECT_EQ(entry->massData, GetMassData(a));
+    EXPECT_EQ(entry->aabb, ComputeAABB(a, Transform_identity));
+    ASSERT_EQ(size(entry->children), std::size_t(GetChildCount(a)));
+    EXPECT_EQ(entry->children[0], GetChild(a, 0));
+    EXPECT_EQ(registry.Find(b), nullptr);
+    EXPECT_EQ(GetMassData(registry, b), GetMassData(b));
+    EXPECT_EQ(GetChildren(registry, a).size(), std::size_t(1));
+    EXPECT_TRUE(GetChildren(registry, b).empty());
+
+    EXPECT_TRUE(registry.Release(a));
+    EXPECT_EQ(registry.GetSize(), std::size_t(2));
+    EXPECT_TRUE(registry.Release(a));
+    EXPECT_EQ(registry.GetSize(), std::size_t(1));
+    EXPECT_FALSE(registry.Release(a));
+    EXPECT_EQ(registry.Find(a), nullptr);
+
+    // With the first registration released, an equal shape registers itself.
+    EXPECT_EQ(GetData(registry.Intern(b)), GetData(b));
+
+    registry.Clear();
+    EXPECT_EQ(registry.GetSize(), std::size_t(0));
+}
+
+TEST(ShapeRegistry, InternChildlessShape)
+{
+    auto registry = ShapeRegistry{};
+    const auto shape = Shape{ChainShapeConf{}};
+    ASSERT_EQ(GetChildCount(shape), ChildCounter(0));
+    EXPECT_EQ(GetData(registry.Intern(shape)), GetData(shape));
+    EXPECT_EQ(GetData(registry.Intern(Shape{ChainShapeConf{}})), GetData(shape));
+    EXPECT_EQ(registry.GetSize(), std::size_t(1));
+}
+
+TEST(ShapeRegistry, WorldInternsFixtureShapes)
+{
+    auto world = World{WorldConf{}.UseShapeInterning(true)};
+    ASSERT_NE(world.GetShapeRegistry(), nullptr);
+    EXPECT_EQ(World{}.GetShapeRegistry(), nullptr);
+
+    const auto conf = PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.25_m);
+    auto bodies = std::vector<Body*>{};
+    for (auto i = 0; i < 10; ++i)
+    {
+        const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                           .UseLocation(Length2{i * 2_m, 0_m}));
+        body->CreateFixture(Shape{conf});
+        body->CreateFixture(Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)
+            .UseLocation(Length2{0_m, 1_m})});
+        bodies.push_back(body);
+    }
+    EXPECT_EQ(GetFixtureCount(world), std::size_t(20));
+    EXPECT_EQ(GetShapeCount(world), std::size_t(2));
+    EXPECT_EQ(world.GetShapeRegistry()->GetSize(), std::size_t(2));
+
+    // Mass properties are the same as without interning.
+    auto plain = World{};
+    const auto body = plain.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    body->CreateFixture(Shape{conf});
+    body->CreateFixture(Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)
+        .UseLocation(Length2{0_m, 1_m})});
+    EXPECT_EQ(GetMass(*bodies[0]), GetMass(*body));
+    EXPECT_EQ(GetLocalRotInertia(*bodies[0]), GetLocalRotInertia(*body));
+    EXPECT_EQ(bodies[0]->GetLocalCenter(), body->GetLocalCenter());
+
+    auto copy = World{world};
+    ASSERT_NE(copy.GetShapeRegistry(), nullptr);
+    EXPECT_EQ(copy.GetShapeRegistry()->GetSize(), std::size_t(2));
+
+    for (auto&& b: bodies)
+    {
+        b->Destroy(*begin(b->GetFixtures()));
+    }
+    EXPECT_EQ(world.GetShapeRegistry()->GetSize(), std::size_t(1));
+    world.Destroy(bodies[0]);
+    EXPECT_EQ(world.GetShapeRegistry()->GetSize(), std::size_t(1));
+    world.Clear();
+    EXPECT_EQ(world.GetShapeRegistry()->GetSize(), std::size_t(0));
+    EXPECT_EQ(copy.GetShapeRegistry()->GetSize(), std::size_t(2));
+}
@@ -28,9 +28,9 @@ TEST(StepConf, ByteSize)
 {
     switch (sizeof(Real))
     {
-        case  4: EXPECT_EQ(sizeof(StepConf), std::size_t(108)); break;
-        case  8: EXPECT_EQ(sizeof(StepConf), std::size_t(208)); break;
-        case 16: EXPECT_EQ(sizeof(StepConf), std::size_t(400)); break;
+        case  4: EXPECT_EQ(sizeof(StepConf), std::size_t(120)); break;
+        case  8: EXPECT_EQ(sizeof(StepConf), std::size_t(224)); break;
+        case 16: EXPECT_EQ(sizeof(StepConf), std::size_t(432)); break;
         default: FAIL(); break;
     }
 }
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include <PlayRho/Dynamics/StepProfiler.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+
+#include <sstream>
+#include <string>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+TEST(StepProfiler, ToString)
+{
+    EXPECT_STREQ(ToString(StepPhase::ProxySync), "ProxySync");
+    EXPECT_STREQ(ToString(StepPhase::ContactDestroy), "ContactDestroy");
+    EXPECT_STREQ(ToString(StepPhase::FindNewContacts), "FindNewContacts");
+    EXPECT_STREQ(ToString(StepPhase::NarrowPhase), "NarrowPhase");
+    EXPECT_STREQ(ToString(StepPhase::IslandBuild), "IslandBuild");
+    EXPECT_STREQ(ToString(StepPhase::Solve), "Solve");
+    EXPECT_STREQ(ToString(StepPhase::VelocitySolve), "VelocitySolve");
+    EXPECT_STREQ(ToString(StepPhase::PositionSolve), "PositionSolve");
+    EXPECT_STREQ(ToString(StepPhase::Toi), "Toi");
+    EXPECT_STREQ(ToString(StepPhase::SensorOverlaps), "SensorOverlaps");
+}
+
+TEST(StepProfiler, GetParent)
+{
+    EXPECT_EQ(GetParent(StepPhase::ProxySync), StepPhase::ProxySync);
+    EXPECT_EQ(GetParent(StepPhase::Solve), StepPhase::Solve);
+    EXPECT_EQ(GetParent(StepPhase::VelocitySolve), StepPhase::Solve);
+    EXPECT_EQ(GetParent(StepPhase::PositionSolve), StepPhase::Solve);
+    EXPECT_EQ(GetParent(StepPhase::Toi), StepPhase::Toi);
+}
+
+TEST(StepProfiler, ProfileScopeRecordsAndAccumulates)
+{
+    auto profiler = StepProfiler{};
+    EXPECT_TRUE(empty(profiler.GetEvents()));
+    EXPECT_EQ(profiler.GetThreadCount(), std::size_t(0));
+    
+    auto accumulator = PhaseTime{};
+    {
+        ProfileScope scope{StepPhase::Solve, &profiler, &accumulator};
+    }
+    {
+        ProfileScope scope{StepPhase::Toi, &profiler, &accumulator};
+    }
+    {
+        ProfileScope scope{StepPhase::Toi, nullptr, nullptr};
+    }
+    const auto events = profiler.GetEvents();
+    ASSERT_EQ(size(events), std::size_t(2));
+    EXPECT_EQ(events[0].phase, StepPhase::Solve);
+    EXPECT_EQ(events[1].phase, StepPhase::Toi);
+    EXPECT_EQ(events[0].thread, std::uint32_t(0));
+    EXPECT_LE(events[0].begin, events[1].begin);
+    EXPECT_EQ(profiler.GetThreadCount(), std::size_t(1));
+    EXPECT_EQ(accumulator.wall, events[0].time.wall + events[1].time.wall);
+    EXPECT_GE(accumulator.cpu.count(), 0);
+    
+    profiler.Clear();
+    EXPECT_TRUE(empty(profiler.GetEvents()));
+}
+
+TEST(StepProfiler, WriteChromeTrace)
+{
+    auto profiler = StepProfiler{};
+    profiler.Record(StepPhase::NarrowPhase, StepProfiler::Clock::now(),
+                    PhaseTime{std::chrono::microseconds{5}, std::chrono::microseconds{4}});
+    std::ostringstream os;
+    WriteChromeTrace(os, profiler);
+    const auto json = os.str();
+    EXPECT_EQ(json.find("{\"traceEvents\":["), std::size_t(0));
+    EXPECT_NE(json.find("\"name\":\"NarrowPhase\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"dur\":5.000"), std::string::npos);
+    EXPECT_NE(json.find("\"cpu_us\":4.000"), std::string::npos);
+    EXPECT_EQ(json.find("\"parent\""), std::string::npos);
+    
+    profiler.Record(StepPhase::VelocitySolve, StepProfiler::Clock::now(), PhaseTime{});
+    os.str(std::string{});
+    WriteChromeTrace(os, profiler);
+    EXPECT_NE(os.str().find("\"name\":\"VelocitySolve\""), std::string::npos);
+    EXPECT_NE(os.str().find("\"parent\":\"Solve\""), std::string::npos);
+}
+
+TEST(StepProfiler, WorldStep)
+{
+    auto profiler = StepProfiler{};
+    auto world = World{WorldConf{}.UseStepProfiler(&profiler)};
+    EXPECT_EQ(world.GetStepProfiler(), &profiler);
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(1_m)};
+    world.CreateBody()->CreateFixture(shape);
+    world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic).UseLocation(Length2{0_m, 1.5_m})
+                     .UseLinearAcceleration(EarthlyGravity))->CreateFixture(shape);
+    const auto stats = world.Step(StepConf{});
+    const auto events = profiler.GetEvents();
+    if (IsStepProfilingEnabled())
+    {
+        EXPECT_FALSE(empty(events));
+        EXPECT_GT(Get(stats.times, StepPhase::NarrowPhase).wall.count(), 0);
+        EXPECT_GT(Get(stats.times, StepPhase::Solve).wall.count(), 0);
+        EXPECT_GT(Get(stats.times, StepPhase::VelocitySolve).wall.count(), 0);
+        EXPECT_GT(Get(stats.times, StepPhase::PositionSolve).wall.count(), 0);
+        EXPECT_LE(Get(stats.times, StepPhase::VelocitySolve).wall +
+                  Get(stats.times, StepPhase::PositionSolve).wall,
+                  Get(stats.times, StepPhase::Solve).wall);
+    }
+    else
+    {
+        EXPECT_TRUE(empty(events));
+        for (auto&& time: stats.times)
+        {
+            EXPECT_EQ(time.wall.count(), 0);
+            EXPECT_EQ(time.cpu.count(), 0);
+        }
+    }
+}
@@ -60,9 +60,9 @@ TEST(StepStats, ByteSize)
 {
     switch (sizeof(Real))
     {
-        case  4: EXPECT_EQ(sizeof(StepStats), std::size_t(116)); break;
-        case  8: EXPECT_EQ(sizeof(StepStats), std::size_t(136)); break;
-        case 16: EXPECT_EQ(sizeof(StepStats), std::size_t(192)); break;
+        case  4: EXPECT_EQ(sizeof(StepStats), std::size_t(280)); break;
+        case  8: EXPECT_EQ(sizeof(StepStats), std::size_t(296)); break;
+        case 16: EXPECT_EQ(sizeof(StepStats), std::size_t(352)); break;
         default: FAIL(); break;
     }
 }
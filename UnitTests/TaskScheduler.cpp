@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include "WorldTestUtils.hpp"
+#include <PlayRho/Common/TaskScheduler.hpp>
+#include <PlayRho/Common/InvalidArgument.hpp>
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Dynamics/StepConf.hpp>
+#include <PlayRho/Dynamics/WorldCallbacks.hpp>
+#include <PlayRho/Dynamics/ContactImpulsesList.hpp>
+#include <PlayRho/Dynamics/Contacts/Contact.hpp>
+#include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+namespace {
+
+void AddRubble(World& world)
+{
+    const auto ground = world.CreateBody();
+    ground->CreateFixture(Shape{EdgeShapeConf{Length2{-40_m, 0_m}, Length2{+40_m, 0_m}}});
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.25_m)};
+    const auto disk = Shape{DiskShapeConf{}.UseRadius(0.4_m).UseDensity(1_kgpm2)};
+    for (auto i = 0; i < 40; ++i)
+    {
+        for (auto j = 0; j < 10; ++j)
+        {
+            const auto velocity = LinearVelocity2{Real((i * 7 + j * 3) % 5 - 2) * 1_mps, 0_mps};
+            const auto body = world.CreateBody(BodyConf{}
+                                               .UseType(BodyType::Dynamic)
+                                               .UseLocation(Length2{Real(i * 2 - 40) * 1_m,
+                                                                    Real(j + 1) * 1_m})
+                                               .UseLinearVelocity(velocity)
+                                               .UseLinearAcceleration(EarthlyGravity));
+            body->CreateFixture(((i + j) % 2 == 0)? box: disk);
+        }
+    }
+}
+
+/// Hashes the bits of the given values (FNV-1a).
+template <typename T>
+void HashBits(std::uint64_t& hash, const T& value)
+{
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (auto byte: bytes)
+    {
+        hash = (hash ^ byte) * 0x100000001b3u;
+    }
+}
+
+std::uint64_t GetHash(const World& world)
+{
+    auto hash = std::uint64_t{0xcbf29ce484222325u};
+    for (auto&& body: world.GetBodies())
+    {
+        const auto& b = GetRef(body);
+        HashBits(hash, b.GetLocation());
+        HashBits(hash, b.GetAngle());
+        HashBits(hash, b.GetVelocity());
+        HashBits(hash, b.IsAwake());
+    }
+    for (auto&& c: world.GetContacts())
+    {
+        const auto& contact = GetRef(std::get<Contact*>(c));
+        HashBits(hash, GetWorldIndex(contact.GetFixtureA()->GetBody()));
+        HashBits(hash, GetWorldIndex(contact.GetFixtureB()->GetBody()));
+        HashBits(hash, contact.IsTouching());
+    }
+    return hash;
+}
+
+/// Contact listener that hashes the sequence of calls made to it.
+class HashingListener: public ContactListener
+{
+public:
+    void BeginContact(Contact& contact) override
+    {
+        Add(1, contact);
+    }
+    
+    void EndContact(Contact& contact) override
+    {
+        Add(2, contact);
+    }
+    
+    void PreSolve(Contact& contact, const Manifold& oldManifold) override
+    {
+        Add(3, contact);
+        const auto count = oldManifold.GetPointCount();
+        HashBits(hash, count);
+        for (auto i = decltype(count){0}; i < count; ++i)
+        {
+            HashBits(hash, oldManifold.GetContactImpulses(i));
+        }
+    }
+    
+    void PostSolve(Contact& contact, const ContactImpulsesList& impulses,
+                   iteration_type solved) override
+    {
+        Add(4, contact);
+        const auto count = impulses.GetCount();
+        HashBits(hash, count);
+        for (auto i = decltype(count){0}; i < count; ++i)
+        {
+            HashBits(hash, impulses.GetEntryNormal(i));
+            HashBits(hash, impulses.GetEntryTanget(i));
+        }
+        HashBits(hash, solved);
+    }
+    
+    std::uint64_t hash = 0xcbf29ce484222325u;
+    
+private:
+    void Add(int call, const Contact& contact)
+    {
+        HashBits(hash, call);
+        HashBits(hash, GetWorldIndex(contact.GetFixtureA()->GetBody()));
+        HashBits(hash, GetWorldIndex(contact.GetFixtureB()->GetBody()));
+    }
+};
+
+} // anonymous namespace
+
+TEST(WorkStealingScheduler, Concurrency)
+{
+    EXPECT_EQ(WorkStealingScheduler{0}.GetConcurrency(), std::size_t(1));
+    EXPECT_EQ(WorkStealingScheduler{3}.GetConcurrency(), std::size_t(4));
+}
+
+TEST(WorkStealingScheduler, ParallelForRunsEachIndexOnce)
+{
+    for (auto workers: {std::size_t{0}, std::size_t{1}, std::size_t{4}})
+    {
+        auto scheduler = WorkStealingScheduler{workers};
+        for (auto grainSize: {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{1000}})
+        {
+            auto counts = std::vector<std::atomic<int>>(1000);
+            scheduler.ParallelFor(size(counts), grainSize, [&](std::size_t first, std::size_t last) {
+                EXPECT_LT(first, last);
+                EXPECT_LE(last - first, std::max(grainSize, std::size_t{1}));
+                for (auto i = first; i < last; ++i)
+                {
+                    ++counts[i];
+                }
+            });
+            for (auto&& count: counts)
+            {
+                EXPECT_EQ(count, 1);
+            }
+        }
+        scheduler.ParallelFor(0, 1, [](std::size_t, std::size_t) {
+            ADD_FAILURE();
+        });
+    }
+}
+
+TEST(WorkStealingScheduler, ParallelForRethrows)
+{
+    auto scheduler = WorkStealingScheduler{2};
+    auto count = std::atomic<int>{0};
+    EXPECT_THROW(scheduler.ParallelFor(100, 1, [&](std::size_t first, std::size_t) {
+        ++count;
+        if (first == 50)
+        {
+            throw InvalidArgument("test");
+        }
+    }), InvalidArgument);
+    EXPECT_EQ(count, 100);
+}
+
+TEST(WorkStealingScheduler, NestedParallelFor)
+{
+    auto scheduler = WorkStealingScheduler{2};
+    auto count = std::atomic<int>{0};
+    scheduler.ParallelFor(8, 1, [&](std::size_t, std::size_t) {
+        scheduler.ParallelFor(8, 1, [&](std::size_t, std::size_t) {
+            ++count;
+        });
+    });
+    EXPECT_EQ(count, 64);
+}
+
+TEST(WorkStealingScheduler, WorldStepMatchesUnscheduled)
+{
+    auto scheduler = WorkStealingScheduler{3};
+    auto world = World{};
+    auto scheduled = World{WorldConf{}.UseTaskScheduler(&scheduler)};
+    EXPECT_EQ(world.GetTaskScheduler(), nullptr);
+    EXPECT_EQ(scheduled.GetTaskScheduler(), &scheduler);
+    // Enough bodies for their proxies to get synchronized in more than one chunk.
+    AddStacks(world, 32, 4);
+    AddStacks(scheduled, 32, 4);
+    
+    const auto stepConf = StepConf{};
+    for (auto i = 0; i < 60; ++i)
+    {
+        const auto stats = world.Step(stepConf);
+        const auto scheduledStats = scheduled.Step(stepConf);
+        EXPECT_EQ(scheduledStats.reg.islandsFound, stats.reg.islandsFound);
+        EXPECT_EQ(scheduledStats.reg.proxiesMoved, stats.reg.proxiesMoved);
+        EXPECT_EQ(scheduledStats.pre.updated, stats.pre.updated);
+    }
+    ASSERT_EQ(GetBodyCount(scheduled), GetBodyCount(world));
+    auto it = begin(scheduled.GetBodies());
+    for (auto&& body: world.GetBodies())
+    {
+        EXPECT_EQ((*it)->GetLocation(), body->GetLocation());
+        EXPECT_EQ((*it)->GetVelocity(), body->GetVelocity());
+        EXPECT_EQ((*it)->IsAwake(), body->IsAwake());
+        ++it;
+    }
+}
+
+TEST(WorkStealingScheduler, DeterministicWorldHashesMatchAcrossWorkerCounts)
+{
+    const auto run = [](const WorldConf& conf) {
+        auto world = World{conf};
+        auto listener = HashingListener{};
+        world.SetContactListener(&listener);
+        AddRubble(world);
+        const auto stepConf = StepConf{};
+        for (auto i = 0; i < 90; ++i)
+        {
+            world.Step(stepConf);
+        }
+        EXPECT_GT(GetTouchingCount(world), ContactCounter(100));
+        return std::make_pair(GetHash(world), listener.hash);
+    };
+    
+    // Results without a scheduler are the reference.
+    const auto expected = run(WorldConf{});
+    for (auto workers: {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{7}})
+    {
+        auto scheduler = WorkStealingScheduler{workers};
+        const auto conf = WorldConf{}.UseTaskScheduler(&scheduler).UseDeterministic(true);
+        EXPECT_TRUE(World{conf}.IsDeterministic());
+        const auto actual = run(conf);
+        EXPECT_EQ(actual.first, expected.first) << "workers=" << workers;
+        EXPECT_EQ(actual.second, expected.second) << "workers=" << workers;
+    }
+    EXPECT_FALSE(World{}.IsDeterministic());
+}
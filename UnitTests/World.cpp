@@ -29,6 +29,9 @@
 #include <PlayRho/Collision/Shapes/DiskShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
 #include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/ChainShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/MultiShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/HeightFieldShapeConf.hpp>
 #include <PlayRho/Collision/Collision.hpp>
 #include <PlayRho/Collision/RayCastInput.hpp>
 #include <PlayRho/Collision/RayCastOutput.hpp>
@@ -77,25 +80,25 @@ TEST(World, ByteSize)
             // Size is OS dependent.
             // Seems linux containers are bigger in size...
 #ifdef __APPLE__
-            EXPECT_EQ(sizeof(World), std::size_t(232));
+            EXPECT_EQ(sizeof(World), std::size_t(424));
 #endif
 #ifdef __linux__
-            EXPECT_EQ(sizeof(World), std::size_t(232));
+            EXPECT_EQ(sizeof(World), std::size_t(424));
 #endif
             break;
         }
         case  8:
         {
 #ifdef __APPLE__
-            EXPECT_EQ(sizeof(World), std::size_t(248));
+            EXPECT_EQ(sizeof(World), std::size_t(440));
 #endif
 #ifdef __linux__
-            EXPECT_EQ(sizeof(World), std::size_t(248));
+            EXPECT_EQ(sizeof(World), std::size_t(440));
 #endif
             break;
         }
         case 16:
-            EXPECT_EQ(sizeof(World), std::size_t(272));
+            EXPECT_EQ(sizeof(World), std::size_t(488));
             break;
         default: FAIL(); break;
     }
@@ -653,6 +656,391 @@ TEST(World, CreateDestroyContactingBodies)
     EXPECT_EQ(GetFixtureCount(world), std::size_t(0));
 }
 
+TEST(World, CreateBodiesAndDestroyBodies)
+{
+    const auto conf = WorldConf{}.UseBodyCapacity(64).UseContactCapacity(256).UseProxyCapacity(64);
+    EXPECT_EQ(conf.bodyCapacity, BodyCounter(64));
+    EXPECT_EQ(conf.contactCapacity, ContactCounter(256));
+    EXPECT_EQ(conf.proxyCapacity, ContactCounter(64));
+    
+    auto defs = std::vector<BodyConf>{};
+    for (auto i = 0; i < 40; ++i)
+    {
+        defs.push_back(BodyConf{}
+                       .UseType(BodyType::Dynamic)
+                       .UseLocation(Length2{Real(i % 8) * 1_m, Real(i / 8) * 1_m})
+                       .UseLinearAcceleration(EarthlyGravity));
+    }
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(0.6_m).UseDensity(1_kgpm2)};
+    
+    auto bulk = World{conf};
+    auto single = World{conf};
+    for (auto world: {&bulk, &single})
+    {
+        world->CreateBody()->CreateFixture(Shape{EdgeShapeConf{Length2{-10_m, -1_m}, Length2{10_m, -1_m}}});
+        const auto created = world->CreateBodies(Span<const BodyConf>(defs.data(), defs.size()));
+        ASSERT_EQ(size(created), defs.size());
+        const auto bodies = std::vector<Body*>(begin(created), end(created));
+        for (auto i = std::size_t{0}; i < size(bodies); ++i)
+        {
+            EXPECT_EQ(bodies[i]->GetLocation(), defs[i].location);
+            bodies[i]->CreateFixture(shape);
+        }
+        world->CreateJoint(DistanceJointConf{bodies[0], bodies[1], Length2{}, Length2{1_m, 0_m}});
+        world->CreateJoint(DistanceJointConf{bodies[2], bodies[3], Length2{2_m, 0_m}, Length2{3_m, 0_m}});
+        EXPECT_EQ(GetBodyCount(*world), BodyCounter(41));
+        world->Step(StepConf{});
+        ASSERT_GT(GetContactCount(*world), ContactCounter(40));
+    }
+    
+    // Every other one of the created bodies.
+    const auto getDoomed = [](const World& world) {
+        auto doomed = std::vector<Body*>{};
+        auto i = 0;
+        for (auto&& body: world.GetBodies())
+        {
+            if ((i % 2) == 1)
+            {
+                doomed.push_back(body);
+            }
+            ++i;
+        }
+        return doomed;
+    };
+    auto doomed = getDoomed(bulk);
+    doomed.push_back(doomed.front());
+    EXPECT_THROW(bulk.DestroyBodies(Span<Body* const>(doomed.data(), doomed.size())), InvalidArgument);
+    EXPECT_EQ(GetBodyCount(bulk), BodyCounter(41));
+    doomed.pop_back();
+    
+    bulk.DestroyBodies(Span<Body* const>(doomed.data(), doomed.size()));
+    for (auto&& body: getDoomed(single))
+    {
+        single.Destroy(body);
+    }
+    EXPECT_EQ(GetBodyCount(bulk), BodyCounter(21));
+    EXPECT_EQ(GetFixtureCount(bulk), std::size_t(21));
+    EXPECT_EQ(GetJointCount(bulk), JointCounter(0));
+    EXPECT_EQ(GetContactCount(bulk), GetContactCount(single));
+    EXPECT_TRUE(empty(bulk.GetBodiesForProxies()));
+    for (auto&& c: bulk.GetContacts())
+    {
+        const auto& contact = GetRef(std::get<Contact*>(c));
+        EXPECT_LT(GetWorldIndex(contact.GetFixtureA()->GetBody()), BodyCounter(21));
+        EXPECT_LT(GetWorldIndex(contact.GetFixtureB()->GetBody()), BodyCounter(21));
+    }
+    
+    // Same results as destroying the bodies one at a time.
+    for (auto i = 0; i < 30; ++i)
+    {
+        bulk.Step(StepConf{});
+        single.Step(StepConf{});
+    }
+    auto it = begin(single.GetBodies());
+    for (auto&& body: bulk.GetBodies())
+    {
+        EXPECT_EQ(body->GetLocation(), (*it)->GetLocation());
+        ++it;
+    }
+    
+    bulk.DestroyBodies(Span<Body* const>{});
+    EXPECT_EQ(GetBodyCount(bulk), BodyCounter(21));
+    EXPECT_EQ(size(bulk.CreateBodies(Span<const BodyConf>{})), std::size_t(0));
+}
+
+TEST(World, FilteredPairsRejectedByBroadPhase)
+{
+    auto world = World{};
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(1_m).UseDensity(1_kgpm2)};
+    auto filter = Filter{};
+    filter.categoryBits = 0x0002;
+    filter.maskBits = 0x0001;
+    const auto bodyA = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    const auto bodyB = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                        .UseLocation(Length2{1_m, 0_m}));
+    const auto fixtureA = bodyA->CreateFixture(shape, FixtureConf{}.UseFilter(filter));
+    const auto fixtureB = bodyB->CreateFixture(shape, FixtureConf{}.UseFilter(filter));
+
+    const auto stepConf = StepConf{};
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    ASSERT_EQ(fixtureA->GetProxyCount(), ChildCounter(1));
+    const auto leafData = world.GetTree().GetLeafData(fixtureA->GetProxy(0).treeId);
+    EXPECT_EQ(GetFilter(leafData), filter);
+
+    // Refiltering has to update the filters cached by the proxies.
+    filter.maskBits = 0x0002;
+    fixtureB->SetFilterData(filter);
+    EXPECT_EQ(GetFilter(world.GetTree().GetLeafData(fixtureB->GetProxy(0).treeId)), filter);
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    fixtureA->SetFilterData(filter);
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(1));
+
+    filter.groupIndex = -1;
+    fixtureA->SetFilterData(filter);
+    fixtureB->SetFilterData(filter);
+    world.Step(stepConf);
+    EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+}
+
+TEST(World, SpeculativeContactsPreventTunneling)
+{
+    const auto run = [](bool doSpeculative) {
+        auto world = World{};
+        const auto wall = world.CreateBody();
+        wall->CreateFixture(Shape{PolygonShapeConf{}.SetAsBox(0.05_m, 5_m)});
+        const auto bullet = world.CreateBody(BodyConf{}
+                                             .UseType(BodyType::Dynamic)
+                                             .UseLocation(Length2{-3_m, 0_m})
+                                             .UseLinearVelocity(LinearVelocity2{60_mps, 0_mps}));
+        bullet->CreateFixture(Shape{DiskShapeConf{}.UseRadius(0.25_m).UseDensity(1_kgpm2)});
+        auto stepConf = StepConf{};
+        stepConf.doToi = false;
+        stepConf.doSpeculative = doSpeculative;
+        for (auto i = 0; i < 10; ++i)
+        {
+            world.Step(stepConf);
+        }
+        return GetX(bullet->GetLocation());
+    };
+
+    // Without any continuous collision detection, the bullet goes right through the wall.
+    EXPECT_GT(run(false), 0.3_m);
+
+    // Speculative contacts stop the bullet at the wall within the regular phase.
+    const auto x = run(true);
+    EXPECT_LT(x, -0.25_m);
+    EXPECT_GT(x, -0.35_m);
+}
+
+TEST(World, SubSteppedSolverKeepsStackStanding)
+{
+    // A column of small boxes, every other one slightly offset, that the iterative solver
+    // with its default iterations can't keep standing.
+    const auto rows = 10;
+    const auto run = [&](StepConf::iteration_type subSteps) {
+        auto world = World{};
+        world.CreateBody()->CreateFixture(Shape{EdgeShapeConf{Length2{-10_m, 0_m},
+                                                              Length2{10_m, 0_m}}});
+        const auto shape = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).UseFriction(Real(0.3f))
+            .SetAsBox(0.1_m, 0.1_m)};
+        auto boxes = std::vector<Body*>{};
+        for (auto i = 0; i < rows; ++i)
+        {
+            const auto x = ((i % 2) == 0)? -0.01_m: 0.01_m;
+            boxes.push_back(world.CreateBody(BodyConf{}
+                                             .UseType(BodyType::Dynamic)
+                                             .UseAllowSleep(false)
+                                             .UseLocation(Length2{x, (2 * i + 1) * 0.1_m})
+                                             .UseLinearAcceleration(EarthlyGravity)));
+            boxes.back()->CreateFixture(shape);
+        }
+        auto stepConf = StepConf{};
+        stepConf.regSubSteps = subSteps;
+        world.Step(stepConf);
+        const auto stats = world.Step(stepConf);
+        EXPECT_EQ(stats.reg.islandsFound, 1u);
+        if (subSteps > 0)
+        {
+            // The stack is solved in as many passes as there are sub-steps.
+            EXPECT_EQ(stats.reg.sumVelIters, subSteps);
+            EXPECT_EQ(stats.reg.sumPosIters, subSteps);
+        }
+        for (auto i = 0; i < 238; ++i)
+        {
+            world.Step(stepConf);
+        }
+        return GetY(boxes.back()->GetLocation());
+    };
+
+    // The top box rests a little above this due to the vertex radii of the boxes.
+    const auto height = (2 * rows - 1) * 0.1_m;
+    EXPECT_LT(run(0), height - 0.5_m);
+    EXPECT_GT(run(4), height - 0.01_m);
+}
+
+TEST(World, SpeculativeDistanceIncludesAngularMotion)
+{
+    const auto run = [](AngularVelocity angularVelocity) {
+        auto world = World{};
+        world.CreateBody(BodyConf{}.UseLocation(Length2{0_m, -0.5_m}))
+            ->CreateFixture(Shape{PolygonShapeConf{}.SetAsBox(5_m, 0.5_m)});
+        // The bar lies just above the ground without any linear velocity.
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseLocation(Length2{0_m, 0.1_m})
+                         .UseAngularVelocity(angularVelocity))
+            ->CreateFixture(Shape{PolygonShapeConf{}.SetAsBox(2_m, 0.05_m).UseDensity(1_kgpm2)});
+        auto stepConf = StepConf{};
+        stepConf.doToi = false;
+        stepConf.doSpeculative = true;
+        world.Step(stepConf);
+        auto touching = false;
+        for (auto&& c: world.GetContacts())
+        {
+            touching = touching || GetRef(std::get<Contact*>(c)).IsTouching();
+        }
+        return touching;
+    };
+
+    // The bar's ends sweep down by more than the gap within the step when it spins.
+    EXPECT_FALSE(run(0_rpm));
+    EXPECT_TRUE(run(360_deg / 1_s));
+}
+
+TEST(World, Split)
+{
+    auto world = World{};
+    const auto other = world.CreateBody();
+    other->CreateFixture(Shape{DiskShapeConf{0.5_m}.UseLocation(Length2{1.5_m, 0_m})});
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                       .UseLinearVelocity(LinearVelocity2{1_mps, 0_mps})
+                                       .UseAngularVelocity(1_rad / 1_s));
+    const auto disk = DiskShapeConf{0.5_m}.UseDensity(1_kgpm2);
+    const auto fixtureA = body->CreateFixture(Shape{DiskShapeConf{disk}.UseLocation(Length2{-1_m, 0_m})});
+    const auto fixtureB = body->CreateFixture(Shape{DiskShapeConf{disk}.UseLocation(Length2{+1_m, 0_m})});
+    world.Step(StepConf{});
+    ASSERT_EQ(world.GetContacts().size(), ContactCounter(1));
+    ASSERT_EQ(body->GetContacts().size(), std::size_t(1));
+    ASSERT_EQ(fixtureB->GetProxyCount(), ChildCounter(1));
+    
+    const auto mass = GetMass(*body);
+    const auto centerB = GetWorldPoint(*body, Length2{1_m, 0_m});
+    const auto velocityB = GetLinearVelocityFromWorldPoint(*body, centerB);
+    const auto angularVelocity = body->GetVelocity().angular;
+    const auto treeId = fixtureB->GetProxy(0).treeId;
+    
+    Fixture* const fixtures[] = {fixtureB};
+    const auto newBody = world.Split(*body, fixtures);
+    ASSERT_NE(newBody, nullptr);
+    EXPECT_EQ(GetBodyCount(world), BodyCounter(3));
+    EXPECT_EQ(fixtureA->GetBody(), body);
+    EXPECT_EQ(fixtureB->GetBody(), newBody);
+    EXPECT_EQ(size(body->GetFixtures()), std::size_t(1));
+    EXPECT_EQ(size(newBody->GetFixtures()), std::size_t(1));
+    
+    // The proxy and the contact are kept in place.
+    EXPECT_EQ(fixtureB->GetProxyCount(), ChildCounter(1));
+    EXPECT_EQ(fixtureB->GetProxy(0).treeId, treeId);
+    EXPECT_EQ(world.GetTree().GetLeafData(treeId).body, newBody);
+    EXPECT_EQ(world.GetContacts().size(), ContactCounter(1));
+    EXPECT_TRUE(body->GetContacts().empty());
+    EXPECT_EQ(newBody->GetContacts().size(), std::size_t(1));
+    
+    EXPECT_NEAR(static_cast<double>(Real{(GetMass(*body) + GetMass(*newBody)) / 1_kg}),
+                static_cast<double>(Real{mass / 1_kg}), 0.0001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(newBody->GetWorldCenter()) / 1_m}),
+                static_cast<double>(Real{GetX(centerB) / 1_m}), 0.0001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(newBody->GetVelocity().linear) / 1_mps}),
+                static_cast<double>(Real{GetX(velocityB) / 1_mps}), 0.0001);
+    EXPECT_NEAR(static_cast<double>(Real{GetY(newBody->GetVelocity().linear) / 1_mps}),
+                static_cast<double>(Real{GetY(velocityB) / 1_mps}), 0.0001);
+    EXPECT_EQ(newBody->GetVelocity().angular, angularVelocity);
+    
+    EXPECT_THROW(world.Split(*body, fixtures), InvalidArgument);
+    Fixture* const duplicates[] = {fixtureA, fixtureA};
+    EXPECT_THROW(world.Split(*body, duplicates), InvalidArgument);
+    
+    EXPECT_NO_THROW(world.Step(StepConf{}));
+    world.Destroy(newBody);
+    EXPECT_TRUE(world.GetContacts().empty());
+}
+
+TEST(World, IslandSleepsAndWakesAsUnit)
+{
+    auto world = World{};
+    const auto ground = world.CreateBody();
+    ground->CreateFixture(Shape{EdgeShapeConf{Length2{-10_m, 0_m}, Length2{10_m, 0_m}}});
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+    auto boxes = std::vector<Body*>{};
+    for (auto i = 0; i < 3; ++i)
+    {
+        const auto body = world.CreateBody(BodyConf{}
+                                           .UseType(BodyType::Dynamic)
+                                           .UseLocation(Length2{0_m, (0.5f + i) * 1_m})
+                                           .UseLinearAcceleration(EarthlyGravity));
+        body->CreateFixture(box);
+        boxes.push_back(body);
+    }
+    const auto isAwake = [](const Body* b) { return b->IsAwake(); };
+    
+    const auto stepConf = StepConf{};
+    auto stats = StepStats{};
+    for (auto i = 0; (i < 1000) && std::any_of(begin(boxes), end(boxes), isAwake); ++i)
+    {
+        stats = world.Step(stepConf);
+    }
+    ASSERT_TRUE(std::none_of(begin(boxes), end(boxes), isAwake));
+    const auto numContacts = world.GetContacts().size();
+    ASSERT_EQ(numContacts, ContactCounter(3));
+    
+    // Sleeping contacts are kept but aren't updated.
+    stats = world.Step(stepConf);
+    EXPECT_EQ(world.GetContacts().size(), numContacts);
+    EXPECT_EQ(stats.pre.ignored, numContacts);
+    EXPECT_EQ(stats.pre.updated, ContactCounter(0));
+    EXPECT_EQ(stats.reg.islandsFound, 0u);
+    
+    // Waking any body of the island wakes all of them.
+    boxes.back()->SetAwake();
+    EXPECT_TRUE(std::all_of(begin(boxes), end(boxes), isAwake));
+    stats = world.Step(stepConf);
+    EXPECT_EQ(world.GetContacts().size(), numContacts);
+    EXPECT_EQ(stats.pre.ignored, ContactCounter(0));
+    EXPECT_EQ(stats.reg.islandsFound, 1u);
+    
+    for (auto i = 0; (i < 1000) && std::any_of(begin(boxes), end(boxes), isAwake); ++i)
+    {
+        world.Step(stepConf);
+    }
+    ASSERT_TRUE(std::none_of(begin(boxes), end(boxes), isAwake));
+    
+    // Copies keep the islands.
+    auto copy = World{world};
+    const auto copies = copy.GetBodies();
+    GetRef(*std::prev(end(copies))).SetAwake();
+    EXPECT_TRUE(std::all_of(std::next(begin(copies)), end(copies), [](const Body* b) {
+        return b->IsAwake();
+    }));
+    EXPECT_NO_THROW(copy.Step(stepConf));
+    
+    // Destroying a body of the island wakes the rest of it.
+    world.Destroy(boxes.back());
+    boxes.pop_back();
+    EXPECT_TRUE(std::all_of(begin(boxes), end(boxes), isAwake));
+    EXPECT_EQ(world.GetContacts().size(), ContactCounter(2));
+    EXPECT_NO_THROW(world.Step(stepConf));
+}
+
+TEST(World, Slice)
+{
+    auto world = World{};
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic)
+                                       .UseLocation(Length2{2_m, 0_m}));
+    const auto box = body->CreateFixture(Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(2_m, 1_m)});
+    const auto mass = GetMass(*body);
+    
+    EXPECT_EQ(Slice(world, *box, Length2{10_m, 0_m}, UnitVec::GetRight()), nullptr);
+    EXPECT_EQ(size(body->GetFixtures()), std::size_t(1));
+    
+    const auto newBody = Slice(world, *box, Length2{2_m, 0_m}, UnitVec::GetRight());
+    ASSERT_NE(newBody, nullptr);
+    EXPECT_EQ(GetBodyCount(world), BodyCounter(2));
+    EXPECT_EQ(size(body->GetFixtures()), std::size_t(1));
+    EXPECT_EQ(size(newBody->GetFixtures()), std::size_t(1));
+    EXPECT_NEAR(static_cast<double>(Real{GetMass(*body) / 1_kg}),
+                static_cast<double>(Real{mass / 2 / 1_kg}), 0.001);
+    EXPECT_NEAR(static_cast<double>(Real{GetMass(*newBody) / 1_kg}),
+                static_cast<double>(Real{mass / 2 / 1_kg}), 0.001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(newBody->GetWorldCenter()) / 1_m}), 3.0, 0.001);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(body->GetWorldCenter()) / 1_m}), 1.0, 0.001);
+    
+    const auto disk = body->CreateFixture(Shape{DiskShapeConf{1_m}});
+    EXPECT_THROW(Slice(world, *disk, Length2{2_m, 0_m}, UnitVec::GetRight()), InvalidArgument);
+}
+
 #if 0
 TEST(World, CreateAndDestroyFixture)
 {
@@ -1065,6 +1453,347 @@ TEST(World, FindClosestBodyFF)
     EXPECT_EQ(FindClosestBody(world, Length2{0_m, 0_m}), b2);
 }
 
+TEST(World, FindClosestFixtures)
+{
+    World world;
+    EXPECT_TRUE(empty(FindClosestFixtures(world, Length2{}, 2)));
+    EXPECT_EQ(FindClosestFixture(world, Length2{}).fixture, nullptr);
+
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(1_m)};
+    auto fixtures = std::vector<Fixture*>{};
+    for (auto i = 0; i < 8; ++i)
+    {
+        const auto location = Length2{Real(i * 4) * 1_m, 0_m};
+        fixtures.push_back(world.CreateBody(BodyConf{}.UseLocation(location))->CreateFixture(shape));
+    }
+
+    // Proxies only get created by stepping the world.
+    EXPECT_EQ(FindClosestFixture(world, Length2{}).fixture, nullptr);
+    world.Step(StepConf{});
+
+    const auto closest = FindClosestFixture(world, Length2{13_m, 0_m});
+    EXPECT_EQ(closest.fixture, fixtures[3]);
+    EXPECT_EQ(closest.childIndex, ChildCounter(0));
+    EXPECT_NEAR(static_cast<double>(Real{closest.distance / Meter}), 0.0, 0.001);
+
+    const auto found = FindClosestFixtures(world, Length2{13_m, 0_m}, 3);
+    ASSERT_EQ(size(found), std::size_t(3));
+    EXPECT_EQ(found[0].fixture, fixtures[3]);
+    EXPECT_EQ(found[1].fixture, fixtures[4]);
+    EXPECT_NEAR(static_cast<double>(Real{found[1].distance / Meter}), 2.0, 0.001);
+    EXPECT_EQ(found[2].fixture, fixtures[2]);
+    EXPECT_NEAR(static_cast<double>(Real{found[2].distance / Meter}), 4.0, 0.001);
+
+    const auto within = FindFixturesWithin(world, Length2{-4_m, 0_m}, 8_m);
+    ASSERT_EQ(size(within), std::size_t(2));
+    EXPECT_EQ(within[0].fixture, fixtures[0]);
+    EXPECT_EQ(within[1].fixture, fixtures[1]);
+    EXPECT_TRUE(empty(FindFixturesWithin(world, Length2{-4_m, 0_m}, 2_m)));
+}
+
+TEST(World, RayCastPacket)
+{
+    World world;
+    const auto shape = Shape{PolygonShapeConf{}.SetAsBox(0.5_m, 0.5_m)};
+    for (auto i = 0; i < 16; ++i)
+    {
+        const auto angle = Real(i) * 2 * Pi / 16;
+        const auto distance = Real(3 + (i % 4));
+        world.CreateBody(BodyConf{}.UseLocation(Length2{distance * std::cos(angle) * 1_m,
+                                                        distance * std::sin(angle) * 1_m}))
+            ->CreateFixture(shape);
+    }
+    world.Step(StepConf{}.SetTime(0_s));
+
+    auto inputs = std::vector<RayCastInput>{};
+    for (auto i = 0; i < 256; ++i)
+    {
+        const auto angle = Real(i) * 2 * Pi / 256;
+        inputs.push_back(RayCastInput{Length2{}, Length2{10 * std::cos(angle) * 1_m,
+                                                         10 * std::sin(angle) * 1_m},
+                                      UnitInterval<Real>{1}});
+    }
+    const auto hits = RayCast(world, Span<const RayCastInput>(data(inputs), size(inputs)));
+    ASSERT_EQ(size(hits), size(inputs));
+
+    auto hitCount = 0;
+    for (auto i = decltype(size(inputs)){0}; i < size(inputs); ++i)
+    {
+        // Compare against casting the ray by itself and keeping the closest hit.
+        auto expected = FixtureRayCastHit{};
+        RayCast(world.GetTree(), inputs[i], [&](Fixture* fixture, ChildCounter child,
+                                                Length2, UnitVec) {
+            expected.fixture = fixture;
+            expected.childIndex = child;
+            return RayCastOpcode::ClipRay;
+        });
+        EXPECT_EQ(hits[i].fixture, expected.fixture);
+        if (hits[i].fixture)
+        {
+            ++hitCount;
+            EXPECT_EQ(hits[i].childIndex, expected.childIndex);
+            EXPECT_LT(hits[i].hit.fraction, Real(0.7));
+        }
+    }
+    EXPECT_GT(hitCount, 0);
+    EXPECT_LT(hitCount, 256);
+}
+
+TEST(World, SingleProxyChainQueries)
+{
+    // Ground chain of 100 one meter long edges from -50m to +50m where child i is the
+    // edge from (i - 50)m to (i - 49)m.
+    auto conf = ChainShapeConf{};
+    for (auto i = 0; i <= 100; ++i)
+    {
+        conf.Add(Length2{Real(i - 50) * 1_m, 0_m});
+    }
+    World world;
+    const auto ground = world.CreateBody()->CreateFixture(Shape{conf},
+                                                          FixtureConf{}.UseSingleProxy(true));
+    world.Step(StepConf{}.SetTime(0_s));
+    ASSERT_EQ(ground->GetProxyCount(), ChildCounter(1));
+    ASSERT_NE(ground->GetChildTree(), nullptr);
+    EXPECT_EQ(ground->GetChildTree()->GetLeafCount(), DynamicTree::Size(100));
+    EXPECT_EQ(world.GetTree().GetLeafCount(), DynamicTree::Size(1));
+
+    auto children = std::vector<ChildCounter>{};
+    Query(world.GetTree(), AABB{Length2{-30.2_m, -1_m}, Length2{-29.8_m, 1_m}},
+          [&](Fixture* fixture, ChildCounter child) {
+        EXPECT_EQ(fixture, ground);
+        children.push_back(child);
+        return true;
+    });
+    std::sort(begin(children), end(children));
+    EXPECT_EQ(children, (std::vector<ChildCounter>{19, 20}));
+
+    auto rayChild = ChildCounter{0};
+    auto rayFixture = static_cast<Fixture*>(nullptr);
+    RayCast(world.GetTree(), RayCastInput{Length2{-20.5_m, 5_m}, Length2{-20.5_m, -5_m},
+                                          UnitInterval<Real>{1}},
+            [&](Fixture* fixture, ChildCounter child, Length2, UnitVec) {
+        rayFixture = fixture;
+        rayChild = child;
+        return RayCastOpcode::ClipRay;
+    });
+    EXPECT_EQ(rayFixture, ground);
+    EXPECT_EQ(rayChild, ChildCounter(29));
+
+    const auto rays = std::vector<RayCastInput>{
+        RayCastInput{Length2{10.5_m, 5_m}, Length2{10.5_m, -5_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{-40.5_m, 5_m}, Length2{-40.5_m, -5_m}, UnitInterval<Real>{1}},
+    };
+    const auto hits = RayCast(world, Span<const RayCastInput>(data(rays), size(rays)));
+    ASSERT_EQ(size(hits), std::size_t(2));
+    EXPECT_EQ(hits[0].fixture, ground);
+    EXPECT_EQ(hits[0].childIndex, ChildCounter(60));
+    EXPECT_EQ(hits[1].fixture, ground);
+    EXPECT_EQ(hits[1].childIndex, ChildCounter(9));
+
+    const auto closest = FindClosestFixture(world, Length2{35.5_m, 3_m});
+    EXPECT_EQ(closest.fixture, ground);
+    EXPECT_EQ(closest.childIndex, ChildCounter(85));
+    EXPECT_NEAR(static_cast<double>(Real{closest.distance / Meter}), 3.0, 0.01);
+
+    const auto location = Length2{};
+    auto input = ShapeCastInput{};
+    input.proxy = DistanceProxy{0.25_m, 1, &location, nullptr};
+    input.transformation = Transformation{Length2{-44.5_m, 4_m}, UnitVec::GetRight()};
+    input.translation = Length2{0_m, -8_m};
+    const auto hit = ShapeCast(world, input);
+    EXPECT_EQ(hit.fixture, ground);
+    EXPECT_EQ(hit.childIndex, ChildCounter(5));
+}
+
+TEST(World, SingleProxyContactsOnlyForOverlappingChildren)
+{
+    auto conf = ChainShapeConf{};
+    for (auto i = 0; i <= 100; ++i)
+    {
+        conf.Add(Length2{Real(i - 50) * 1_m, 0_m});
+    }
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+
+    // Compound of two half meter boxes a meter and a half apart.
+    const auto getSquare = [](Length x) {
+        auto vertices = VertexSet{};
+        vertices.add(Length2{x - 0.25_m, -0.25_m});
+        vertices.add(Length2{x + 0.25_m, -0.25_m});
+        vertices.add(Length2{x + 0.25_m, +0.25_m});
+        vertices.add(Length2{x - 0.25_m, +0.25_m});
+        return vertices;
+    };
+    const auto compound = Shape{MultiShapeConf{}
+        .AddConvexHull(getSquare(-1_m)).AddConvexHull(getSquare(+1_m)).UseDensity(1_kgpm2)};
+
+    const auto run = [&](bool singleProxy) {
+        World world;
+        world.CreateBody()->CreateFixture(Shape{conf}, FixtureConf{}.UseSingleProxy(singleProxy));
+        const auto boxBody = world.CreateBody(BodyConf{}
+                                              .UseType(BodyType::Dynamic)
+                                              .UseLocation(Length2{10.5_m, 2_m})
+                                              .UseLinearAcceleration(EarthlyGravity));
+        boxBody->CreateFixture(box);
+        const auto compoundBody = world.CreateBody(BodyConf{}
+                                                   .UseType(BodyType::Dynamic)
+                                                   .UseLocation(Length2{-20_m, 3_m})
+                                                   .UseLinearAcceleration(EarthlyGravity));
+        compoundBody->CreateFixture(compound, FixtureConf{}.UseSingleProxy(singleProxy));
+        const auto stepConf = StepConf{};
+        for (auto i = 0; i < 200; ++i)
+        {
+            world.Step(stepConf);
+            if (singleProxy)
+            {
+                // Only children near the bodies may have contacts.
+                for (auto&& ci: world.GetContacts())
+                {
+                    const auto& c = GetRef(std::get<Contact*>(ci));
+                    const auto groundChild = (c.GetFixtureA()->GetBody() == boxBody ||
+                                              c.GetFixtureA()->GetBody() == compoundBody)?
+                        c.GetChildIndexB(): c.GetChildIndexA();
+                    const auto other = (c.GetFixtureA()->GetBody() == boxBody ||
+                                        c.GetFixtureB()->GetBody() == boxBody)?
+                        boxBody: compoundBody;
+                    if (other == boxBody)
+                    {
+                        EXPECT_GE(groundChild, ChildCounter(59));
+                        EXPECT_LE(groundChild, ChildCounter(61));
+                    }
+                    else
+                    {
+                        EXPECT_GE(groundChild, ChildCounter(28));
+                        EXPECT_LE(groundChild, ChildCounter(31));
+                    }
+                }
+            }
+        }
+        EXPECT_EQ(world.GetTree().GetLeafCount(), DynamicTree::Size(singleProxy? 3: 103));
+        return std::make_tuple(boxBody->GetLocation(), compoundBody->GetLocation(),
+                               GetTouchingCount(world));
+    };
+
+    const auto single = run(true);
+    const auto multiple = run(false);
+    EXPECT_NEAR(static_cast<double>(Real{GetY(std::get<0>(single)) / Meter}), 0.5, 0.02);
+    EXPECT_NEAR(static_cast<double>(Real{GetY(std::get<1>(single)) / Meter}), 0.25, 0.02);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(std::get<0>(single)) / Meter}),
+                static_cast<double>(Real{GetX(std::get<0>(multiple)) / Meter}), 0.01);
+    EXPECT_NEAR(static_cast<double>(Real{GetX(std::get<1>(single)) / Meter}),
+                static_cast<double>(Real{GetX(std::get<1>(multiple)) / Meter}), 0.01);
+    EXPECT_GT(std::get<2>(single), ContactCounter(0));
+    EXPECT_EQ(std::get<2>(single), std::get<2>(multiple));
+}
+
+TEST(World, HeightFieldQueries)
+{
+    // Ground of 100 one meter wide flat cells from -50m to +50m where child i is the
+    // cell from (i - 50)m to (i - 49)m.
+    const auto conf = HeightFieldShapeConf{}.Set(1_m, std::vector<Length>(101, 0_m));
+    World world;
+    const auto ground = world.CreateBody(BodyConf{}.UseLocation(Length2{-50_m, 0_m}))
+        ->CreateFixture(Shape{conf});
+    world.Step(StepConf{}.SetTime(0_s));
+    EXPECT_FALSE(ground->IsSingleProxy());
+    EXPECT_TRUE(ground->HasSharedProxy());
+    EXPECT_EQ(ground->GetProxyCount(), ChildCounter(1));
+    EXPECT_EQ(ground->GetChildTree(), nullptr);
+    EXPECT_EQ(world.GetTree().GetLeafCount(), DynamicTree::Size(1));
+
+    auto children = std::vector<ChildCounter>{};
+    Query(world.GetTree(), AABB{Length2{-30.2_m, -1_m}, Length2{-29.8_m, 1_m}},
+          [&](Fixture* fixture, ChildCounter child) {
+        EXPECT_EQ(fixture, ground);
+        children.push_back(child);
+        return true;
+    });
+    EXPECT_EQ(children, (std::vector<ChildCounter>{19, 20}));
+
+    auto rayChild = ChildCounter{0};
+    RayCast(world.GetTree(), RayCastInput{Length2{-20.5_m, 5_m}, Length2{-20.5_m, -5_m},
+                                          UnitInterval<Real>{1}},
+            [&](Fixture* fixture, ChildCounter child, Length2, UnitVec) {
+        EXPECT_EQ(fixture, ground);
+        rayChild = child;
+        return RayCastOpcode::ClipRay;
+    });
+    EXPECT_EQ(rayChild, ChildCounter(29));
+
+    const auto rays = std::vector<RayCastInput>{
+        RayCastInput{Length2{10.5_m, 5_m}, Length2{10.5_m, -5_m}, UnitInterval<Real>{1}},
+        RayCastInput{Length2{-40.5_m, 5_m}, Length2{-40.5_m, -5_m}, UnitInterval<Real>{1}},
+    };
+    const auto hits = RayCast(world, Span<const RayCastInput>(data(rays), size(rays)));
+    ASSERT_EQ(size(hits), std::size_t(2));
+    EXPECT_EQ(hits[0].childIndex, ChildCounter(60));
+    EXPECT_EQ(hits[1].childIndex, ChildCounter(9));
+
+    const auto closest = FindClosestFixture(world, Length2{35.5_m, 3_m});
+    EXPECT_EQ(closest.fixture, ground);
+    EXPECT_EQ(closest.childIndex, ChildCounter(85));
+    EXPECT_NEAR(static_cast<double>(Real{closest.distance / Meter}), 3.0, 0.01);
+    EXPECT_EQ(FindClosestFixture(world, Length2{60_m, 0_m}).childIndex, ChildCounter(99));
+
+    const auto location = Length2{};
+    auto input = ShapeCastInput{};
+    input.proxy = DistanceProxy{0.25_m, 1, &location, nullptr};
+    input.transformation = Transformation{Length2{-44.5_m, 4_m}, UnitVec::GetRight()};
+    input.translation = Length2{0_m, -8_m};
+    const auto hit = ShapeCast(world, input);
+    EXPECT_EQ(hit.fixture, ground);
+    EXPECT_EQ(hit.childIndex, ChildCounter(5));
+}
+
+TEST(World, HeightFieldCollidesLikeChain)
+{
+    auto heights = std::vector<Length>{};
+    auto vertices = std::vector<Length2>{};
+    for (auto i = 0; i <= 40; ++i)
+    {
+        heights.push_back(((i % 4) < 2)? 0_m: 0.25_m);
+        vertices.push_back(Length2{Real(i) * 1_m, heights.back()});
+    }
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+    const auto run = [&](const Shape& ground) {
+        World world;
+        world.CreateBody()->CreateFixture(ground);
+        auto bodies = std::vector<Body*>{};
+        for (auto i = 0; i < 10; ++i)
+        {
+            bodies.push_back(world.CreateBody(BodyConf{}
+                                              .UseType(BodyType::Dynamic)
+                                              .UseLocation(Length2{Real(4 * i + 1) * 1_m, 2_m})
+                                              .UseLinearAcceleration(EarthlyGravity)));
+            bodies.back()->CreateFixture(box);
+        }
+        const auto stepConf = StepConf{};
+        for (auto i = 0; i < 100; ++i)
+        {
+            world.Step(stepConf);
+        }
+        auto locations = std::vector<Length2>{};
+        for (auto&& body: bodies)
+        {
+            locations.push_back(body->GetLocation());
+        }
+        return std::make_tuple(locations, GetTouchingCount(world), world.GetTree().GetLeafCount());
+    };
+    
+    const auto field = run(Shape{HeightFieldShapeConf{}.Set(1_m, heights)});
+    const auto chain = run(Shape{ChainShapeConf{}.Set(vertices)});
+    ASSERT_EQ(size(std::get<0>(field)), size(std::get<0>(chain)));
+    for (auto i = std::size_t{0}; i < size(std::get<0>(field)); ++i)
+    {
+        EXPECT_NEAR(static_cast<double>(Real{GetX(std::get<0>(field)[i]) / Meter}),
+                    static_cast<double>(Real{GetX(std::get<0>(chain)[i]) / Meter}), 0.001);
+        EXPECT_NEAR(static_cast<double>(Real{GetY(std::get<0>(field)[i]) / Meter}),
+                    static_cast<double>(Real{GetY(std::get<0>(chain)[i]) / Meter}), 0.001);
+    }
+    EXPECT_EQ(std::get<1>(field), std::get<1>(chain));
+    EXPECT_EQ(std::get<2>(field), DynamicTree::Size(11));
+    EXPECT_EQ(std::get<2>(chain), DynamicTree::Size(50));
+}
+
 TEST(World, GetShapeCountFreeFunction)
 {
     World world{};
@@ -1124,6 +1853,53 @@ TEST(World, GetFixtureCountFreeFunction)
     EXPECT_EQ(GetFixtureCount(world), std::size_t(3));
 }
 
+TEST(World, OnlyAwakeBodiesSeedIslands)
+{
+    auto world = World{};
+    auto bodies = std::vector<Body*>{};
+    for (auto i = 0; i < 3; ++i)
+    {
+        const auto body = world.CreateBody(BodyConf{}
+                                           .UseType(BodyType::Dynamic)
+                                           .UseLocation(Length2{i * 4_m, 0_m})
+                                           .UseLinearAcceleration(EarthlyGravity));
+        body->CreateFixture(Shape{DiskShapeConf{1_m}});
+        bodies.push_back(body);
+    }
+    
+    const auto stepConf = StepConf{};
+    auto stats = world.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 3u);
+    
+    const auto location = bodies[1]->GetLocation();
+    bodies[1]->UnsetAwake();
+    stats = world.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 2u);
+    EXPECT_EQ(bodies[1]->GetLocation(), location);
+    
+    // Bodies put to sleep and woken again between steps are only islanded once.
+    bodies[1]->SetAwake();
+    bodies[2]->UnsetAwake();
+    bodies[2]->SetAwake();
+    stats = world.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 3u);
+    EXPECT_NE(bodies[1]->GetLocation(), location);
+    
+    world.Destroy(bodies[0]);
+    stats = world.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 2u);
+    
+    // Copies list their awake bodies too.
+    bodies[2]->SetAcceleration(LinearAcceleration2{}, AngularAcceleration{});
+    bodies[2]->UnsetAwake();
+    auto copy = World{world};
+    stats = copy.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 1u);
+    GetRef(*std::prev(end(copy.GetBodies()))).SetAwake();
+    stats = copy.Step(stepConf);
+    EXPECT_EQ(stats.reg.islandsFound, 2u);
+}
+
 TEST(World, AwakenFreeFunction)
 {
     World world{};
@@ -1575,6 +2351,87 @@ public:
     const StepConf stepConf{};
 };
 
+TEST(World, SpeculativeContactsBeginWhileApart)
+{
+    const auto run = [](bool doSpeculative) {
+        MyContactListener listener{
+            [&](Contact&, const Manifold&) {},
+            [&](Contact&, const ContactImpulsesList&, ContactListener::iteration_type) {},
+            [&](Contact&) {},
+        };
+        auto world = World{};
+        world.SetContactListener(&listener);
+        const auto shape = Shape{DiskShapeConf{}.UseRadius(0.5_m).UseDensity(1_kgpm2)};
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseLocation(Length2{-0.55_m, 0_m})
+                         .UseLinearVelocity(LinearVelocity2{+6_mps, 0_mps}))
+            ->CreateFixture(shape);
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseLocation(Length2{+0.55_m, 0_m})
+                         .UseLinearVelocity(LinearVelocity2{-6_mps, 0_mps}))
+            ->CreateFixture(shape);
+        auto stepConf = StepConf{};
+        stepConf.doToi = false;
+        stepConf.doSpeculative = doSpeculative;
+        world.Step(stepConf);
+        return listener;
+    };
+
+    EXPECT_EQ(run(false).begin_contacts, 0u);
+
+    // The disks are 0.1 m apart but approach by 0.2 m within the step so the speculative
+    // contact gets reported as touching.
+    const auto listener = run(true);
+    EXPECT_EQ(listener.begin_contacts, 1u);
+    EXPECT_TRUE(listener.touching);
+    EXPECT_GT(GetMagnitude(listener.body_b[0] - listener.body_a[0]), 1_m);
+}
+
+TEST(World, SubSteppedSolverReportsImpulsesOfStep)
+{
+    // A box resting on the ground gets an impulse of about its weight times the step's
+    // time, whether or not the step gets divided into sub-steps.
+    const auto run = [](StepConf::iteration_type subSteps) {
+        auto impulse = 0_Ns;
+        MyContactListener listener{
+            [&](Contact&, const Manifold&) {},
+            [&](Contact&, const ContactImpulsesList& impulses, ContactListener::iteration_type) {
+                impulse = 0_Ns;
+                for (auto i = decltype(impulses.GetCount()){0}; i < impulses.GetCount(); ++i)
+                {
+                    impulse += impulses.GetEntryNormal(i);
+                }
+            },
+            [&](Contact&) {},
+        };
+        auto world = World{};
+        world.SetContactListener(&listener);
+        world.CreateBody()->CreateFixture(Shape{EdgeShapeConf{Length2{-10_m, 0_m},
+                                                              Length2{10_m, 0_m}}});
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseAllowSleep(false)
+                         .UseLocation(Length2{0_m, 0.5_m})
+                         .UseLinearAcceleration(EarthlyGravity))
+            ->CreateFixture(Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)});
+        auto stepConf = StepConf{};
+        stepConf.regSubSteps = subSteps;
+        for (auto i = 0; i < 60; ++i)
+        {
+            world.Step(stepConf);
+        }
+        return static_cast<double>(Real{impulse / 1_Ns});
+    };
+
+    const auto weightImpulse = static_cast<double>(Real{1_kg * -GetY(EarthlyGravity) *
+        StepConf{}.GetTime() / 1_Ns});
+    EXPECT_NEAR(run(0), weightImpulse, weightImpulse * 0.05);
+    EXPECT_NEAR(run(4), weightImpulse, weightImpulse * 0.05);
+    EXPECT_NEAR(run(8), weightImpulse, weightImpulse * 0.05);
+}
+
 TEST(World, NoCorrectionsWithNoVelOrPosIterations)
 {
     const auto x = Real(10); // other test parameters tuned to this value being 10
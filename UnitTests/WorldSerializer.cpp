@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "UnitTests.hpp"
+#include <PlayRho/PlayRho.hpp>
+#include <PlayRho/Common/WorldSerializer.hpp>
+#include <sstream>
+
+using namespace playrho;
+using namespace playrho::d2;
+
+namespace {
+
+void Populate(World& world)
+{
+    const auto ground = world.CreateBody();
+    ground->CreateFixture(Shape{EdgeShapeConf{Length2{-20_m, 0_m}, Length2{20_m, 0_m}}});
+
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+    auto previous = ground;
+    for (auto i = 0; i < 4; ++i)
+    {
+        const auto body = world.CreateBody(BodyConf{}
+                                           .UseType(BodyType::Dynamic)
+                                           .UseLocation(Length2{0_m, (0.5f + i) * 1_m})
+                                           .UseLinearAcceleration(EarthlyGravity));
+        body->CreateFixture(box);
+        world.CreateJoint(RevoluteJointConf{previous, body, body->GetLocation()});
+        previous = body;
+    }
+    const auto disk = world.CreateBody(BodyConf{}
+                                       .UseType(BodyType::Dynamic)
+                                       .UseLocation(Length2{3_m, 1_m})
+                                       .UseLinearVelocity(LinearVelocity2{1_mps, 0_mps}));
+    disk->CreateFixture(Shape{DiskShapeConf{}.UseRadius(1_m).UseDensity(2_kgpm2)},
+                        FixtureConf{}.UseIsSensor(true));
+}
+
+} // anonymous namespace
+
+TEST(WorldSerializer, EmptyWorldRoundTrips)
+{
+    const auto world = World{};
+    const auto data = Serialize(world);
+    EXPECT_FALSE(empty(data));
+
+    auto loaded = World{};
+    EXPECT_NO_THROW(Deserialize(loaded, Span<const std::uint8_t>(data.data(), data.size())));
+    EXPECT_EQ(GetBodyCount(loaded), BodyCounter(0));
+    EXPECT_EQ(GetJointCount(loaded), JointCounter(0));
+}
+
+TEST(WorldSerializer, SharedShapesStoredOnce)
+{
+    const auto shape = Shape{DiskShapeConf{}.UseRadius(1_m)};
+    auto oneBody = World{};
+    oneBody.CreateBody()->CreateFixture(shape);
+    auto twoBodies = World{};
+    twoBodies.CreateBody()->CreateFixture(shape);
+    twoBodies.CreateBody()->CreateFixture(shape);
+
+    const auto oneSize = size(Serialize(oneBody));
+    const auto twoSize = size(Serialize(twoBodies));
+    auto bodyOnly = World{};
+    bodyOnly.CreateBody();
+    auto bodyPlusOne = World{};
+    bodyPlusOne.CreateBody();
+    bodyPlusOne.CreateBody();
+    const auto perBodySize = size(Serialize(bodyPlusOne)) - size(Serialize(bodyOnly));
+
+    // The second fixture references the first fixture's shape so only the body and
+    // fixture records add to the size.
+    EXPECT_LT(twoSize - oneSize, perBodySize + 16u);
+
+    auto loaded = World{};
+    const auto data = Serialize(twoBodies);
+    Deserialize(loaded, Span<const std::uint8_t>(data.data(), data.size()));
+    const auto& bodies = loaded.GetBodies();
+    ASSERT_EQ(size(bodies), std::size_t(2));
+    const auto f0 = *begin((*begin(bodies))->GetFixtures());
+    const auto f1 = *begin((*std::next(begin(bodies)))->GetFixtures());
+    EXPECT_EQ(GetData(f0->GetShape()), GetData(f1->GetShape()));
+}
+
+TEST(WorldSerializer, RoundTripReproducesWorld)
+{
+    auto world = World{};
+    Populate(world);
+
+    const auto data = Serialize(world);
+    auto loaded = World{};
+    Deserialize(loaded, Span<const std::uint8_t>(data.data(), data.size()));
+
+    ASSERT_EQ(GetBodyCount(loaded), GetBodyCount(world));
+    ASSERT_EQ(GetJointCount(loaded), GetJointCount(world));
+    EXPECT_EQ(GetFixtureCount(loaded), GetFixtureCount(world));
+    EXPECT_EQ(GetShapeCount(loaded), GetShapeCount(world));
+
+    auto it = begin(loaded.GetBodies());
+    for (auto&& body: world.GetBodies())
+    {
+        const auto& b = GetRef(body);
+        const auto& l = GetRef(*it);
+        EXPECT_EQ(l.GetType(), b.GetType());
+        EXPECT_EQ(l.GetLocation(), b.GetLocation());
+        EXPECT_EQ(l.GetAngle(), b.GetAngle());
+        EXPECT_EQ(l.GetVelocity(), b.GetVelocity());
+        EXPECT_EQ(l.GetLinearAcceleration(), b.GetLinearAcceleration());
+        EXPECT_EQ(l.GetInvMass(), b.GetInvMass());
+        EXPECT_EQ(l.GetLocalCenter(), b.GetLocalCenter());
+        EXPECT_EQ(l.IsAwake(), b.IsAwake());
+        ASSERT_EQ(size(l.GetFixtures()), size(b.GetFixtures()));
+        auto fit = begin(l.GetFixtures());
+        for (auto&& fixture: b.GetFixtures())
+        {
+            EXPECT_EQ((*fit)->GetShape(), fixture->GetShape());
+            EXPECT_EQ((*fit)->IsSensor(), fixture->IsSensor());
+            EXPECT_EQ((*fit)->GetFilterData(), fixture->GetFilterData());
+            ++fit;
+        }
+        ++it;
+    }
+
+    const auto stepConf = StepConf{};
+    for (auto i = 0; i < 10; ++i)
+    {
+        world.Step(stepConf);
+        loaded.Step(stepConf);
+    }
+    auto lit = begin(loaded.GetBodies());
+    for (auto&& body: world.GetBodies())
+    {
+        EXPECT_EQ((*lit)->GetLocation(), body->GetLocation());
+        ++lit;
+    }
+}
+
+TEST(WorldSerializer, StreamRoundTripWithContacts)
+{
+    auto world = World{};
+    const auto ground = world.CreateBody();
+    ground->CreateFixture(Shape{EdgeShapeConf{Length2{-20_m, 0_m}, Length2{20_m, 0_m}}});
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+    for (auto i = 0; i < 3; ++i)
+    {
+        world.CreateBody(BodyConf{}
+                         .UseType(BodyType::Dynamic)
+                         .UseLocation(Length2{0_m, (0.5f + i) * 1_m})
+                         .UseLinearAcceleration(EarthlyGravity))->CreateFixture(box);
+    }
+    const auto stepConf = StepConf{};
+    for (auto i = 0; i < 20; ++i)
+    {
+        world.Step(stepConf);
+    }
+    ASSERT_GT(GetTouchingCount(world), ContactCounter(0));
+
+    std::stringstream ss;
+    Serialize(ss, world, true);
+
+    auto loaded = World{};
+    Deserialize(loaded, ss);
+    EXPECT_EQ(GetContactCount(loaded), GetContactCount(world));
+    EXPECT_EQ(GetTouchingCount(loaded), GetTouchingCount(world));
+
+    // Warm starting impulses must have been restored with the manifolds.
+    for (auto&& ci: world.GetContacts())
+    {
+        const auto& c = GetRef(std::get<Contact*>(ci));
+        const auto& manifold = c.GetManifold();
+        for (auto&& li: loaded.GetContacts())
+        {
+            const auto& l = GetRef(std::get<Contact*>(li));
+            if ((GetWorldIndex(l.GetFixtureA()->GetBody()) == GetWorldIndex(c.GetFixtureA()->GetBody())) &&
+                (GetWorldIndex(l.GetFixtureB()->GetBody()) == GetWorldIndex(c.GetFixtureB()->GetBody())))
+            {
+                ASSERT_EQ(l.GetManifold().GetPointCount(), manifold.GetPointCount());
+                for (auto i = decltype(manifold.GetPointCount()){0}; i < manifold.GetPointCount(); ++i)
+                {
+                    EXPECT_EQ(l.GetManifold().GetContactImpulses(i), manifold.GetContactImpulses(i));
+                }
+            }
+        }
+    }
+
+    world.Step(stepConf);
+    loaded.Step(stepConf);
+    auto lit = begin(loaded.GetBodies());
+    for (auto&& body: world.GetBodies())
+    {
+        EXPECT_NEAR(static_cast<double>(Real{get<1>((*lit)->GetLocation()) / Meter}),
+                    static_cast<double>(Real{get<1>(body->GetLocation()) / Meter}), 0.001);
+        ++lit;
+    }
+}
+
+TEST(WorldSerializer, HeightFieldRoundTrips)
+{
+    const auto conf = HeightFieldShapeConf{}.UseFriction(Real(0.5))
+        .UseOrigin(Length2{-2_m, 0.5_m})
+        .Set(0.5_m, std::vector<Length>{1_m, 0_m, -1_m, 2_m});
+    auto world = World{};
+    world.CreateBody()->CreateFixture(Shape{conf});
+
+    const auto data = Serialize(world);
+    auto loaded = World{};
+    Deserialize(loaded, Span<const std::uint8_t>(data.data(), data.size()));
+    ASSERT_EQ(GetFixtureCount(loaded), std::size_t(1));
+    const auto fixture = *begin((*begin(loaded.GetBodies()))->GetFixtures());
+    const auto shape = fixture->GetShape();
+    ASSERT_NE(GetHeightFieldShapeConf(shape), nullptr);
+    EXPECT_EQ(*GetHeightFieldShapeConf(shape), conf);
+}
+
+TEST(WorldSerializer, DeserializeThrowsForBadData)
+{
+    auto world = World{};
+    Populate(world);
+    auto data = Serialize(world);
+
+    auto truncated = World{};
+    EXPECT_THROW(Deserialize(truncated, Span<const std::uint8_t>(data.data(), data.size() / 2)),
+                 InvalidArgument);
+
+    auto badMagic = data;
+    badMagic[0] = 'X';
+    auto other = World{};
+    EXPECT_THROW(Deserialize(other, Span<const std::uint8_t>(badMagic.data(), badMagic.size())),
+                 InvalidArgument);
+    EXPECT_EQ(GetBodyCount(other), BodyCounter(0));
+
+    auto badVersion = data;
+    badVersion[4] = 0xFF;
+    badVersion[5] = 0xFF;
+    EXPECT_THROW(Deserialize(other, Span<const std::uint8_t>(badVersion.data(), badVersion.size())),
+                 InvalidArgument);
+}
+
+TEST(WorldSerializer, DeserializeLeavesWorldAsItWasOnThrow)
+{
+    auto source = World{};
+    Populate(source);
+    source.Step(StepConf{});
+    const auto data = Serialize(source, true);
+
+    auto world = World{};
+    const auto body = world.CreateBody(BodyConf{}.UseType(BodyType::Dynamic));
+    body->CreateFixture(Shape{DiskShapeConf{}.UseRadius(1_m)});
+
+    // Truncating at every byte fails at every part of the data, including its contacts.
+    for (auto length = std::size_t{1}; length < size(data); ++length)
+    {
+        EXPECT_THROW(Deserialize(world, Span<const std::uint8_t>(data.data(), length)),
+                     InvalidArgument);
+        ASSERT_EQ(GetBodyCount(world), BodyCounter(1));
+        EXPECT_EQ(*begin(world.GetBodies()), body);
+        EXPECT_EQ(GetFixtureCount(world), std::size_t(1));
+        EXPECT_EQ(GetJointCount(world), JointCounter(0));
+        EXPECT_EQ(GetContactCount(world), ContactCounter(0));
+    }
+
+    Deserialize(world, Span<const std::uint8_t>(data.data(), size(data)));
+    EXPECT_EQ(GetBodyCount(world), GetBodyCount(source) + 1);
+    EXPECT_EQ(GetJointCount(world), GetJointCount(source));
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2017 Louis Langholtz https://github.com/louis-langholtz/PlayRho
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef WorldTestUtils_hpp
+#define WorldTestUtils_hpp
+
+#include <PlayRho/Dynamics/World.hpp>
+#include <PlayRho/Dynamics/Body.hpp>
+#include <PlayRho/Dynamics/BodyConf.hpp>
+#include <PlayRho/Collision/Shapes/EdgeShapeConf.hpp>
+#include <PlayRho/Collision/Shapes/PolygonShapeConf.hpp>
+
+namespace playrho {
+namespace d2 {
+
+/// @brief Adds the given number of columns of the given number of dynamic one meter
+///   boxes to the given world.
+/// @details Every column stands on its own ground edge so each one settles into an
+///   island of its own.
+inline void AddStacks(World& world, int columns, int rows)
+{
+    const auto ground = world.CreateBody();
+    const auto box = Shape{PolygonShapeConf{}.UseDensity(1_kgpm2).SetAsBox(0.5_m, 0.5_m)};
+    for (auto i = 0; i < columns; ++i)
+    {
+        const auto x = Real(i * 4) * 1_m;
+        ground->CreateFixture(Shape{EdgeShapeConf{Length2{x - 1_m, 0_m}, Length2{x + 1_m, 0_m}}});
+        for (auto j = 0; j < rows; ++j)
+        {
+            world.CreateBody(BodyConf{}
+                             .UseType(BodyType::Dynamic)
+                             .UseLocation(Length2{x, (Real(0.5) + Real(j)) * 1_m})
+                             .UseLinearAcceleration(EarthlyGravity))->CreateFixture(box);
+        }
+    }
+}
+
+} // namespace d2
+} // namespace playrho
+
+#endif /* WorldTestUtils_hpp */